@@ -8,6 +8,7 @@
 #include "ReplayBrowser.hpp"
 
 #include <algorithm>
+#include <ctime>
 #include <filesystem>
 #include <fstream>
 #include <iomanip>
@@ -23,6 +24,7 @@ ReplayBrowser::ReplayBrowser(WindowSFML& window, GraphicsSFML& graphics,
     : _window(window),
       _graphics(graphics),
       _input(input),
+      _catalog("replays"),
       _backButton(0, 0, BACK_BUTTON_WIDTH, BUTTON_HEIGHT, "Back"),
       _wantsBack(false),
       _showRenameDialog(false),
@@ -57,13 +59,7 @@ ReplayBrowser::ReplayBrowser(WindowSFML& window, GraphicsSFML& graphics,
     updateLayout();
 }
 
-void ReplayBrowser::refreshReplayList()
-{
-    _replays.clear();
-    _replayButtons.clear();
-    scanReplayDirectory();
-    setupButtons();
-}
+void ReplayBrowser::refreshReplayList() { _catalog.refresh(); }
 
 void ReplayBrowser::update(float deltaTime)
 {
@@ -71,6 +67,11 @@ void ReplayBrowser::update(float deltaTime)
         _background->update(deltaTime);
     }
 
+    std::vector<ReplaySummary> summaries;
+    if (_catalog.poll(summaries)) {
+        applyCatalog(summaries);
+    }
+
     int mouseX = _input.getMouseX();
     int mouseY = _input.getMouseY();
     bool isMousePressed = _input.isMouseButtonPressed(MouseButton::Left);
@@ -364,6 +365,9 @@ void ReplayBrowser::render()
 
     std::string countText =
         std::to_string(_replays.size()) + " replay(s) found";
+    if (_catalog.isScanning()) {
+        countText += ", scanning...";
+    }
     float countX = (windowWidth - 200.0f) / 2.0f;
     _graphics.drawText(countText, countX, 110.0f, 18, 200, 200, 200, "");
 
@@ -400,11 +404,18 @@ void ReplayBrowser::render()
         float textWidth =
             _graphics.getTextWidth(_replayButtons[i].getText(), FONT_SIZE, "");
         float textX = buttonX + (buttonW / 2.0f) - (textWidth / 2.0f);
-        float textY = buttonY + (buttonH / 2.0f) - (FONT_SIZE / 2.0f);
+        float textY = buttonY + 4.0f;
 
         _graphics.drawText(_replayButtons[i].getText(), textX, textY, FONT_SIZE,
                            255, 255, 255, "");
 
+        std::string details = formatDetails(_replays[i]);
+        textWidth = _graphics.getTextWidth(details, DETAILS_FONT_SIZE, "");
+        textX = buttonX + (buttonW / 2.0f) - (textWidth / 2.0f);
+        textY = buttonY + buttonH - DETAILS_FONT_SIZE - 8.0f;
+        _graphics.drawText(details, textX, textY, DETAILS_FONT_SIZE, 200, 200,
+                           200, "");
+
         bool renameHovered = _renameButtons[i].isHovered(mouseX, mouseY);
         bool renameFocused =
             (_focusedButtonIndex == static_cast<int>(i) && _focusedColumn == 1);
@@ -599,50 +610,38 @@ void ReplayBrowser::setupButtons()
     }
 }
 
-void ReplayBrowser::scanReplayDirectory()
+void ReplayBrowser::applyCatalog(const std::vector<ReplaySummary>& summaries)
 {
-    std::string replayDir = "replays";
-
-    if (!std::filesystem::exists(replayDir)) {
-        std::filesystem::create_directory(replayDir);
-        return;
-    }
-
-    for (const auto& entry : std::filesystem::directory_iterator(replayDir)) {
-        if (!entry.is_regular_file()) {
-            continue;
-        }
-
-        std::string extension = entry.path().extension().string();
-        if (extension != ".rtr") {
-            continue;
-        }
+    _replays.clear();
+    _replays.reserve(summaries.size());
 
+    for (const auto& summary : summaries) {
         ReplayInfo info;
-        info.fileName = entry.path().filename().string();
-        info.fullPath = entry.path().string();
-        info.fileSize = entry.file_size();
-
-        auto ftime = std::filesystem::last_write_time(entry);
-        auto sctp =
-            std::chrono::time_point_cast<std::chrono::system_clock::duration>(
-                ftime - std::filesystem::file_time_type::clock::now() +
-                std::chrono::system_clock::now());
-        std::time_t cftime = std::chrono::system_clock::to_time_t(sctp);
-
+        info.fileName = summary.fileName;
+        info.fullPath =
+            (std::filesystem::path("replays") / summary.fileName).string();
+        info.recordedAt = summary.metadata.recordedAt;
+        info.duration = summary.metadata.duration;
+        info.fileSize = static_cast<size_t>(summary.fileSize);
+        info.packetCount = summary.metadata.packetCount;
+        info.finalScore = summary.metadata.finalScore;
+        info.level = summary.metadata.level;
+        info.playerCount = summary.metadata.playerCount;
+
+        std::time_t recordedAt = static_cast<std::time_t>(info.recordedAt);
         std::ostringstream oss;
-        oss << std::put_time(std::localtime(&cftime), "%Y-%m-%d %H:%M");
+        oss << std::put_time(std::localtime(&recordedAt), "%Y-%m-%d %H:%M");
         info.date = oss.str();
 
-        info.duration = 0;
-
         _replays.push_back(info);
     }
 
-    std::sort(_replays.begin(), _replays.end(),
-              [](const ReplayInfo& a, const ReplayInfo& b) {
-                  return a.date > b.date;
-              });
+    int rows = static_cast<int>(
+        std::min(_replays.size(), static_cast<size_t>(MAX_VISIBLE_REPLAYS)));
+    if (_focusedButtonIndex > rows) {
+        _focusedButtonIndex = rows;
+    }
+    setupButtons();
 }
 
 std::string ReplayBrowser::formatFileSize(size_t bytes) const
@@ -667,6 +666,21 @@ std::string ReplayBrowser::formatDuration(uint64_t milliseconds) const
     return oss.str();
 }
 
+std::string ReplayBrowser::formatDetails(const ReplayInfo& replay) const
+{
+    std::ostringstream oss;
+    oss << replay.date << "  " << formatDuration(replay.duration);
+    if (replay.level != 0) {
+        oss << "  Lv " << static_cast<int>(replay.level);
+    }
+    if (replay.playerCount != 0) {
+        oss << "  " << static_cast<int>(replay.playerCount) << "P";
+    }
+    oss << "  " << replay.finalScore << " pts  "
+        << formatFileSize(replay.fileSize);
+    return oss.str();
+}
+
 void ReplayBrowser::showRenameDialog(size_t replayIndex)
 {
     _selectedReplayIndex = replayIndex;
@@ -13,6 +13,7 @@
 
 #include "Button.hpp"
 #include "InputField.hpp"
+#include "common/replay/ReplayCatalog.hpp"
 #include "src/Background.hpp"
 #include "wrapper/graphics/GraphicsSFML.hpp"
 #include "wrapper/input/InputSFML.hpp"
@@ -27,15 +28,22 @@ struct ReplayInfo {
     std::string fileName;
     std::string fullPath;
     std::string date;
-    uint64_t duration;  // in milliseconds
-    size_t fileSize;    // in bytes
+    int64_t recordedAt;  // Unix time in seconds, used for sorting
+    uint64_t duration;   // in milliseconds
+    size_t fileSize;     // in bytes
+    uint64_t packetCount;
+    uint32_t finalScore;
+    uint8_t level;        // 0 if unknown
+    uint8_t playerCount;  // 0 if unknown
 };
 
 /**
  * @brief Browser for selecting replay files
  *
  * Displays a list of available replays with information.
- * Allows user to select a replay to watch or return to menu.
+ * Allows user to select a replay to watch or return to menu. The list
+ * comes from a ReplayCatalog, so it appears from the cached index at once
+ * and is updated when the background scan finishes.
  */
 class ReplayBrowser {
    public:
@@ -45,7 +53,7 @@ class ReplayBrowser {
     ReplayBrowser(WindowSFML& window, GraphicsSFML& graphics, InputSFML& input);
 
     /**
-     * @brief Refresh the list of available replays
+     * @brief Rescan the replay directory in the background
      */
     void refreshReplayList();
 
@@ -96,6 +104,7 @@ class ReplayBrowser {
 
     std::shared_ptr<Background> _background;
     std::vector<ReplayInfo> _replays;
+    ReplayCatalog _catalog;
     std::vector<Button> _replayButtons;
     std::vector<Button> _renameButtons;
     std::vector<Button> _deleteButtons;
@@ -132,12 +141,14 @@ class ReplayBrowser {
     static constexpr float BACK_BUTTON_WIDTH = 200.0f;
     static constexpr unsigned int FONT_SIZE = 20;
     static constexpr unsigned int TITLE_FONT_SIZE = 32;
+    static constexpr unsigned int DETAILS_FONT_SIZE = 13;
     static constexpr int MAX_VISIBLE_REPLAYS = 8;
 
     void setupButtons();
-    void scanReplayDirectory();
+    void applyCatalog(const std::vector<ReplaySummary>& summaries);
     std::string formatFileSize(size_t bytes) const;
     std::string formatDuration(uint64_t milliseconds) const;
+    std::string formatDetails(const ReplayInfo& replay) const;
 
     void showRenameDialog(size_t replayIndex);
     void showDeleteDialog(size_t replayIndex);
@@ -9,6 +9,7 @@
 
 #include <iomanip>
 #include <sstream>
+#include <utility>
 
 namespace rtype {
 
@@ -72,19 +73,13 @@ void ReplayControls::update(float deltaTime)
                 updateLayout();
                 break;
             case REWIND:
-                _player.seek(-10.0f);
+                seek(-10.0f);
                 break;
             case FORWARD:
-                _player.seek(10.0f);
+                seek(10.0f);
                 break;
             case SPEED:
-                if (_player.getSpeedMultiplier() == 0.5f) {
-                    _player.setSpeed(PlaybackSpeed::Normal);
-                } else if (_player.getSpeedMultiplier() == 1.0f) {
-                    _player.setSpeed(PlaybackSpeed::Double);
-                } else {
-                    _player.setSpeed(PlaybackSpeed::Half);
-                }
+                cycleSpeed();
                 updateLayout();
                 break;
             case EXIT:
@@ -113,24 +108,17 @@ void ReplayControls::update(float deltaTime)
                     break;
 
                 case REWIND:
-                    _player.seek(-10.0f);
+                    seek(-10.0f);
                     break;
 
                 case FORWARD:
-                    _player.seek(10.0f);
+                    seek(10.0f);
                     break;
 
-                case SPEED: {
-                    if (_player.getSpeedMultiplier() == 0.5f) {
-                        _player.setSpeed(PlaybackSpeed::Normal);
-                    } else if (_player.getSpeedMultiplier() == 1.0f) {
-                        _player.setSpeed(PlaybackSpeed::Double);
-                    } else {
-                        _player.setSpeed(PlaybackSpeed::Half);
-                    }
+                case SPEED:
+                    cycleSpeed();
                     updateLayout();
                     break;
-                }
 
                 case EXIT:
                     _wantsExit = true;
@@ -182,6 +170,20 @@ void ReplayControls::render()
 
 bool ReplayControls::wantsExit() const { return _wantsExit; }
 
+void ReplayControls::setSeekCallback(SeekCallback callback)
+{
+    _seekCallback = std::move(callback);
+}
+
+void ReplayControls::seek(float seconds)
+{
+    if (_seekCallback) {
+        _seekCallback(seconds);
+    } else {
+        _player.seek(seconds);
+    }
+}
+
 void ReplayControls::updateLayout()
 {
     float windowWidth = static_cast<float>(_window.getWidth());
@@ -229,13 +231,35 @@ void ReplayControls::setupButtons()
     }
 }
 
+void ReplayControls::cycleSpeed()
+{
+    switch (_player.getSpeed()) {
+        case PlaybackSpeed::Half:
+            _player.setSpeed(PlaybackSpeed::Normal);
+            break;
+        case PlaybackSpeed::Normal:
+            _player.setSpeed(PlaybackSpeed::Double);
+            break;
+        case PlaybackSpeed::Double:
+            _player.setSpeed(PlaybackSpeed::Quadruple);
+            break;
+        case PlaybackSpeed::Quadruple:
+            _player.setSpeed(PlaybackSpeed::Octuple);
+            break;
+        case PlaybackSpeed::Octuple:
+            _player.setSpeed(PlaybackSpeed::Sixteenfold);
+            break;
+        default:
+            _player.setSpeed(PlaybackSpeed::Half);
+            break;
+    }
+}
+
 std::string ReplayControls::getSpeedLabel() const
 {
     float speed = _player.getSpeedMultiplier();
     if (speed == 0.5f) return "0.5x";
-    if (speed == 1.0f) return "1x";
-    if (speed == 2.0f) return "2x";
-    return "1x";
+    return std::to_string(static_cast<int>(speed)) + "x";
 }
 
 std::string ReplayControls::formatTime(uint64_t milliseconds) const
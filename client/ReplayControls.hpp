@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
 
 #include "Button.hpp"
@@ -24,12 +25,14 @@ namespace rtype {
  * - Play/Pause
  * - Seek backward 10s
  * - Seek forward 10s
- * - Speed control (0.5x, 1x, 2x)
+ * - Speed control (0.5x, 1x, 2x, 4x, 8x, 16x)
  * - Progress bar
  * - Exit to menu
  */
 class ReplayControls {
    public:
+    using SeekCallback = std::function<void(float seconds)>;
+
     /**
      * @brief Construct replay controls
      */
@@ -51,6 +54,11 @@ class ReplayControls {
      */
     bool wantsExit() const;
 
+    /**
+     * @brief Handle the seek buttons instead of calling ReplayPlayer::seek
+     */
+    void setSeekCallback(SeekCallback callback);
+
     /**
      * @brief Update layout when window resizes
      */
@@ -61,6 +69,7 @@ class ReplayControls {
     GraphicsSFML& _graphics;
     InputSFML& _input;
     ReplayPlayer& _player;
+    SeekCallback _seekCallback;
 
     std::vector<Button> _buttons;
     bool _wantsExit;
@@ -87,6 +96,8 @@ class ReplayControls {
     static constexpr unsigned int FONT_SIZE = 18;
 
     void setupButtons();
+    void cycleSpeed();
+    void seek(float seconds);
     std::string getSpeedLabel() const;
     std::string formatTime(uint64_t milliseconds) const;
     void renderProgressBar();
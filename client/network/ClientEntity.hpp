@@ -0,0 +1,74 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type
+** File description:
+** ClientEntity
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "../wrapper/graphics/SpriteSFML.hpp"
+#include "EntityVisual.hpp"
+#include "SnapshotBuffer.hpp"
+
+namespace rtype {
+
+/**
+ * @brief Represents a game entity on the client side
+ */
+struct ClientEntity {
+    uint32_t id;
+    uint8_t type;
+    float x, y;
+    float lastY = 0;
+    float velocityX = 0.0f;
+    float velocityY = 0.0f;
+    float health = 100.0f;
+    float maxHealth = 100.0f;
+    std::unique_ptr<SpriteSFML> sprite;
+    std::unique_ptr<SpriteSFML> shieldSprite;
+    float spriteScale = 1.0f;
+    float verticalIdleTime = 0.0f;
+    bool isLocalPlayer = false;
+    bool hasShield = false;
+    bool hasSpeedBoost = false;
+    float speedBoostTimer = 0.0f;
+    std::vector<std::unique_ptr<SpriteSFML>> speedArrowSprites;
+
+    enum class AnimationState { IDLE, MOVING_DOWN, MOVING_UP };
+    AnimationState animState = AnimationState::IDLE;
+    int animFrameCount = 0;
+    int animCurrentFrame = 0;
+    float animFrameTime = 0.0f;
+    float animFrameDuration = 0.0f;
+    int animFrameWidth = 0;
+    int animFrameHeight = 0;
+    AnimationPlayback animPlayback = AnimationPlayback::STATIC;
+    bool animRowPerState = false;
+    bool hasTriggeredEffect = false;
+    bool confirmed = true;  ///< Spawned since the last spectator snapshot
+
+    bool isLaser = false;
+    float laserTargetWidth = 400.0f;
+    float laserCurrentWidth = 1.0f;
+    float laserGrowthRate = 800.0f;
+    bool laserFullyGrown = false;
+
+    SnapshotBuffer snapshots;  ///< Received positions, for interpolation
+
+    /**
+     * @brief Construct an entity without sprites (ClientEntityStore hands
+     * out pooled ones)
+     */
+    ClientEntity(uint32_t entityId = 0, uint8_t entityType = 0,
+                 float posX = 0.0f, float posY = 0.0f)
+        : id(entityId), type(entityType), x(posX), y(posY)
+    {
+    }
+};
+
+}  // namespace rtype
@@ -0,0 +1,121 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type
+** File description:
+** ClientEntityStore
+*/
+
+#include "ClientEntityStore.hpp"
+
+#include <algorithm>
+
+namespace rtype {
+
+ClientEntity* ClientEntityStore::create(uint32_t id, uint8_t type, float x,
+                                        float y)
+{
+    if (_indexById.find(id) != _indexById.end()) {
+        return nullptr;
+    }
+
+    ClientEntity* entity;
+    if (!_freeSlots.empty()) {
+        entity = _freeSlots.back();
+        _freeSlots.pop_back();
+
+        // Reset every field but keep the slot's sprite object
+        auto sprite = std::move(entity->sprite);
+        *entity = ClientEntity(id, type, x, y);
+        entity->sprite = std::move(sprite);
+        entity->sprite->reset();
+    } else {
+        _slots.push_back(std::make_unique<ClientEntity>(id, type, x, y));
+        entity = _slots.back().get();
+        entity->sprite = std::make_unique<SpriteSFML>();
+    }
+
+    _indexById[id] = _ids.size();
+    _ids.push_back(id);
+    _types.push_back(type);
+    _entities.push_back(entity);
+    return entity;
+}
+
+void ClientEntityStore::destroy(uint32_t id)
+{
+    auto it = _indexById.find(id);
+    if (it == _indexById.end()) {
+        return;
+    }
+
+    size_t index = it->second;
+    ClientEntity* entity = _entities[index];
+    _indexById.erase(it);
+
+    if (entity->shieldSprite) {
+        releaseSprite(std::move(entity->shieldSprite));
+    }
+    releaseSpeedArrows(*entity);
+    _freeSlots.push_back(entity);
+
+    size_t last = _ids.size() - 1;
+    if (index != last) {
+        _ids[index] = _ids[last];
+        _types[index] = _types[last];
+        _entities[index] = _entities[last];
+        _indexById[_ids[index]] = index;
+    }
+    _ids.pop_back();
+    _types.pop_back();
+    _entities.pop_back();
+}
+
+void ClientEntityStore::clear()
+{
+    while (!_ids.empty()) {
+        destroy(_ids.back());
+    }
+}
+
+ClientEntity* ClientEntityStore::find(uint32_t id) const
+{
+    auto it = _indexById.find(id);
+    return it != _indexById.end() ? _entities[it->second] : nullptr;
+}
+
+ClientEntity* ClientEntityStore::findFirstOfType(
+    std::initializer_list<uint8_t> types) const
+{
+    for (size_t i = 0; i < _types.size(); ++i) {
+        if (std::find(types.begin(), types.end(), _types[i]) != types.end()) {
+            return _entities[i];
+        }
+    }
+    return nullptr;
+}
+
+std::unique_ptr<SpriteSFML> ClientEntityStore::acquireSprite()
+{
+    if (_freeSprites.empty()) {
+        return std::make_unique<SpriteSFML>();
+    }
+    auto sprite = std::move(_freeSprites.back());
+    _freeSprites.pop_back();
+    sprite->reset();
+    return sprite;
+}
+
+void ClientEntityStore::releaseSprite(std::unique_ptr<SpriteSFML> sprite)
+{
+    _freeSprites.push_back(std::move(sprite));
+}
+
+void ClientEntityStore::releaseSpeedArrows(ClientEntity& entity)
+{
+    for (auto& arrow : entity.speedArrowSprites) {
+        releaseSprite(std::move(arrow));
+    }
+    entity.speedArrowSprites.clear();
+}
+
+}  // namespace rtype
@@ -0,0 +1,129 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type
+** File description:
+** ClientEntityStore
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "ClientEntity.hpp"
+
+namespace rtype {
+
+/**
+ * @brief Pooled storage of the client's entities
+ *
+ * Entities live in slots that are never freed: a destroyed entity's slot
+ * (and its main sprite) go to a free list and are reset for the next spawn,
+ * so the constant churn of bullets and explosions does not allocate. Shield
+ * and speed-arrow sprites are recycled through a shared sprite pool.
+ *
+ * Live entities are packed in dense parallel arrays (ids, types, entity
+ * pointers) kept contiguous by swap-removal, so per-frame loops and type
+ * scans walk plain vectors instead of hash map nodes. Iteration order is
+ * not stable across removals.
+ */
+class ClientEntityStore {
+   public:
+    /**
+     * @brief Value yielded when iterating, usable with structured bindings
+     */
+    struct Entry {
+        uint32_t id;
+        ClientEntity* entity;
+    };
+
+    class Iterator {
+       public:
+        Iterator(const ClientEntityStore& store, size_t index)
+            : _store(store), _index(index)
+        {
+        }
+
+        Entry operator*() const
+        {
+            return {_store._ids[_index], _store._entities[_index]};
+        }
+        Iterator& operator++()
+        {
+            ++_index;
+            return *this;
+        }
+        bool operator!=(const Iterator& other) const
+        {
+            return _index != other._index;
+        }
+
+       private:
+        const ClientEntityStore& _store;
+        size_t _index;
+    };
+
+    ClientEntityStore() = default;
+    ClientEntityStore(const ClientEntityStore&) = delete;
+    ClientEntityStore& operator=(const ClientEntityStore&) = delete;
+
+    /**
+     * @brief Spawn an entity in a recycled slot
+     * @return The new entity with a blank sprite, nullptr if the ID exists
+     */
+    ClientEntity* create(uint32_t id, uint8_t type, float x, float y);
+
+    /**
+     * @brief Remove an entity, returning its slot and sprites to the pools
+     */
+    void destroy(uint32_t id);
+
+    /**
+     * @brief Remove every entity (slots are kept for reuse)
+     */
+    void clear();
+
+    ClientEntity* find(uint32_t id) const;
+    size_t size() const { return _ids.size(); }
+
+    /**
+     * @brief Get the first live entity of one of the given types
+     * @return nullptr if there is none
+     */
+    ClientEntity* findFirstOfType(std::initializer_list<uint8_t> types) const;
+
+    /**
+     * @brief Get a blank sprite from the pool
+     */
+    std::unique_ptr<SpriteSFML> acquireSprite();
+
+    /**
+     * @brief Give a sprite back to the pool
+     */
+    void releaseSprite(std::unique_ptr<SpriteSFML> sprite);
+
+    /**
+     * @brief Return every speed-arrow sprite of an entity to the pool
+     */
+    void releaseSpeedArrows(ClientEntity& entity);
+
+    Iterator begin() const { return Iterator(*this, 0); }
+    Iterator end() const { return Iterator(*this, _ids.size()); }
+
+   private:
+    // Dense arrays of live entities, same index in each
+    std::vector<uint32_t> _ids;
+    std::vector<uint8_t> _types;
+    std::vector<ClientEntity*> _entities;
+    std::unordered_map<uint32_t, size_t> _indexById;
+
+    std::vector<std::unique_ptr<ClientEntity>> _slots;  ///< Owns all slots
+    std::vector<ClientEntity*> _freeSlots;
+    std::vector<std::unique_ptr<SpriteSFML>> _freeSprites;
+};
+
+}  // namespace rtype
@@ -7,13 +7,216 @@
 
 #include "ClientGameState.hpp"
 
+#include <algorithm>
+#include <array>
 #include <iostream>
 #include <span>
+#include <vector>
 
 #include "../src/SoundManager.hpp"
+#include "../wrapper/graphics/TextureCacheSFML.hpp"
+#include "common/network/EntityType.hpp"
+#include "common/network/PlayerMovement.hpp"
 
 namespace rtype {
 
+namespace {
+
+/** @brief Explosion effect, spawned by the server but not a gameplay type */
+constexpr uint8_t EXPLOSION_TYPE = 7;
+
+constexpr EntityAnimation makeAnimation(
+    int frameCount, int frameWidth, int frameHeight, float frameDuration,
+    AnimationPlayback playback = AnimationPlayback::STATIC,
+    bool rowPerState = false)
+{
+    EntityAnimation animation;
+    animation.frameCount = frameCount;
+    animation.frameWidth = frameWidth;
+    animation.frameHeight = frameHeight;
+    animation.frameDuration = frameDuration;
+    animation.playback = playback;
+    animation.rowPerState = rowPerState;
+    return animation;
+}
+
+EntityVisual makeVisual(std::span<const std::byte> texture, float scale,
+                        const EntityAnimation& animation = {})
+{
+    EntityVisual visual;
+    visual.texture = texture;
+    visual.scale = scale;
+    visual.animation = animation;
+    return visual;
+}
+
+EntityVisual withFallback(EntityVisual visual,
+                          std::span<const std::byte> texture, float scale)
+{
+    visual.fallbackTexture = texture;
+    visual.fallbackScale = scale;
+    return visual;
+}
+
+EntityVisual withOrigin(EntityVisual visual, float x, float y)
+{
+    visual.originX = x;
+    visual.originY = y;
+    return visual;
+}
+
+constexpr EntityAnimation BULLET_ANIMATION =
+    makeAnimation(4, 14, 10, 0.1f, AnimationPlayback::LOOP);
+constexpr EntityAnimation ORBITER_ANIMATION =
+    makeAnimation(2, 24, 26, 0.15f, AnimationPlayback::LOOP);
+constexpr EntityAnimation GLANDUS_ANIMATION =
+    makeAnimation(2, 27, 22, 0.15f, AnimationPlayback::LOOP);
+
+/**
+ * @brief Sprite and animation of each entity type, indexed by type
+ *
+ * Entries without a texture use getDefaultVisual(). Sheets marked STATIC
+ * only show their first frame.
+ */
+const std::array<EntityVisual, 256>& getVisualTable()
+{
+    static const std::array<EntityVisual, 256> table = [] {
+        std::array<EntityVisual, 256> visuals{};
+        const auto playerMissile =
+            ASSET_SPAN(embedded::projectile_player_1_data);
+        const auto enemyMissile = ASSET_SPAN(embedded::projectile_enemy_1_data);
+        const auto pinkBullet = ASSET_SPAN(embedded::small_pink_bullet_data);
+        const auto itemFallback = ASSET_SPAN(embedded::boss_3_data);
+
+        visuals[EntityType::PLAYER_MISSILE] = makeVisual(playerMissile, 6.0f);
+        visuals[4] = makeVisual(enemyMissile, 6.0f);
+        visuals[EntityType::BOSS] = withFallback(
+            makeVisual(ASSET_SPAN(embedded::boss_1_data), 2.5f,
+                       makeAnimation(5, 48, 48, 0.15f)),
+            ASSET_SPAN(embedded::boss_2_data), 2.0f);
+        visuals[EntityType::BOSS_DUO] = withFallback(
+            makeVisual(ASSET_SPAN(embedded::boss_1_data), 1.8f,
+                       makeAnimation(5, 48, 48, 0.12f)),
+            ASSET_SPAN(embedded::boss_2_data), 1.5f);
+        visuals[8] = withFallback(
+            makeVisual(ASSET_SPAN(embedded::shield_item_data), 0.8f),
+            itemFallback, 0.5f);
+        visuals[9] = withFallback(
+            makeVisual(ASSET_SPAN(embedded::search_missile_item_data), 0.8f),
+            playerMissile, 0.5f);
+        visuals[EntityType::BASIC] =
+            makeVisual(ASSET_SPAN(embedded::regular_data), 2.2f,
+                       makeAnimation(3, 37, 26, 0.15f));
+        visuals[EntityType::BASIC_MISSILE] = makeVisual(enemyMissile, 5.0f);
+        visuals[EntityType::TANK] =
+            makeVisual(ASSET_SPAN(embedded::boss_4_data), 1.5f,
+                       makeAnimation(3, 65, 50, 0.15f));
+        visuals[EntityType::TANK_MISSILE] = makeVisual(enemyMissile, 3.0f);
+        visuals[EntityType::FAST] =
+            makeVisual(ASSET_SPAN(embedded::boss_3_data), 0.8f);
+        visuals[EntityType::FAST_MISSILE] = makeVisual(enemyMissile, 5.0f);
+        visuals[EntityType::TURRET] =
+            makeVisual(ASSET_SPAN(embedded::enemy_turret_data), 3.0f);
+        visuals[EntityType::TURRET_MISSILE] =
+            makeVisual(pinkBullet, 3.0f, BULLET_ANIMATION);
+        visuals[EntityType::ORBITER] = makeVisual(
+            ASSET_SPAN(embedded::orbiter_data), 2.0f, ORBITER_ANIMATION);
+        visuals[EntityType::ORBITER_MISSILE] =
+            makeVisual(pinkBullet, 2.5f, BULLET_ANIMATION);
+        visuals[EntityType::LASER_SHIP] =
+            makeVisual(ASSET_SPAN(embedded::laser_shooter_data), 3.0f);
+        visuals[EntityType::LASER] = withOrigin(
+            makeVisual(ASSET_SPAN(embedded::laser_data), 6.0f), 320.0f, 2.0f);
+        visuals[EntityType::GUIDED_MISSILE] = withFallback(
+            makeVisual(ASSET_SPAN(embedded::search_missile_data), 4.0f),
+            playerMissile, 5.0f);
+        visuals[EntityType::GLANDUS] = makeVisual(
+            ASSET_SPAN(embedded::glandus_data), 2.5f, GLANDUS_ANIMATION);
+        visuals[EntityType::GLANDUS_MINI] = makeVisual(
+            ASSET_SPAN(embedded::glandus_mini_data), 2.0f, GLANDUS_ANIMATION);
+        visuals[25] = withFallback(
+            makeVisual(ASSET_SPAN(embedded::speed_item_data), 0.8f),
+            itemFallback, 0.5f);
+        visuals[30] = withOrigin(
+            makeVisual(ASSET_SPAN(embedded::boss_4_data), 3.0f,
+                       makeAnimation(4, 48, 48, 0.15f)),
+            24.0f, 24.0f);
+        visuals[31] = makeVisual(ASSET_SPAN(embedded::orbiter_data), 1.5f,
+                                 makeAnimation(2, 24, 26, 0.15f));
+        visuals[EntityType::GREEN_BULLET] =
+            makeVisual(ASSET_SPAN(embedded::small_green_bullet_data), 3.0f,
+                       makeAnimation(4, 14, 10, 0.1f));
+        visuals[34] = withOrigin(
+            makeVisual(ASSET_SPAN(embedded::boss_2_data), 2.5f,
+                       makeAnimation(1, 130, 50, 1.0f)),
+            65.0f, 25.0f);
+        visuals[35] = makeVisual(ASSET_SPAN(embedded::turret_data), 2.0f,
+                                 makeAnimation(1, 32, 23, 1.0f));
+        return visuals;
+    }();
+    return table;
+}
+
+const EntityVisual& getDefaultVisual(uint8_t type)
+{
+    static const EntityVisual enemy =
+        makeVisual(ASSET_SPAN(embedded::boss_3_data), 1.0f);
+    static const EntityVisual other =
+        makeVisual(ASSET_SPAN(embedded::player_1_data), 2.0f);
+    return type >= 10 ? enemy : other;
+}
+
+const EntityVisual& getEntityVisual(uint8_t type)
+{
+    const EntityVisual& visual = getVisualTable()[type];
+    return visual.texture.empty() ? getDefaultVisual(type) : visual;
+}
+
+/**
+ * @brief Get the ship of a player, one of four colors picked by ID
+ */
+const EntityVisual& getPlayerVisual(uint32_t entityId)
+{
+    static constexpr EntityAnimation animation =
+        makeAnimation(3, 35, 21, 0.15f, AnimationPlayback::LOOP, true);
+    static const std::array<EntityVisual, 4> players = {
+        makeVisual(ASSET_SPAN(embedded::player_1_data), 4.0f, animation),
+        makeVisual(ASSET_SPAN(embedded::player_2_data), 4.0f, animation),
+        makeVisual(ASSET_SPAN(embedded::player_3_data), 4.0f, animation),
+        makeVisual(ASSET_SPAN(embedded::player_4_data), 4.0f, animation),
+    };
+    return players[entityId % 4];
+}
+
+/**
+ * @brief Decode every image the visual tables and the effects may need
+ * before the match, so a spawn burst never waits on PNG decoding
+ */
+void preloadEntityTextures()
+{
+    std::vector<std::span<const std::byte>> images = {
+        ASSET_SPAN(embedded::shield_data),
+        ASSET_SPAN(embedded::speed_arrow_data),
+    };
+    auto add = [&images](const EntityVisual& visual) {
+        for (auto image : {visual.texture, visual.fallbackTexture}) {
+            if (!image.empty()) {
+                images.push_back(image);
+            }
+        }
+    };
+
+    for (const EntityVisual& visual : getVisualTable()) {
+        add(visual);
+    }
+    for (uint32_t i = 0; i < 4; ++i) {
+        add(getPlayerVisual(i));
+    }
+    TextureCacheSFML::getInstance().preload(images);
+}
+
+}  // namespace
+
 ClientGameState::ClientGameState()
     : _networkClient(std::make_unique<NetworkClientAsio>())
 {
@@ -83,8 +286,13 @@ ClientGameState::ClientGameState()
             onGameEvent(packet.eventType, packet.waveNumber, packet.totalWaves,
                         packet.levelId);
         });
+    _networkClient->setOnInputAckCallback([this](const InputAckPacket& packet) {
+        onInputAck(packet.inputSequenceId, packet.x, packet.y);
+    });
     _networkClient->setOnErrorCallback(
         [this](const std::string& error) { onError(error); });
+
+    preloadEntityTextures();
 }
 
 bool ClientGameState::connectToServer(const std::string& address, uint16_t port)
@@ -104,7 +312,7 @@ bool ClientGameState::connectToServer(const std::string& address, uint16_t port)
     }
 }
 
-bool ClientGameState::sendLogin(const std::string& username)
+bool ClientGameState::sendLogin(const std::string& username, uint16_t roomId)
 {
     if (!isConnected()) {
         _lastError = "Not connected to server";
@@ -116,7 +324,7 @@ bool ClientGameState::sendLogin(const std::string& username)
         return false;
     }
 
-    bool result = _networkClient->sendLogin(username);
+    bool result = _networkClient->sendLogin(username, roomId);
 
     if (!result) {
         _lastError = "Failed to send login packet";
@@ -136,6 +344,7 @@ void ClientGameState::disconnect()
     _connectionAttempting = false;
     _levelCompleted = false;
     _entities.clear();
+    resetPrediction();
 }
 
 bool ClientGameState::isConnected() const
@@ -145,6 +354,8 @@ bool ClientGameState::isConnected() const
 
 void ClientGameState::update(float deltaTime)
 {
+    _clientTime += deltaTime;
+
     if (_connectionAttempting && !isConnected()) {
         _connectionTimeout += deltaTime;
         if (_connectionTimeout > MAX_CONNECTION_TIMEOUT) {
@@ -157,6 +368,10 @@ void ClientGameState::update(float deltaTime)
         _networkClient->update();
     }
 
+    if (_recorder && _gameStarted && _recorder->isKeyframeDue()) {
+        _recorder->recordKeyframe(buildReplayKeyframe());
+    }
+
     if (_gameEventTimer > 0.0f) {
         _gameEventTimer -= deltaTime;
         if (_gameEventTimer <= 0.0f) {
@@ -164,77 +379,30 @@ void ClientGameState::update(float deltaTime)
         }
     }
 
-    for (auto& [entityId, entity] : _entities) {
-        if (entity->type == 3 && entity->velocityX != 0.0f) {
-            entity->x += entity->velocityX * deltaTime;
+    const float renderTime = _clientTime - _interpolationDelay;
+    for (const auto& [entityId, entity] : _entities) {
+        if (isInterpolated(*entity)) {
+            entity->snapshots.sample(renderTime, _interpolationMode,
+                                     MAX_EXTRAPOLATION, entity->x, entity->y);
         }
 
         if (entity->hasSpeedBoost) {
             entity->speedBoostTimer -= deltaTime;
             if (entity->speedBoostTimer <= 0.0f) {
                 entity->hasSpeedBoost = false;
-                entity->speedArrowSprites.clear();
+                _entities.releaseSpeedArrows(*entity);
             }
         }
 
-        if (entity->type == 1 && entity->animFrameCount > 0) {
-            entity->animFrameTime += deltaTime;
-            if (entity->animFrameTime >= entity->animFrameDuration) {
-                entity->animFrameTime = 0.0f;
-                entity->animCurrentFrame++;
-                if (entity->animCurrentFrame >= entity->animFrameCount) {
-                    entity->animCurrentFrame = 0;
-                }
-                int row = static_cast<int>(entity->animState);
-                int frameX = entity->animCurrentFrame * entity->animFrameWidth;
-                int frameY = row * entity->animFrameHeight;
-                entity->sprite->setTextureRect(frameX, frameY,
-                                               entity->animFrameWidth,
-                                               entity->animFrameHeight);
-            }
-        }
-
-        if ((entity->type == 9 || entity->type == 25) &&
-            entity->animFrameCount > 0) {
-            entity->animFrameTime += deltaTime;
-            if (entity->animFrameTime >= entity->animFrameDuration) {
-                entity->animFrameTime = 0.0f;
-                entity->animCurrentFrame++;
-                if (entity->animCurrentFrame >= entity->animFrameCount) {
-                    entity->animCurrentFrame = 0;
-                }
-                int frameX = entity->animCurrentFrame * entity->animFrameWidth;
-                entity->sprite->setTextureRect(
-                    frameX, 0, entity->animFrameWidth, entity->animFrameHeight);
-            }
-        }
-
-        if (entity->type == 7 && entity->animFrameCount > 0) {
-            entity->animFrameTime += deltaTime;
-            if (entity->animFrameTime >= entity->animFrameDuration) {
-                entity->animFrameTime = 0.0f;
-                entity->animCurrentFrame++;
-                if (entity->animCurrentFrame >= entity->animFrameCount) {
-                    entity->hasTriggeredEffect = true;
-                } else {
-                    int frameX =
-                        entity->animCurrentFrame * entity->animFrameWidth;
-                    entity->sprite->setTextureRect(frameX, 0,
-                                                   entity->animFrameWidth,
-                                                   entity->animFrameHeight);
-                }
-            }
-        }
-        if ((entity->type == 17 || entity->type == 18 || entity->type == 19 ||
-             entity->type == 23 || entity->type == 24) &&
+        if (entity->animPlayback != AnimationPlayback::STATIC &&
             entity->animFrameCount > 0) {
-            updateSimpleAnimation(*entity, deltaTime);
+            advanceAnimation(*entity, deltaTime);
         }
     }
 
     std::vector<uint32_t> entitiesToRemove;
     for (const auto& [id, entity] : _entities) {
-        if (entity && entity->type == 7 && entity->hasTriggeredEffect &&
+        if (entity->animPlayback == AnimationPlayback::ONE_SHOT &&
             entity->animCurrentFrame >= entity->animFrameCount) {
             entitiesToRemove.push_back(id);
         }
@@ -243,14 +411,7 @@ void ClientGameState::update(float deltaTime)
         removeEntity(id);
     }
 
-    for (auto& explosion : _explosions) {
-        explosion->update(deltaTime);
-    }
-    _explosions.erase(std::remove_if(_explosions.begin(), _explosions.end(),
-                                     [](const std::unique_ptr<Explosion>& exp) {
-                                         return exp->isFinished();
-                                     }),
-                      _explosions.end());
+    _particles.update(deltaTime);
 }
 
 void ClientGameState::render(IGraphics& graphics, float windowScale,
@@ -260,9 +421,7 @@ void ClientGameState::render(IGraphics& graphics, float windowScale,
         return;
     }
 
-    for (auto& explosion : _explosions) {
-        explosion->draw(graphics, windowScale, offsetX, offsetY);
-    }
+    _particles.draw(graphics.getSpriteBatch(), windowScale, offsetX, offsetY);
 }
 
 void ClientGameState::sendInput(uint8_t inputMask)
@@ -271,20 +430,87 @@ void ClientGameState::sendInput(uint8_t inputMask)
         return;
     }
 
-    _networkClient->sendInput(inputMask);
+    uint32_t sequenceId = _networkClient->sendInput(inputMask);
+    if (sequenceId == 0) {
+        return;
+    }
+
+    auto* localPlayer = getLocalPlayer();
+    if (!localPlayer || localPlayer->health <= 0.0f) {
+        return;
+    }
+
+    float speed = localPlayer->hasSpeedBoost ? PlayerMovement::BOOSTED_SPEED
+                                             : PlayerMovement::BASE_SPEED;
+    pushPendingInput({sequenceId, inputMask, speed});
+
+    float x = localPlayer->x;
+    float y = localPlayer->y;
+    PlayerMovement::apply(x, y, inputMask, speed, PlayerMovement::INPUT_STEP);
+    updateMovementAnimation(*localPlayer, y);
+    localPlayer->x = x;
+    localPlayer->y = y;
+}
+
+void ClientGameState::pushPendingInput(const PendingInput& input)
+{
+    if (_pendingInputCount == INPUT_HISTORY_SIZE) {
+        _pendingInputStart = (_pendingInputStart + 1) % INPUT_HISTORY_SIZE;
+        _pendingInputCount--;
+    }
+    size_t end = (_pendingInputStart + _pendingInputCount) % INPUT_HISTORY_SIZE;
+    _pendingInputs[end] = input;
+    _pendingInputCount++;
+}
+
+void ClientGameState::resetPrediction()
+{
+    _pendingInputStart = 0;
+    _pendingInputCount = 0;
+    _lastAckedInput = 0;
+    _serverAcksInputs = false;
+}
+
+void ClientGameState::onInputAck(uint32_t inputSequenceId, float x, float y)
+{
+    if (inputSequenceId <= _lastAckedInput) {
+        return;
+    }
+    _lastAckedInput = inputSequenceId;
+    _serverAcksInputs = true;
+
+    while (_pendingInputCount > 0 &&
+           _pendingInputs[_pendingInputStart].sequenceId <= inputSequenceId) {
+        _pendingInputStart = (_pendingInputStart + 1) % INPUT_HISTORY_SIZE;
+        _pendingInputCount--;
+    }
+
+    auto* localPlayer = getLocalPlayer();
+    if (!localPlayer) {
+        return;
+    }
+
+    // Rewind to the authoritative position and replay what it has not seen
+    for (size_t i = 0; i < _pendingInputCount; ++i) {
+        const auto& input =
+            _pendingInputs[(_pendingInputStart + i) % INPUT_HISTORY_SIZE];
+        PlayerMovement::apply(x, y, input.inputMask, input.speed,
+                              PlayerMovement::INPUT_STEP);
+    }
+    localPlayer->x = x;
+    localPlayer->y = y;
 }
 
 ClientEntity* ClientGameState::getEntity(uint32_t entityId)
 {
-    auto it = _entities.find(entityId);
-    return (it != _entities.end()) ? it->second.get() : nullptr;
+    return _entities.find(entityId);
 }
 
 ClientEntity* ClientGameState::getLocalPlayer()
 {
     for (const auto& [entityId, entity] : _entities) {
         if (entity->isLocalPlayer) {
-            return entity.get();
+            return entity;
         }
     }
     return nullptr;
@@ -307,6 +533,15 @@ void ClientGameState::onDisconnected()
 void ClientGameState::onLoginResponse(uint32_t playerId, uint16_t mapWidth,
                                       uint16_t mapHeight)
 {
+    if (playerId == 0) {
+        dropUnconfirmedEntities();
+
+        // Spectators get the login again with every resync snapshot
+        if (_gameStarted && _playerId == 0) {
+            return;
+        }
+    }
+
     std::cout << "[ClientGameState] onLoginResponse - Old playerId: "
               << _playerId << ", New playerId: " << playerId
               << ", Entities count: " << _entities.size() << std::endl;
@@ -315,10 +550,11 @@ void ClientGameState::onLoginResponse(uint32_t playerId, uint16_t mapWidth,
     _mapWidth = mapWidth;
     _mapHeight = mapHeight;
     _gameStarted = true;
+    resetPrediction();
     _levelCompleted = false;
     _loginRejected = false;
 
-    for (auto& [id, entity] : _entities) {
+    for (const auto& [id, entity] : _entities) {
         if (entity && entity->type == 1) {
             bool wasLocalPlayer = entity->isLocalPlayer;
             if (entity->isLocalPlayer && !wasLocalPlayer) {
@@ -352,11 +588,22 @@ void ClientGameState::onLoginRejected(uint8_t reason)
 void ClientGameState::onEntitySpawn(uint32_t entityId, uint8_t type, float x,
                                     float y)
 {
-    if (_entities.find(entityId) != _entities.end()) {
+    if (type == EXPLOSION_TYPE) {
+        // Boss death blasts are only an effect: no entity is kept for them
+        if (!_isSeeking) {
+            _particles.emit(ParticleSystem::Effect::BOSS_EXPLOSION, x, y);
+            _screenShakePending = true;
+        }
         return;
     }
 
-    auto entity = std::make_unique<ClientEntity>(entityId, type, x, y);
+    ClientEntity* entity = _entities.create(entityId, type, x, y);
+    if (!entity) {
+        if (ClientEntity* alive = getEntity(entityId)) {
+            alive->confirmed = true;
+        }
+        return;
+    }
 
     if (type == 1) {
         entity->isLocalPlayer = (entityId == _playerId);
@@ -367,18 +614,24 @@ void ClientGameState::onEntitySpawn(uint32_t entityId, uint8_t type, float x,
         }
         entity->hasSpeedBoost = false;
         entity->speedBoostTimer = 0.0f;
-        entity->speedArrowSprites.clear();
+
+        uint8_t playerCount = 0;
+        for (const auto& [otherId, other] : _entities) {
+            if (other->type == EntityType::PLAYER) {
+                playerCount++;
+            }
+        }
+        _peakPlayerCount = std::max(_peakPlayerCount, playerCount);
     } else {
         entity->isLocalPlayer = false;
     }
 
-    if (type == 2) {
+    if (type == 2 && !_isSeeking) {
         SoundManager::getInstance().playRandomShot();
     }
 
     createEntitySprite(*entity);
-
-    _entities[entityId] = std::move(entity);
+    entity->snapshots.push(_clientTime, x, y);
 }
 
 void ClientGameState::onEntityPosition(uint32_t entityId, float x, float y)
@@ -388,25 +641,56 @@ void ClientGameState::onEntityPosition(uint32_t entityId, float x, float y)
         return;
     }
 
-    if (entity->type == 1 && entity->animFrameCount > 0) {
-        float deltaY = y - entity->lastY;
-        if (deltaY < -0.5f) {
-            entity->animState = ClientEntity::AnimationState::MOVING_UP;
-        } else if (deltaY > 0.5f) {
-            entity->animState = ClientEntity::AnimationState::MOVING_DOWN;
-        } else {
-            entity->animState = ClientEntity::AnimationState::IDLE;
-        }
-        entity->lastY = y;
-        int row = static_cast<int>(entity->animState);
-        int frameX = entity->animCurrentFrame * entity->animFrameWidth;
-        int frameY = row * entity->animFrameHeight;
-        entity->sprite->setTextureRect(frameX, frameY, entity->animFrameWidth,
-                                       entity->animFrameHeight);
+    // The predicted position wins while the server still has inputs to ack
+    if (entity->isLocalPlayer && _serverAcksInputs && _pendingInputCount > 0) {
+        return;
+    }
+
+    updateMovementAnimation(*entity, y);
+
+    if (!isInterpolated(*entity) || _isSeeking) {
+        // Fast-forwarding replays skip time, so history would be meaningless
+        entity->snapshots.clear();
+        entity->x = x;
+        entity->y = y;
     }
+    entity->snapshots.push(_clientTime, x, y);
+}
 
-    entity->x = x;
-    entity->y = y;
+void ClientGameState::setInterpolation(float delaySeconds,
+                                       InterpolationMode mode)
+{
+    _interpolationDelay = delaySeconds > 0.0f ? delaySeconds : 0.0f;
+    _interpolationMode = mode;
+}
+
+bool ClientGameState::isInterpolated(const ClientEntity& entity) const
+{
+    // The local ship is predicted while playing; replays interpolate it too
+    return _interpolationDelay > 0.0f &&
+           !(entity.isLocalPlayer && isConnected());
+}
+
+void ClientGameState::updateMovementAnimation(ClientEntity& entity, float newY)
+{
+    if (!entity.animRowPerState || entity.animFrameCount <= 0) {
+        return;
+    }
+
+    float deltaY = newY - entity.lastY;
+    if (deltaY < -0.5f) {
+        entity.animState = ClientEntity::AnimationState::MOVING_UP;
+    } else if (deltaY > 0.5f) {
+        entity.animState = ClientEntity::AnimationState::MOVING_DOWN;
+    } else {
+        entity.animState = ClientEntity::AnimationState::IDLE;
+    }
+    entity.lastY = newY;
+    int row = static_cast<int>(entity.animState);
+    int frameX = entity.animCurrentFrame * entity.animFrameWidth;
+    int frameY = row * entity.animFrameHeight;
+    entity.sprite->setTextureRect(frameX, frameY, entity.animFrameWidth,
+                                  entity.animFrameHeight);
 }
 
 void ClientGameState::onEntityDead(uint32_t entityId)
@@ -419,16 +703,7 @@ void ClientGameState::onEntityDead(uint32_t entityId)
                 localPlayer->hasSpeedBoost = true;
                 localPlayer->speedBoostTimer = 5.0f;
 
-                localPlayer->speedArrowSprites.clear();
-                for (int i = 0; i < 3; ++i) {
-                    auto arrow = std::make_unique<SpriteSFML>();
-                    if (arrow->loadTexture(
-                            ASSET_SPAN(embedded::speed_arrow_data))) {
-                        arrow->setScale(0.80f, 0.80f);
-                        localPlayer->speedArrowSprites.push_back(
-                            std::move(arrow));
-                    }
-                }
+                attachSpeedArrows(*localPlayer);
                 SoundManager::getInstance().playSound("powerup");
             }
         } else if (entity->type == 8 || entity->type == 9) {
@@ -444,16 +719,16 @@ void ClientGameState::onEntityDead(uint32_t entityId)
                 case 25:
                 case 19:
                 case 32:
-                    _explosions.push_back(std::make_unique<Explosion>(
-                        ASSET_SPAN(embedded::blowup_1_data),
+                    _particles.emit(
+                        ParticleSystem::Effect::SMALL_EXPLOSION,
                         (entity->type == 4) ? entity->x - 16 : entity->x + 16,
-                        entity->y, 1.0f, 32, 32, 6));
+                        entity->y);
                     break;
                 default:
                     if (entity->type >= 10 || entity->type == 5) {
-                        _explosions.push_back(std::make_unique<Explosion>(
-                            ASSET_SPAN(embedded::blowup_2_data), entity->x,
-                            entity->y, 2.0f, 64, 64, 8));
+                        _particles.emit(
+                            ParticleSystem::Effect::LARGE_EXPLOSION, entity->x,
+                            entity->y);
                     }
                     break;
             }
@@ -483,8 +758,12 @@ void ClientGameState::onShieldStatus(uint32_t playerId, bool hasShield)
 
 void ClientGameState::onGameEvent(uint8_t eventType, uint8_t waveNumber,
                                   [[maybe_unused]] uint8_t totalWaves,
-                                  [[maybe_unused]] uint8_t levelId)
+                                  uint8_t levelId)
 {
+    if (levelId != 0) {
+        _level = levelId;
+    }
+
     if (eventType == GameEventType::GAME_EVENT_WAVE_START) {
         if (_levelCompleted) {
             _levelCompleted = false;
@@ -514,455 +793,82 @@ void ClientGameState::createEntitySprite(ClientEntity& entity)
         return;
     }
 
-    float scale = 1.0f;
-
     switch (entity.type) {
-        case 1: {
-            int playerIdx = (entity.id % 4) + 1;
-            scale = 4.0f;
-            std::span<const std::byte> playerData;
-            switch (playerIdx) {
-                case 1:
-                    playerData = ASSET_SPAN(embedded::player_1_data);
-                    break;
-                case 2:
-                    playerData = ASSET_SPAN(embedded::player_2_data);
-                    break;
-                case 3:
-                    playerData = ASSET_SPAN(embedded::player_3_data);
-                    break;
-                default:
-                    playerData = ASSET_SPAN(embedded::player_4_data);
-                    break;
-            }
-            if (entity.sprite->loadTexture(playerData)) {
-                entity.sprite->setScale(scale, scale);
-
-                entity.animFrameCount = 3;
-                entity.animCurrentFrame = 0;
-                entity.animFrameTime = 0.0f;
-                entity.animFrameDuration = 0.15f;
-                entity.animFrameWidth = 35;
-                entity.animFrameHeight = 21;
-                entity.animState = ClientEntity::AnimationState::IDLE;
-                entity.sprite->setTextureRect(0, 0, 35, 21);
-            }
-            entity.spriteScale = scale;
-            entity.shieldSprite = std::make_unique<SpriteSFML>();
+        case EntityType::PLAYER:
+            applyVisual(entity, getPlayerVisual(entity.id));
+            entity.shieldSprite = _entities.acquireSprite();
             if (entity.shieldSprite->loadTexture(
                     ASSET_SPAN(embedded::shield_data))) {
                 float shieldScale = 0.3f;
                 entity.shieldSprite->setScale(shieldScale, shieldScale);
             }
             break;
-        }
-        case 2: {
-            scale = 6.0f;
-            if (entity.sprite->loadTexture(
-                    ASSET_SPAN(embedded::projectile_player_1_data))) {
-                entity.sprite->setScale(scale, scale);
-            }
-            entity.spriteScale = scale;
-            break;
-        }
-        case 4: {
-            scale = 6.0f;
-            if (entity.sprite->loadTexture(
-                    ASSET_SPAN(embedded::projectile_enemy_1_data))) {
-                entity.sprite->setScale(scale, scale);
-            }
-            entity.spriteScale = scale;
-            break;
-        }
-        case 5: {
-            scale = 2.5f;
-            if (!entity.sprite->loadTexture(
-                    ASSET_SPAN(embedded::boss_1_data))) {
-                scale = 2.0f;
-                entity.sprite->loadTexture(ASSET_SPAN(embedded::boss_2_data));
-            }
-            entity.sprite->setScale(scale, scale);
-            entity.spriteScale = scale;
-
-            entity.animFrameCount = 5;
-            entity.animFrameWidth = 48;
-            entity.animFrameHeight = 48;
-            entity.animFrameDuration = 0.15f;
-            entity.animCurrentFrame = 0;
-            entity.animFrameTime = 0.0f;
-            entity.sprite->setTextureRect(0, 0, entity.animFrameWidth,
-                                          entity.animFrameHeight);
-            break;
-        }
-        case 6: {
-            scale = 1.8f;
-            if (!entity.sprite->loadTexture(
-                    ASSET_SPAN(embedded::boss_1_data))) {
-                scale = 1.5f;
-                entity.sprite->loadTexture(ASSET_SPAN(embedded::boss_2_data));
-            }
-            entity.sprite->setScale(scale, scale);
-            entity.spriteScale = scale;
-
-            entity.animFrameCount = 5;
-            entity.animFrameWidth = 48;
-            entity.animFrameHeight = 48;
-            entity.animFrameDuration = 0.12f;
-            entity.animCurrentFrame = 0;
-            entity.animFrameTime = 0.0f;
-            entity.sprite->setTextureRect(0, 0, entity.animFrameWidth,
-                                          entity.animFrameHeight);
-            break;
-        }
-        case 7: {
-            int explosionType = static_cast<int>(-entity.velocityX);
-            scale = 2.0f;
-
-            if (!entity.sprite->loadTexture(
-                    explosionType == 1 ? ASSET_SPAN(embedded::blowup_1_data)
-                                       : ASSET_SPAN(embedded::blowup_2_data))) {
-            }
-            entity.sprite->setScale(scale, scale);
-            entity.spriteScale = scale;
-
-            if (explosionType == 1) {
-                entity.animFrameCount = 6;
-                entity.animFrameWidth = 32;
-                entity.animFrameHeight = 32;
-                entity.animFrameDuration = 0.08f;
-            } else {
-                entity.animFrameCount = 8;
-                entity.animFrameWidth = 64;
-                entity.animFrameHeight = 64;
-                entity.animFrameDuration = 0.06f;
-            }
-            entity.animCurrentFrame = 0;
-            entity.animFrameTime = 0.0f;
-            entity.sprite->setTextureRect(0, 0, entity.animFrameWidth,
-                                          entity.animFrameHeight);
-            entity.velocityX = 0.0f;
-            entity.velocityY = 0.0f;
-            break;
-        }
-        case 8: {
-            scale = 0.8f;
-            if (!entity.sprite->loadTexture(
-                    ASSET_SPAN(embedded::shield_item_data))) {
-                scale = 0.5f;
-                entity.sprite->loadTexture(ASSET_SPAN(embedded::boss_3_data));
-            }
-            entity.sprite->setScale(scale, scale);
-            entity.spriteScale = scale;
-            entity.animFrameCount = 0;
-            break;
-        }
-        case 9: {
-            scale = 0.8f;
-            if (!entity.sprite->loadTexture(
-                    ASSET_SPAN(embedded::search_missile_item_data))) {
-                scale = 0.5f;
-                entity.sprite->loadTexture(
-                    ASSET_SPAN(embedded::projectile_player_1_data));
-            }
-            entity.sprite->setScale(scale, scale);
-            entity.spriteScale = scale;
-            entity.animFrameCount = 0;
-            break;
-        }
-        case 10: {
-            scale = 2.2f;
-            if (entity.sprite->loadTexture(
-                    ASSET_SPAN(embedded::regular_data))) {
-                entity.animFrameCount = 3;
-                entity.animCurrentFrame = 0;
-                entity.animFrameTime = 0.0f;
-                entity.animFrameDuration = 0.15f;
-                entity.animFrameWidth = 37;
-                entity.animFrameHeight = 26;
-                entity.sprite->setTextureRect(0, 0, 37, 26);
-                entity.sprite->setScale(scale, scale);
-            }
-            entity.spriteScale = scale;
-            break;
-        }
-        case 11: {
-            scale = 5.0f;
-            entity.sprite->loadTexture(
-                ASSET_SPAN(embedded::projectile_enemy_1_data));
-            entity.sprite->setScale(scale, scale);
-            entity.spriteScale = scale;
-            break;
-        }
-        case 12: {
-            scale = 1.5f;
-            if (entity.sprite->loadTexture(ASSET_SPAN(embedded::boss_4_data))) {
-                entity.animFrameCount = 3;
-                entity.animCurrentFrame = 0;
-                entity.animFrameTime = 0.0f;
-                entity.animFrameDuration = 0.15f;
-                entity.animFrameWidth = 65;
-                entity.animFrameHeight = 50;
-                entity.sprite->setTextureRect(0, 0, 65, 50);
-                entity.sprite->setScale(scale, scale);
-            }
-            entity.spriteScale = scale;
-            break;
-        }
-        case 13: {
-            scale = 3.0f;
-            entity.sprite->loadTexture(
-                ASSET_SPAN(embedded::projectile_enemy_1_data));
-            entity.sprite->setScale(scale, scale);
-            entity.spriteScale = scale;
-            break;
-        }
-        case 14: {
-            scale = 0.8f;
-            entity.sprite->loadTexture(ASSET_SPAN(embedded::boss_3_data));
-            entity.sprite->setScale(scale, scale);
-            entity.spriteScale = scale;
-            entity.animFrameCount = 0;
-            break;
-        }
-        case 15: {
-            scale = 5.0f;
-            entity.sprite->loadTexture(
-                ASSET_SPAN(embedded::projectile_enemy_1_data));
-            entity.sprite->setScale(scale, scale);
-            entity.spriteScale = scale;
-            break;
-        }
-        case 16: {
-            scale = 3.0f;
-            if (entity.sprite->loadTexture(
-                    ASSET_SPAN(embedded::enemy_turret_data))) {
-                bool isTopTurret = entity.y < 540.0f;
-                int offsetX = isTopTurret ? 16 : 0;
-                entity.sprite->setTextureRect(offsetX, 0, 16, 27);
-                entity.sprite->setScale(scale, scale);
-            }
-            entity.spriteScale = scale;
-            break;
-        }
-        case 17: {
-            scale = 3.0f;
-            if (entity.sprite->loadTexture(
-                    ASSET_SPAN(embedded::small_pink_bullet_data))) {
-                entity.animFrameCount = 4;
-                entity.animCurrentFrame = 0;
-                entity.animFrameTime = 0.0f;
-                entity.animFrameDuration = 0.1f;
-                entity.animFrameWidth = 14;
-                entity.animFrameHeight = 10;
-                entity.sprite->setTextureRect(0, 0, 14, 10);
-                entity.sprite->setScale(scale, scale);
-            }
-            entity.spriteScale = scale;
-            break;
-        }
-        case 18: {
-            scale = 2.0f;
-            if (entity.sprite->loadTexture(
-                    ASSET_SPAN(embedded::orbiter_data))) {
-                entity.animFrameCount = 2;
-                entity.animCurrentFrame = 0;
-                entity.animFrameTime = 0.0f;
-                entity.animFrameDuration = 0.15f;
-                entity.animFrameWidth = 24;
-                entity.animFrameHeight = 26;
-                entity.sprite->setTextureRect(0, 0, 24, 26);
-                entity.sprite->setScale(scale, scale);
-            }
-            entity.spriteScale = scale;
-            break;
-        }
-        case 19: {
-            scale = 2.5f;
-            if (entity.sprite->loadTexture(
-                    ASSET_SPAN(embedded::small_pink_bullet_data))) {
-                entity.animFrameCount = 4;
-                entity.animCurrentFrame = 0;
-                entity.animFrameTime = 0.0f;
-                entity.animFrameDuration = 0.1f;
-                entity.animFrameWidth = 14;
-                entity.animFrameHeight = 10;
-                entity.sprite->setTextureRect(0, 0, 14, 10);
-                entity.sprite->setScale(scale, scale);
-            }
-            entity.spriteScale = scale;
-            break;
-        }
-        case 20: {
-            scale = 3.0f;
-            if (entity.sprite->loadTexture(
-                    ASSET_SPAN(embedded::laser_shooter_data))) {
-                entity.sprite->setScale(scale, scale);
-            }
-            entity.spriteScale = scale;
-            break;
-        }
-        case 21: {
-            if (entity.sprite->loadTexture(ASSET_SPAN(embedded::laser_data))) {
-                entity.sprite->setOrigin(320.0f, 2.0f);
-                entity.sprite->setScale(6.0f, 6.0f);
-            }
-            entity.spriteScale = 6.0f;
-            break;
-        }
-        case 22: {
-            scale = 4.0f;
-            if (!entity.sprite->loadTexture(
-                    ASSET_SPAN(embedded::search_missile_data))) {
-                scale = 5.0f;
-                entity.sprite->loadTexture(
-                    ASSET_SPAN(embedded::projectile_player_1_data));
-            }
-            entity.sprite->setScale(scale, scale);
-            entity.spriteScale = scale;
-            break;
-        }
-        case 23: {
-            scale = 2.5f;
-            if (entity.sprite->loadTexture(
-                    ASSET_SPAN(embedded::glandus_data))) {
-                entity.animFrameCount = 2;
-                entity.animCurrentFrame = 0;
-                entity.animFrameTime = 0.0f;
-                entity.animFrameDuration = 0.15f;
-                entity.animFrameWidth = 27;
-                entity.animFrameHeight = 22;
-                entity.sprite->setTextureRect(0, 0, 27, 22);
-                entity.sprite->setScale(scale, scale);
-            }
-            entity.spriteScale = scale;
-            break;
-        }
-        case 24: {
-            scale = 2.0f;
-            if (entity.sprite->loadTexture(
-                    ASSET_SPAN(embedded::glandus_mini_data))) {
-                entity.animFrameCount = 2;
-                entity.animCurrentFrame = 0;
-                entity.animFrameTime = 0.0f;
-                entity.animFrameDuration = 0.15f;
-                entity.animFrameWidth = 27;
-                entity.animFrameHeight = 22;
-                entity.sprite->setTextureRect(0, 0, 27, 22);
-                entity.sprite->setScale(scale, scale);
-            }
-            entity.spriteScale = scale;
-            break;
-        }
-        case 25: {
-            scale = 0.8f;
-            if (!entity.sprite->loadTexture(
-                    ASSET_SPAN(embedded::speed_item_data))) {
-                scale = 0.5f;
-                entity.sprite->loadTexture(ASSET_SPAN(embedded::boss_3_data));
-            }
-            entity.sprite->setScale(scale, scale);
-            entity.spriteScale = scale;
-            entity.animFrameCount = 0;
-            break;
-        }
-        case 30: {
-            scale = 3.0f;
-            if (entity.sprite->loadTexture(ASSET_SPAN(embedded::boss_4_data))) {
-                entity.animFrameCount = 4;
-                entity.animCurrentFrame = 0;
-                entity.animFrameTime = 0.0f;
-                entity.animFrameDuration = 0.15f;
-                entity.animFrameWidth = 48;
-                entity.animFrameHeight = 48;
-                entity.sprite->setTextureRect(0, 0, 48, 48);
-                entity.sprite->setScale(scale, scale);
-                entity.sprite->setOrigin(24.0f, 24.0f);
-            }
-            entity.spriteScale = scale;
-            break;
-        }
-        case 31: {
-            scale = 1.5f;
-            if (entity.sprite->loadTexture(
-                    ASSET_SPAN(embedded::orbiter_data))) {
-                entity.animFrameCount = 2;
-                entity.animCurrentFrame = 0;
-                entity.animFrameTime = 0.0f;
-                entity.animFrameDuration = 0.15f;
-                entity.animFrameWidth = 24;
-                entity.animFrameHeight = 26;
-                entity.sprite->setTextureRect(0, 0, 24, 26);
-                entity.sprite->setScale(scale, scale);
-            }
-            entity.spriteScale = scale;
-            break;
-        }
-        case 32: {
-            scale = 3.0f;
-            if (entity.sprite->loadTexture(
-                    ASSET_SPAN(embedded::small_green_bullet_data))) {
-                entity.animFrameCount = 4;
-                entity.animCurrentFrame = 0;
-                entity.animFrameTime = 0.0f;
-                entity.animFrameDuration = 0.1f;
-                entity.animFrameWidth = 14;
-                entity.animFrameHeight = 10;
-                entity.sprite->setTextureRect(0, 0, 14, 10);
-                entity.sprite->setScale(scale, scale);
-            }
-            entity.spriteScale = scale;
-            break;
-        }
-        case 34: {
-            scale = 2.5f;
-            if (entity.sprite->loadTexture(ASSET_SPAN(embedded::boss_2_data))) {
-                entity.animFrameCount = 1;
-                entity.animCurrentFrame = 0;
-                entity.animFrameTime = 0.0f;
-                entity.animFrameDuration = 1.0f;
-                entity.animFrameWidth = 130;
-                entity.animFrameHeight = 50;
-                entity.sprite->setTextureRect(0, 0, 130, 50);
-                entity.sprite->setScale(scale, scale);
-                entity.sprite->setOrigin(65.0f, 25.0f);
-            }
-            entity.spriteScale = scale;
-            break;
-        }
-        case 35: {
-            scale = 2.0f;
-            if (entity.sprite->loadTexture(ASSET_SPAN(embedded::turret_data))) {
-                entity.animFrameCount = 1;
-                entity.animCurrentFrame = 0;
-                entity.animFrameTime = 0.0f;
-                entity.animFrameDuration = 1.0f;
-                entity.animFrameWidth = 32;
-                entity.animFrameHeight = 23;
-                entity.sprite->setTextureRect(0, 0, 32, 23);
-                entity.sprite->setScale(scale, scale);
-            }
-            entity.spriteScale = scale;
+        case EntityType::TURRET: {
+            applyVisual(entity, getEntityVisual(entity.type));
+            bool isTopTurret = entity.y < 540.0f;
+            int offsetX = isTopTurret ? 16 : 0;
+            entity.sprite->setTextureRect(offsetX, 0, 16, 27);
             break;
         }
         default:
-            if (entity.type >= 10) {
-                scale = 1.0f;
-                entity.sprite->loadTexture(ASSET_SPAN(embedded::boss_3_data));
-            } else {
-                scale = 2.0f;
-                entity.sprite->loadTexture(ASSET_SPAN(embedded::player_1_data));
-            }
-            entity.sprite->setScale(scale, scale);
-            entity.spriteScale = scale;
+            applyVisual(entity, getEntityVisual(entity.type));
             break;
     }
 }
 
+void ClientGameState::applyVisual(ClientEntity& entity,
+                                  const EntityVisual& visual)
+{
+    float scale = visual.scale;
+    bool loaded = entity.sprite->loadTexture(visual.texture);
+    if (!loaded && !visual.fallbackTexture.empty()) {
+        scale = visual.fallbackScale;
+        loaded = entity.sprite->loadTexture(visual.fallbackTexture);
+    }
+    entity.sprite->setScale(scale, scale);
+    entity.spriteScale = scale;
+
+    const EntityAnimation& animation = visual.animation;
+    entity.animFrameCount = animation.frameCount;
+    entity.animFrameWidth = animation.frameWidth;
+    entity.animFrameHeight = animation.frameHeight;
+    entity.animFrameDuration = animation.frameDuration;
+    entity.animPlayback = animation.playback;
+    entity.animRowPerState = animation.rowPerState;
+    entity.animCurrentFrame = 0;
+    entity.animFrameTime = 0.0f;
+    entity.animState = ClientEntity::AnimationState::IDLE;
+
+    if (!loaded) {
+        return;
+    }
+    if (animation.frameCount > 0) {
+        entity.sprite->setTextureRect(0, 0, animation.frameWidth,
+                                      animation.frameHeight);
+    }
+    if (visual.originX != 0.0f || visual.originY != 0.0f) {
+        entity.sprite->setOrigin(visual.originX, visual.originY);
+    }
+}
+
 void ClientGameState::removeEntity(uint32_t entityId)
 {
-    auto it = _entities.find(entityId);
-    if (it != _entities.end()) {
-        _entities.erase(it);
+    _entities.destroy(entityId);
+}
+
+void ClientGameState::dropUnconfirmedEntities()
+{
+    // Spectator batches are unreliable: an entity the previous snapshot did
+    // not spawn again lost its S2C_ENTITY_DEAD on the way
+    std::vector<uint32_t> missed;
+    for (const auto& [id, entity] : _entities) {
+        if (!entity->confirmed) {
+            missed.push_back(id);
+        }
+        entity->confirmed = false;
+    }
+    for (uint32_t id : missed) {
+        removeEntity(id);
     }
 }
 
@@ -1009,22 +915,14 @@ bool ClientGameState::hasGameEvent() const { return _gameEventTimer > 0.0f; }
 
 float ClientGameState::getBossHealth() const
 {
-    for (const auto& [id, entity] : _entities) {
-        if (entity->type == 5 || entity->type == 30 || entity->type == 34) {
-            return entity->health;
-        }
-    }
-    return 0.0f;
+    const ClientEntity* boss = _entities.findFirstOfType({5, 30, 34});
+    return boss ? boss->health : 0.0f;
 }
 
 float ClientGameState::getBossMaxHealth() const
 {
-    for (const auto& [id, entity] : _entities) {
-        if (entity->type == 5 || entity->type == 30 || entity->type == 34) {
-            return entity->maxHealth;
-        }
-    }
-    return 0.0f;
+    const ClientEntity* boss = _entities.findFirstOfType({5, 30, 34});
+    return boss ? boss->maxHealth : 0.0f;
 }
 
 void ClientGameState::startRecording(const std::string& filename)
@@ -1037,6 +935,8 @@ void ClientGameState::startRecording(const std::string& filename)
 
     std::string replayPath = "replays/" + filename;
     _recorder = std::make_unique<rtype::ReplayRecorder>(replayPath);
+    _level = 0;
+    _peakPlayerCount = 0;
 
     if (_recorder->startRecording()) {
         std::cout << "[INFO] Started recording replay to: " << replayPath
@@ -1050,21 +950,155 @@ void ClientGameState::startRecording(const std::string& filename)
 void ClientGameState::stopRecording()
 {
     if (_recorder) {
+        _recorder->setGameInfo(_level, _peakPlayerCount, _score);
         _recorder->stopRecording();
         std::cout << "[INFO] Stopped recording replay" << std::endl;
         _recorder.reset();
     }
 }
 
+std::vector<uint8_t> ClientGameState::buildReplayKeyframe() const
+{
+    std::vector<uint8_t> keyframe;
+
+    LoginResponsePacket login{};
+    login.header.opCode = S2C_LOGIN_OK;
+    login.playerId = _playerId;
+    login.mapWidth = _mapWidth;
+    login.mapHeight = _mapHeight;
+    replay::appendKeyframePacket(keyframe, login);
+
+    ScoreUpdatePacket score{};
+    score.header.opCode = S2C_SCORE_UPDATE;
+    score.score = _score;
+    replay::appendKeyframePacket(keyframe, score);
+
+    for (const auto& [id, entity] : _entities) {
+        // Last server position, not the interpolated one being drawn
+        float x = entity->x;
+        float y = entity->y;
+        entity->snapshots.newest(x, y);
+
+        EntitySpawnPacket spawn{};
+        spawn.header.opCode = S2C_ENTITY_NEW;
+        spawn.entityId = id;
+        spawn.type = entity->type;
+        spawn.x = x;
+        spawn.y = y;
+        replay::appendKeyframePacket(keyframe, spawn);
+
+        HealthUpdatePacket health{};
+        health.header.opCode = S2C_HEALTH_UPDATE;
+        health.entityId = id;
+        health.currentHealth = entity->health;
+        health.maxHealth = entity->maxHealth;
+        replay::appendKeyframePacket(keyframe, health);
+
+        if (entity->hasShield) {
+            ShieldStatusPacket shield{};
+            shield.header.opCode = S2C_SHIELD_STATUS;
+            shield.playerId = id;
+            shield.hasShield = 1;
+            replay::appendKeyframePacket(keyframe, shield);
+        }
+    }
+    return keyframe;
+}
+
 void ClientGameState::resetForReplay()
 {
     _entities.clear();
-    _explosions.clear();
+    _particles.clear();
     _score = 0;
+    resetPrediction();
 }
 
-const std::unordered_map<uint32_t, std::unique_ptr<ClientEntity>>&
-ClientGameState::getAllEntities() const
+void ClientGameState::saveSnapshot(ClientStateSnapshot& snapshot) const
+{
+    snapshot.playerId = _playerId;
+    snapshot.mapWidth = _mapWidth;
+    snapshot.mapHeight = _mapHeight;
+    snapshot.gameStarted = _gameStarted;
+    snapshot.score = _score;
+    snapshot.level = _level;
+    snapshot.gameEventText = _gameEventText;
+    snapshot.gameEventTimer = _gameEventTimer;
+    snapshot.levelCompleted = _levelCompleted;
+
+    // clear() keeps the capacity of a snapshot being overwritten
+    snapshot.entities.clear();
+    for (const auto& [id, entity] : _entities) {
+        ClientStateSnapshot::Entity& saved = snapshot.entities.emplace_back();
+        saved.id = id;
+        saved.type = entity->type;
+        // Interpolated entities are drawn behind what the server sent
+        if (!entity->snapshots.newest(saved.x, saved.y)) {
+            saved.x = entity->x;
+            saved.y = entity->y;
+        }
+        saved.lastY = entity->lastY;
+        saved.health = entity->health;
+        saved.maxHealth = entity->maxHealth;
+        saved.hasShield = entity->hasShield;
+        saved.hasSpeedBoost = entity->hasSpeedBoost;
+        saved.speedBoostTimer = entity->speedBoostTimer;
+        saved.animState = entity->animState;
+        saved.animCurrentFrame = entity->animCurrentFrame;
+        saved.animFrameTime = entity->animFrameTime;
+    }
+}
+
+void ClientGameState::restoreSnapshot(const ClientStateSnapshot& snapshot)
+{
+    resetForReplay();
+    _playerId = snapshot.playerId;
+    _mapWidth = snapshot.mapWidth;
+    _mapHeight = snapshot.mapHeight;
+    _gameStarted = snapshot.gameStarted;
+    _score = snapshot.score;
+    _level = snapshot.level;
+    _gameEventText = snapshot.gameEventText;
+    _gameEventTimer = snapshot.gameEventTimer;
+    _levelCompleted = snapshot.levelCompleted;
+
+    for (const ClientStateSnapshot::Entity& saved : snapshot.entities) {
+        ClientEntity* entity =
+            _entities.create(saved.id, saved.type, saved.x, saved.y);
+        if (!entity) {
+            continue;
+        }
+        entity->isLocalPlayer =
+            saved.type == EntityType::PLAYER && saved.id == _playerId;
+        createEntitySprite(*entity);
+
+        entity->lastY = saved.lastY;
+        entity->health = saved.health;
+        entity->maxHealth = saved.maxHealth;
+        entity->hasShield = saved.hasShield;
+        entity->hasSpeedBoost = saved.hasSpeedBoost;
+        entity->speedBoostTimer = saved.speedBoostTimer;
+        if (entity->hasSpeedBoost) {
+            attachSpeedArrows(*entity);
+        }
+
+        if (entity->animFrameCount > 0) {
+            entity->animState = saved.animState;
+            entity->animCurrentFrame =
+                std::min(saved.animCurrentFrame, entity->animFrameCount - 1);
+            entity->animFrameTime = saved.animFrameTime;
+            int row = entity->animRowPerState
+                          ? static_cast<int>(entity->animState)
+                          : 0;
+            entity->sprite->setTextureRect(
+                entity->animCurrentFrame * entity->animFrameWidth,
+                row * entity->animFrameHeight, entity->animFrameWidth,
+                entity->animFrameHeight);
+        }
+        entity->snapshots.push(_clientTime, saved.x, saved.y);
+    }
+}
+
+const ClientEntityStore& ClientGameState::getAllEntities() const
 {
     return _entities;
 }
@@ -1073,7 +1107,14 @@ bool ClientGameState::isRecording() const { return _recorder != nullptr; }
 
 void ClientGameState::setSeekingMode(bool seeking) { _isSeeking = seeking; }
 
-void ClientGameState::clearExplosions() { _explosions.clear(); }
+void ClientGameState::clearExplosions() { _particles.clear(); }
+
+bool ClientGameState::consumeScreenShake()
+{
+    bool pending = _screenShakePending;
+    _screenShakePending = false;
+    return pending;
+}
 
 void ClientGameState::setIsSeeking(bool seeking) { _isSeeking = seeking; }
 
@@ -1110,19 +1151,40 @@ void ClientGameState::processShieldStatus(uint32_t playerId, bool hasShield)
     onShieldStatus(playerId, hasShield);
 }
 
-void ClientGameState::updateSimpleAnimation(ClientEntity& entity,
-                                            float deltaTime)
+void ClientGameState::processScoreUpdate(uint32_t score) { _score = score; }
+
+void ClientGameState::advanceAnimation(ClientEntity& entity, float deltaTime)
 {
     entity.animFrameTime += deltaTime;
-    if (entity.animFrameTime >= entity.animFrameDuration) {
-        entity.animFrameTime = 0.0f;
-        entity.animCurrentFrame++;
-        if (entity.animCurrentFrame >= entity.animFrameCount) {
-            entity.animCurrentFrame = 0;
+    if (entity.animFrameTime < entity.animFrameDuration) {
+        return;
+    }
+    entity.animFrameTime = 0.0f;
+    entity.animCurrentFrame++;
+    if (entity.animCurrentFrame >= entity.animFrameCount) {
+        if (entity.animPlayback == AnimationPlayback::ONE_SHOT) {
+            entity.hasTriggeredEffect = true;
+            return;
+        }
+        entity.animCurrentFrame = 0;
+    }
+
+    int row = entity.animRowPerState ? static_cast<int>(entity.animState) : 0;
+    entity.sprite->setTextureRect(
+        entity.animCurrentFrame * entity.animFrameWidth,
+        row * entity.animFrameHeight, entity.animFrameWidth,
+        entity.animFrameHeight);
+}
+
+void ClientGameState::attachSpeedArrows(ClientEntity& entity)
+{
+    _entities.releaseSpeedArrows(entity);
+    for (int i = 0; i < 3; ++i) {
+        auto arrow = _entities.acquireSprite();
+        if (arrow->loadTexture(ASSET_SPAN(embedded::speed_arrow_data))) {
+            arrow->setScale(0.80f, 0.80f);
+            entity.speedArrowSprites.push_back(std::move(arrow));
         }
-        int frameX = entity.animCurrentFrame * entity.animFrameWidth;
-        entity.sprite->setTextureRect(frameX, 0, entity.animFrameWidth,
-                                      entity.animFrameHeight);
     }
 }
 
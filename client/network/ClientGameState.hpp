@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <array>
 #include <iostream>
 #include <memory>
 #include <resources/EmbeddedResources.hpp>
@@ -14,66 +15,18 @@
 #include <unordered_map>
 #include <vector>
 
-#include "../src/Explosion.hpp"
+#include "../src/ParticleSystem.hpp"
 #include "../wrapper/graphics/GraphicsSFML.hpp"
 #include "../wrapper/graphics/SpriteSFML.hpp"
 #include "../wrapper/resources/EmbeddedResources.hpp"
+#include "ClientEntityStore.hpp"
+#include "ClientStateSnapshot.hpp"
 #include "NetworkClientAsio.hpp"
+#include "SnapshotBuffer.hpp"
 #include "common/replay/ReplayRecorder.hpp"
 
 namespace rtype {
 
-/**
- * @brief Represents a game entity on the client side
- */
-struct ClientEntity {
-    uint32_t id;
-    uint8_t type;
-    float x, y;
-    float lastY = 0;
-    float velocityX = 0.0f;
-    float velocityY = 0.0f;
-    float health = 100.0f;
-    float maxHealth = 100.0f;
-    std::unique_ptr<SpriteSFML> sprite;
-    std::unique_ptr<SpriteSFML> shieldSprite;
-    float spriteScale = 1.0f;
-    float verticalIdleTime = 0.0f;
-    bool isLocalPlayer = false;
-    bool hasShield = false;
-    bool hasSpeedBoost = false;
-    float speedBoostTimer = 0.0f;
-    std::vector<std::unique_ptr<SpriteSFML>> speedArrowSprites;
-
-    enum class AnimationState { IDLE, MOVING_DOWN, MOVING_UP };
-    AnimationState animState = AnimationState::IDLE;
-    int animFrameCount = 0;
-    int animCurrentFrame = 0;
-    float animFrameTime = 0.0f;
-    float animFrameDuration = 0.0f;
-    int animFrameWidth = 0;
-    int animFrameHeight = 0;
-    bool hasTriggeredEffect = false;
-
-    bool isLaser = false;
-    float laserTargetWidth = 400.0f;
-    float laserCurrentWidth = 1.0f;
-    float laserGrowthRate = 800.0f;
-    bool laserFullyGrown = false;
-
-    ClientEntity(uint32_t entityId, uint8_t entityType, float posX, float posY)
-        : id(entityId),
-          type(entityType),
-          x(posX),
-          y(posY),
-          sprite(std::make_unique<SpriteSFML>())
-    {
-        if (entityType == 3) {
-            velocityX = 400.0f;
-        }
-    }
-};
-
 /**
  * @brief Enhanced client state management with ECS integration
  */
@@ -93,10 +46,11 @@ class ClientGameState {
     uint32_t _score = 0;
 
     // Entities
-    std::unordered_map<uint32_t, std::unique_ptr<ClientEntity>> _entities;
+    ClientEntityStore _entities;
 
     // Visual effects
-    std::vector<std::unique_ptr<Explosion>> _explosions;
+    ParticleSystem _particles;
+    bool _screenShakePending = false;  ///< A boss blast since the last check
 
     // Connection status
     std::string _lastError;
@@ -104,6 +58,8 @@ class ClientGameState {
 
     // Replay recording
     std::unique_ptr<rtype::ReplayRecorder> _recorder;
+    uint8_t _level = 0;            // Last level announced by the server
+    uint8_t _peakPlayerCount = 0;  // Most players alive at once
 
     // Replay seeking flag (prevents explosion creation during fast-forward)
     bool _isSeeking = false;
@@ -116,13 +72,32 @@ class ClientGameState {
 
     static constexpr float MAX_CONNECTION_TIMEOUT = 5.0f;
 
+    // Remote entity interpolation
+    float _clientTime = 0.0f;
+    float _interpolationDelay = 0.1f;
+    InterpolationMode _interpolationMode = InterpolationMode::Hermite;
+    static constexpr float MAX_EXTRAPOLATION = 0.1f;
+
+    // Client-side prediction of the local player
+    struct PendingInput {
+        uint32_t sequenceId;
+        uint8_t inputMask;
+        float speed;
+    };
+    static constexpr size_t INPUT_HISTORY_SIZE = 128;
+    std::array<PendingInput, INPUT_HISTORY_SIZE> _pendingInputs{};
+    size_t _pendingInputStart = 0;
+    size_t _pendingInputCount = 0;
+    uint32_t _lastAckedInput = 0;
+    bool _serverAcksInputs = false;
+
    public:
     ClientGameState();
     ~ClientGameState() = default;
 
     // Network management
     bool connectToServer(const std::string& address, uint16_t port);
-    bool sendLogin(const std::string& username);
+    bool sendLogin(const std::string& username, uint16_t roomId = 0);
     void disconnect();
     bool isConnected() const;
     bool isGameStarted() const;
@@ -131,10 +106,19 @@ class ClientGameState {
 
     // Game loop integration
     void update(float deltaTime);
+    // Queues into the open sprite batch of graphics
     void render(IGraphics& graphics, float windowScale, float offsetX,
                 float offsetY);
     void sendInput(uint8_t inputMask);
 
+    /**
+     * @brief Configure how remote entities are smoothed
+     * @param delaySeconds How far in the past entities are drawn (0 = snap to
+     * each received position)
+     * @param mode Curve used between received positions
+     */
+    void setInterpolation(float delaySeconds, InterpolationMode mode);
+
     // State getters
     uint32_t getPlayerId() const;
     uint16_t getMapWidth() const;
@@ -153,7 +137,24 @@ class ClientGameState {
     // Replay playback - reset state for seek
     void resetForReplay();
     void setSeekingMode(bool seeking);
+
+    /**
+     * @brief Copy the state into a snapshot, without touching any sprite
+     */
+    void saveSnapshot(ClientStateSnapshot& snapshot) const;
+
+    /**
+     * @brief Replace the state with a snapshot, recreating its sprites
+     *
+     * Particles and pending inputs are dropped, as on resetForReplay().
+     */
+    void restoreSnapshot(const ClientStateSnapshot& snapshot);
     void clearExplosions();
+
+    /**
+     * @brief Whether a boss death blast went off since the last call
+     */
+    bool consumeScreenShake();
     void setIsSeeking(bool seeking);
 
     float getPlayerHealth() const;
@@ -165,8 +166,7 @@ class ClientGameState {
     // Entity management
     ClientEntity* getEntity(uint32_t entityId);
     ClientEntity* getLocalPlayer();
-    const std::unordered_map<uint32_t, std::unique_ptr<ClientEntity>>&
-    getAllEntities() const;
+    const ClientEntityStore& getAllEntities() const;
 
     // Public methods for replay processing
     void processLoginResponse(uint32_t playerId, uint16_t mapWidth,
@@ -177,6 +177,7 @@ class ClientGameState {
     void processHealthUpdate(uint32_t entityId, float currentHealth,
                              float maxHealth);
     void processShieldStatus(uint32_t playerId, bool hasShield);
+    void processScoreUpdate(uint32_t score);
 
    private:
     // Network callbacks
@@ -193,12 +194,29 @@ class ClientGameState {
     void onShieldStatus(uint32_t playerId, bool hasShield);
     void onGameEvent(uint8_t eventType, uint8_t waveNumber, uint8_t totalWaves,
                      uint8_t levelId);
+    void onInputAck(uint32_t inputSequenceId, float x, float y);
     void onError(const std::string& error);
 
     // Entity helpers
     void createEntitySprite(ClientEntity& entity);
+    void applyVisual(ClientEntity& entity, const EntityVisual& visual);
     void removeEntity(uint32_t entityId);
-    void updateSimpleAnimation(ClientEntity& entity, float deltaTime);
+    /**
+     * @brief Remove the entities the last spectator snapshot did not spawn
+     * again, then wait for the next one to confirm the rest
+     */
+    void dropUnconfirmedEntities();
+    void advanceAnimation(ClientEntity& entity, float deltaTime);
+    void attachSpeedArrows(ClientEntity& entity);
+    void updateMovementAnimation(ClientEntity& entity, float newY);
+    bool isInterpolated(const ClientEntity& entity) const;
+
+    // Replay keyframe of the current state, as packets
+    std::vector<uint8_t> buildReplayKeyframe() const;
+
+    // Prediction helpers
+    void pushPendingInput(const PendingInput& input);
+    void resetPrediction();
 };
 
 }  // namespace rtype
@@ -0,0 +1,57 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type
+** File description:
+** ClientStateSnapshot
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "ClientEntity.hpp"
+
+namespace rtype {
+
+/**
+ * @brief Plain copy of a ClientGameState, without sprites or effects
+ *
+ * Saving one only copies numbers; sprites are created again when it is
+ * restored. Saving over an older snapshot reuses its entity storage.
+ */
+struct ClientStateSnapshot {
+    /**
+     * @brief What an entity needs to look the same once recreated
+     */
+    struct Entity {
+        uint32_t id = 0;
+        uint8_t type = 0;
+        float x = 0.0f;  ///< Last received position, not the drawn one
+        float y = 0.0f;
+        float lastY = 0.0f;
+        float health = 100.0f;
+        float maxHealth = 100.0f;
+        bool hasShield = false;
+        bool hasSpeedBoost = false;
+        float speedBoostTimer = 0.0f;
+        ClientEntity::AnimationState animState =
+            ClientEntity::AnimationState::IDLE;
+        int animCurrentFrame = 0;
+        float animFrameTime = 0.0f;
+    };
+
+    uint32_t playerId = 0;
+    uint16_t mapWidth = 0;
+    uint16_t mapHeight = 0;
+    bool gameStarted = false;
+    uint32_t score = 0;
+    uint8_t level = 0;
+    std::string gameEventText;
+    float gameEventTimer = 0.0f;
+    bool levelCompleted = false;
+    std::vector<Entity> entities;
+};
+
+}  // namespace rtype
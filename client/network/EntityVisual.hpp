@@ -0,0 +1,50 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type
+** File description:
+** EntityVisual
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace rtype {
+
+/**
+ * @brief How a sprite sheet is played
+ */
+enum class AnimationPlayback : uint8_t {
+    STATIC,    ///< First frame only
+    LOOP,      ///< Wraps back to the first frame
+    ONE_SHOT,  ///< Plays once, then the entity is removed
+};
+
+/**
+ * @brief Layout and timing of a horizontal sprite sheet
+ */
+struct EntityAnimation {
+    int frameCount = 0;  ///< 0 when the whole image is shown
+    int frameWidth = 0;
+    int frameHeight = 0;
+    float frameDuration = 0.0f;
+    AnimationPlayback playback = AnimationPlayback::STATIC;
+    bool rowPerState = false;  ///< Row picked by ClientEntity::animState
+};
+
+/**
+ * @brief Everything needed to build an entity's sprite
+ */
+struct EntityVisual {
+    std::span<const std::byte> texture;
+    float scale = 1.0f;
+    std::span<const std::byte> fallbackTexture;  ///< When texture fails
+    float fallbackScale = 1.0f;
+    EntityAnimation animation;
+    float originX = 0.0f;
+    float originY = 0.0f;
+};
+
+}  // namespace rtype
@@ -11,6 +11,7 @@
 #include <iostream>
 
 #include "common/network/NetworkMessage.hpp"
+#include "common/replay/ReplayFormat.hpp"
 
 namespace rtype {
 
@@ -89,7 +90,8 @@ bool NetworkClientAsio::isConnected() const
 
 NetworkState NetworkClientAsio::getState() const { return _state.load(); }
 
-bool NetworkClientAsio::sendLogin(const std::string& username)
+bool NetworkClientAsio::sendLogin(const std::string& username,
+                                  uint16_t roomId)
 {
     if (!isConnected()) {
         return false;
@@ -108,14 +110,15 @@ bool NetworkClientAsio::sendLogin(const std::string& username)
                  sizeof(packet.username) - 1);
 #endif
     packet.username[sizeof(packet.username) - 1] = '\0';
+    packet.roomId = roomId;
 
     return sendPacket(packet);
 }
 
-bool NetworkClientAsio::sendInput(uint8_t inputMask)
+uint32_t NetworkClientAsio::sendInput(uint8_t inputMask)
 {
     if (!isConnected()) {
-        return false;
+        return 0;
     }
 
     ::InputPacket packet;
@@ -124,7 +127,7 @@ bool NetworkClientAsio::sendInput(uint8_t inputMask)
     packet.header.sequenceId = getNextSequenceId();
     packet.inputMask = inputMask;
 
-    return sendPacket(packet);
+    return sendPacket(packet) ? packet.header.sequenceId : 0;
 }
 
 bool NetworkClientAsio::sendDisconnect()
@@ -228,6 +231,12 @@ void NetworkClientAsio::setOnGameEventCallback(
     _onGameEvent = callback;
 }
 
+void NetworkClientAsio::setOnInputAckCallback(
+    std::function<void(const InputAckPacket&)> callback)
+{
+    _onInputAck = callback;
+}
+
 void NetworkClientAsio::setOnErrorCallback(
     std::function<void(const std::string&)> callback)
 {
@@ -310,6 +319,12 @@ void NetworkClientAsio::processReceivedData(const uint8_t* data, size_t size)
         case ::OpCode::S2C_GAME_EVENT:
             processGameEvent(data, size);
             break;
+        case ::OpCode::S2C_INPUT_ACK:
+            processInputAck(data, size);
+            break;
+        case ::OpCode::S2C_SPECTATE_BATCH:
+            processSpectateBatch(data, size);
+            break;
         default:
             break;
     }
@@ -501,6 +516,51 @@ void NetworkClientAsio::processGameEvent(const uint8_t* data, size_t size)
     }
 }
 
+void NetworkClientAsio::processInputAck(const uint8_t* data, size_t size)
+{
+    if (size < sizeof(::InputAckPacket)) {
+        return;
+    }
+
+    const ::InputAckPacket* packet =
+        reinterpret_cast<const ::InputAckPacket*>(data);
+
+    if (_onInputAck) {
+        _onInputAck(*packet);
+    }
+}
+
+void NetworkClientAsio::processSpectateBatch(const uint8_t* data, size_t size)
+{
+    ::Header header;
+    std::memcpy(&header, data, sizeof(header));
+    if (header.packetSize < sizeof(::SpectateBatchPacket) ||
+        header.packetSize > size) {
+        return;
+    }
+
+    // Records keep the sequence ids of the players' stream: spectators must
+    // not acknowledge them, so they are dispatched as unreliable packets
+    std::array<uint8_t, BUFFER_SIZE> record;
+    replay::forEachKeyframePacket(
+        data + sizeof(::SpectateBatchPacket),
+        header.packetSize - sizeof(::SpectateBatchPacket),
+        [this, &record](const uint8_t* packet, size_t packetSize) {
+            if (packetSize < sizeof(::Header) || packetSize > record.size()) {
+                return;
+            }
+            std::memcpy(record.data(), packet, packetSize);
+            ::Header recordHeader;
+            std::memcpy(&recordHeader, record.data(), sizeof(recordHeader));
+            if (recordHeader.opCode == ::OpCode::S2C_SPECTATE_BATCH) {
+                return;
+            }
+            recordHeader.sequenceId = 0;
+            std::memcpy(record.data(), &recordHeader, sizeof(recordHeader));
+            processReceivedData(record.data(), packetSize);
+        });
+}
+
 uint32_t NetworkClientAsio::getNextSequenceId() { return ++_sequenceId; }
 
 void NetworkClientAsio::setState(NetworkState newState) { _state = newState; }
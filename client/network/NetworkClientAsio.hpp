@@ -41,8 +41,9 @@ class NetworkClientAsio : public INetworkClient {
     bool isConnected() const override;
     NetworkState getState() const override;
 
-    bool sendLogin(const std::string& username) override;
-    bool sendInput(uint8_t inputMask) override;
+    bool sendLogin(const std::string& username,
+                   uint16_t roomId = 0) override;
+    uint32_t sendInput(uint8_t inputMask) override;
     bool sendDisconnect() override;
     bool sendAck(uint32_t sequenceId) override;
 
@@ -64,6 +65,8 @@ class NetworkClientAsio : public INetworkClient {
         std::function<void(const ShieldStatusPacket&)> callback);
     void setOnGameEventCallback(
         std::function<void(const GameEventPacket&)> callback);
+    void setOnInputAckCallback(
+        std::function<void(const InputAckPacket&)> callback);
     void setOnErrorCallback(
         std::function<void(const std::string&)> callback) override;
 
@@ -104,6 +107,7 @@ class NetworkClientAsio : public INetworkClient {
     std::function<void(const HealthUpdatePacket&)> _onHealthUpdate;
     std::function<void(const ShieldStatusPacket&)> _onShieldStatus;
     std::function<void(const GameEventPacket&)> _onGameEvent;
+    std::function<void(const InputAckPacket&)> _onInputAck;
     std::function<void(const std::string&)> _onError;
 
     // Private methods
@@ -129,6 +133,8 @@ class NetworkClientAsio : public INetworkClient {
     void processHealthUpdate(const uint8_t* data, size_t size);
     void processShieldStatus(const uint8_t* data, size_t size);
     void processGameEvent(const uint8_t* data, size_t size);
+    void processInputAck(const uint8_t* data, size_t size);
+    void processSpectateBatch(const uint8_t* data, size_t size);
 
     // Utility
     uint32_t getNextSequenceId();
@@ -0,0 +1,114 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type
+** File description:
+** SnapshotBuffer
+*/
+
+#include "SnapshotBuffer.hpp"
+
+namespace rtype {
+
+void SnapshotBuffer::push(float time, float x, float y)
+{
+    if (_count > 0 && time <= _snapshots[_count - 1].time) {
+        // Several updates handled in the same frame: keep the latest
+        _snapshots[_count - 1] = {_snapshots[_count - 1].time, x, y};
+        return;
+    }
+
+    if (_count == CAPACITY) {
+        for (size_t i = 1; i < CAPACITY; ++i) {
+            _snapshots[i - 1] = _snapshots[i];
+        }
+        _count--;
+    }
+    _snapshots[_count++] = {time, x, y};
+}
+
+void SnapshotBuffer::velocityAt(size_t index, float& vx, float& vy) const
+{
+    vx = 0.0f;
+    vy = 0.0f;
+
+    size_t prev = index > 0 ? index - 1 : index;
+    size_t next = index + 1 < _count ? index + 1 : index;
+    float span = _snapshots[next].time - _snapshots[prev].time;
+    if (span <= 0.0f) {
+        return;
+    }
+    vx = (_snapshots[next].x - _snapshots[prev].x) / span;
+    vy = (_snapshots[next].y - _snapshots[prev].y) / span;
+}
+
+bool SnapshotBuffer::sample(float renderTime, InterpolationMode mode,
+                            float maxExtrapolation, float& x, float& y) const
+{
+    if (_count == 0) {
+        return false;
+    }
+
+    const Snapshot& oldest = _snapshots[0];
+    if (_count == 1 || renderTime <= oldest.time) {
+        x = oldest.x;
+        y = oldest.y;
+        return true;
+    }
+
+    const Snapshot& newest = _snapshots[_count - 1];
+    if (renderTime >= newest.time) {
+        const Snapshot& before = _snapshots[_count - 2];
+        float span = newest.time - before.time;
+        float late = renderTime - newest.time;
+
+        // Extrapolate up to the bound, then glide back to the last known
+        // position instead of continuing on a stale velocity
+        float ahead = 0.0f;
+        if (late <= maxExtrapolation) {
+            ahead = late;
+        } else if (late < 2.0f * maxExtrapolation) {
+            ahead = 2.0f * maxExtrapolation - late;
+        }
+
+        x = newest.x;
+        y = newest.y;
+        if (span > 0.0f && ahead > 0.0f) {
+            x += (newest.x - before.x) / span * ahead;
+            y += (newest.y - before.y) / span * ahead;
+        }
+        return true;
+    }
+
+    size_t index = _count - 2;
+    while (index > 0 && _snapshots[index].time > renderTime) {
+        index--;
+    }
+
+    const Snapshot& from = _snapshots[index];
+    const Snapshot& to = _snapshots[index + 1];
+    float span = to.time - from.time;
+    float t = (renderTime - from.time) / span;
+
+    if (mode == InterpolationMode::Linear) {
+        x = from.x + (to.x - from.x) * t;
+        y = from.y + (to.y - from.y) * t;
+        return true;
+    }
+
+    float v0x, v0y, v1x, v1y;
+    velocityAt(index, v0x, v0y);
+    velocityAt(index + 1, v1x, v1y);
+
+    float t2 = t * t;
+    float t3 = t2 * t;
+    float h00 = 2.0f * t3 - 3.0f * t2 + 1.0f;
+    float h10 = t3 - 2.0f * t2 + t;
+    float h01 = -2.0f * t3 + 3.0f * t2;
+    float h11 = t3 - t2;
+
+    x = h00 * from.x + h10 * span * v0x + h01 * to.x + h11 * span * v1x;
+    y = h00 * from.y + h10 * span * v0y + h01 * to.y + h11 * span * v1y;
+    return true;
+}
+
+}  // namespace rtype
@@ -0,0 +1,85 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type
+** File description:
+** SnapshotBuffer
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+namespace rtype {
+
+/**
+ * @brief Curve used between two received positions
+ */
+enum class InterpolationMode {
+    Linear,   ///< Straight segments, cheapest
+    Hermite,  ///< Cubic Hermite with finite-difference tangents (smoother)
+};
+
+/**
+ * @brief Timestamped position history of one remote entity
+ *
+ * Positions are pushed as they arrive and sampled slightly in the past
+ * (render time = now - interpolation delay), so the entity is always drawn
+ * between two known positions and jitter/loss no longer shows as stutter.
+ * When the render time runs past the newest snapshot the last velocity is
+ * extrapolated for a bounded time, then eased back to the last known
+ * position so an entity that stopped sending does not drift away.
+ */
+class SnapshotBuffer {
+   public:
+    static constexpr size_t CAPACITY = 16;
+
+    /**
+     * @brief Record a position received at the given client time
+     */
+    void push(float time, float x, float y);
+
+    /**
+     * @brief Position of the entity at renderTime
+     * @param renderTime Client time to sample at
+     * @param mode Interpolation curve
+     * @param maxExtrapolation Longest extrapolation past the newest snapshot
+     * @param x Receives the sampled X
+     * @param y Receives the sampled Y
+     * @return false if the buffer is empty
+     */
+    bool sample(float renderTime, InterpolationMode mode,
+                float maxExtrapolation, float& x, float& y) const;
+
+    /**
+     * @brief Last received position
+     * @return false if the buffer is empty
+     */
+    bool newest(float& x, float& y) const
+    {
+        if (_count == 0) {
+            return false;
+        }
+        x = _snapshots[_count - 1].x;
+        y = _snapshots[_count - 1].y;
+        return true;
+    }
+
+    void clear() { _count = 0; }
+    size_t size() const { return _count; }
+
+   private:
+    struct Snapshot {
+        float time;
+        float x;
+        float y;
+    };
+
+    void velocityAt(size_t index, float& vx, float& vy) const;
+
+    // Oldest first; the oldest entry is dropped when full
+    std::array<Snapshot, CAPACITY> _snapshots{};
+    size_t _count = 0;
+};
+
+}  // namespace rtype
@@ -11,6 +11,7 @@
 #include <cmath>
 #include <ctime>
 #include <iostream>
+#include <thread>
 #include <unordered_map>
 
 #include "../Config.hpp"
@@ -19,6 +20,12 @@
 #include "Background.hpp"
 #include "SoundManager.hpp"
 #include "TextureManager.hpp"
+#include "common/network/PlayerMovement.hpp"
+
+namespace {
+/** @brief Update rate of the game loop while a render thread draws */
+constexpr auto SIMULATION_STEP = std::chrono::microseconds(1000000 / 120);
+}  // namespace
 
 Game::Game(rtype::WindowSFML& window, rtype::GraphicsSFML& graphics,
            rtype::InputSFML& input,
@@ -37,7 +44,7 @@ Game::Game(rtype::WindowSFML& window, rtype::GraphicsSFML& graphics,
       _currentFps(0),
       _scale(1.0f),
       _lastShootTime(std::chrono::steady_clock::now()),
-      _lastInputTime(std::chrono::steady_clock::now()),
+      _nextInputTime(std::chrono::steady_clock::now()),
       _screenShakeIntensity(0.0f),
       _screenShakeTimer(0.0f),
       _playerDead(false),
@@ -78,6 +85,11 @@ Game::Game(rtype::WindowSFML& window, rtype::GraphicsSFML& graphics,
     }
 
     _gameState = std::make_unique<rtype::ClientGameState>();
+    _gameState->setInterpolation(
+        config.getFloat("interpolationDelayMs", 100.0f) / 1000.0f,
+        config.getString("interpolation", "hermite") == "linear"
+            ? rtype::InterpolationMode::Linear
+            : rtype::InterpolationMode::Hermite);
 
     if (!tryConnect(serverAddress, serverPort)) {
         _connectionDialog = std::make_unique<rtype::ConnectionDialog>(
@@ -124,21 +136,52 @@ bool Game::run()
     _running = true;
     _returnToMenu = false;
 
+    // The color-blind filter post-processes through a render texture on the
+    // window's thread, so it keeps the single-threaded path
+    if (rtype::Config::getInstance().getInt("renderThread", 0) == 1 &&
+        !_colorBlindFilter.getRenderTarget()) {
+        _renderThread = std::make_unique<rtype::RenderThreadSFML>(_window);
+        _renderThread->start();
+    }
+
     _window.getDeltaTime();
+    auto nextTick = std::chrono::steady_clock::now();
 
     while (_running && _window.isOpen()) {
         float deltaTime = _window.getDeltaTime();
 
         handleEvents();
         update(deltaTime);
-        render();
+        renderFrame();
 
         updateFps(deltaTime);
+
+        // display() no longer paces this loop, tick at a fixed rate instead
+        if (_renderThread) {
+            nextTick = std::max(nextTick + SIMULATION_STEP,
+                                std::chrono::steady_clock::now());
+            std::this_thread::sleep_until(nextTick);
+        }
     }
 
+    _renderThread.reset();
+
     return _returnToMenu;
 }
 
+void Game::renderFrame()
+{
+    if (!_renderThread) {
+        render();
+        return;
+    }
+
+    _graphics.setRecording(&_renderThread->beginFrame());
+    render();
+    _graphics.setRecording(nullptr);
+    _renderThread->submitFrame();
+}
+
 void Game::handleEvents()
 {
     while (_window.pollEvent()) {
@@ -256,10 +299,15 @@ void Game::update(float deltaTime)
 
         if (_gameState->isConnected() && _window.hasFocus()) {
             auto currentTime = std::chrono::steady_clock::now();
-            const auto inputCooldown = std::chrono::milliseconds(16);
-            if (currentTime - _lastInputTime >= inputCooldown) {
+            // One input per server step, as the server applies and budgets
+            const auto inputStep =
+                std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                    std::chrono::duration<float>(PlayerMovement::INPUT_STEP));
+            if (currentTime >= _nextInputTime) {
                 _gameState->sendInput(inputMask);
-                _lastInputTime = currentTime;
+                // Stay on the 60 Hz schedule without catching up on stalls
+                _nextInputTime = std::max(_nextInputTime + inputStep,
+                                          currentTime - inputStep);
             }
         }
 
@@ -295,15 +343,9 @@ void Game::update(float deltaTime)
         }
     }
 
-    if (_gameState) {
-        const auto& entities = _gameState->getAllEntities();
-        for (const auto& [id, entity] : entities) {
-            if (entity->type == 7 && !entity->hasTriggeredEffect) {
-                _screenShakeIntensity = 8.0f;
-                _screenShakeTimer = 0.1f;
-                entity->hasTriggeredEffect = true;
-            }
-        }
+    if (_gameState && _gameState->consumeScreenShake()) {
+        _screenShakeIntensity = 8.0f;
+        _screenShakeTimer = 0.1f;
     }
 }
 
@@ -314,7 +356,7 @@ void Game::render()
     if (filterTexture) {
         _colorBlindFilter.beginCapture();
         _graphics.setRenderTarget(filterTexture);
-    } else {
+    } else if (!_renderThread) {
         _window.clear(0, 0, 0);
     }
 
@@ -346,13 +388,12 @@ void Game::render()
     }
 
     if (_gameState) {
+        using Layer = rtype::RenderQueue::Layer;
         const auto& entities = _gameState->getAllEntities();
+        _renderQueue.begin(static_cast<float>(winW), static_cast<float>(winH));
 
         for (const auto& [id, entity] : entities) {
-            if (!entity || entity->type == 7) continue;
-
-            rtype::ISprite* spriteToRender = entity->sprite.get();
-
+            rtype::SpriteSFML* spriteToRender = entity->sprite.get();
             if (!spriteToRender) continue;
 
             try {
@@ -364,7 +405,7 @@ void Game::render()
                 float sy = entity->y * windowScale + offsetY;
 
                 spriteToRender->setPosition(sx, sy);
-                _graphics.drawSprite(*spriteToRender);
+                _renderQueue.push(Layer::WORLD, *spriteToRender);
 
                 if (entity->type == 1 && entity->hasShield &&
                     entity->shieldSprite) {
@@ -384,7 +425,7 @@ void Game::render()
                     entity->shieldSprite->setPosition(
                         offsetShieldX - 90.0f * windowScale,
                         offsetShieldY - 100.0f * windowScale);
-                    _graphics.drawSprite(*entity->shieldSprite);
+                    _renderQueue.push(Layer::EFFECTS, *entity->shieldSprite);
                 }
 
                 if (entity->type == 1 && entity->hasSpeedBoost &&
@@ -408,7 +449,7 @@ void Game::render()
                         arrow->setPosition(offsetX + (arrowX * windowScale),
                                            offsetY + (arrowY * windowScale));
 
-                        _graphics.drawSprite(*arrow);
+                        _renderQueue.push(Layer::EFFECTS, *arrow);
                     }
                 }
 
@@ -431,12 +472,16 @@ void Game::render()
                         float hbW = hitboxWidth * windowScale;
                         float hbH = hitboxHeight * windowScale;
 
-                        _graphics.drawRectangle(hbX, hbY, hbW, 2.0f, 255, 0, 0);
-                        _graphics.drawRectangle(hbX, hbY + hbH - 2.0f, hbW,
-                                                2.0f, 255, 0, 0);
-                        _graphics.drawRectangle(hbX, hbY, 2.0f, hbH, 255, 0, 0);
-                        _graphics.drawRectangle(hbX + hbW - 2.0f, hbY, 2.0f,
-                                                hbH, 255, 0, 0);
+                        _renderQueue.pushRectangle(Layer::DEBUG, hbX, hbY, hbW,
+                                                   2.0f, 255, 0, 0, 255);
+                        _renderQueue.pushRectangle(Layer::DEBUG, hbX,
+                                                   hbY + hbH - 2.0f, hbW, 2.0f,
+                                                   255, 0, 0, 255);
+                        _renderQueue.pushRectangle(Layer::DEBUG, hbX, hbY, 2.0f,
+                                                   hbH, 255, 0, 0, 255);
+                        _renderQueue.pushRectangle(Layer::DEBUG,
+                                                   hbX + hbW - 2.0f, hbY, 2.0f,
+                                                   hbH, 255, 0, 0, 255);
                     }
                 }
             } catch (const std::exception& e) {
@@ -445,36 +490,16 @@ void Game::render()
             }
         }
 
-        for (const auto& [id, entity] : entities) {
-            if (!entity || entity->type != 7) continue;
-
-            if (entity->animFrameCount > 0 &&
-                entity->animCurrentFrame >= entity->animFrameCount) {
-                continue;
-            }
-
-            rtype::ISprite* spriteToRender = entity->sprite.get();
-            if (!spriteToRender) continue;
-
-            try {
-                float baseScale = 1.0f;
-                if (entity->spriteScale > 0.0f) baseScale = entity->spriteScale;
-                spriteToRender->setScale(baseScale * windowScale,
-                                         baseScale * windowScale);
-                float sx = entity->x * windowScale + offsetX;
-                float sy = entity->y * windowScale + offsetY;
-
-                spriteToRender->setPosition(sx, sy);
-                _graphics.drawSprite(*spriteToRender);
-            } catch (const std::exception& e) {
-                std::cerr << "Exception while rendering entity with id " << id
-                          << ": " << e.what() << std::endl;
-            }
-        }
-
+        rtype::ISpriteBatch& batch = _graphics.getSpriteBatch();
+        batch.begin();
+        _renderQueue.submit(batch);
         _gameState->render(_graphics, windowScale, offsetX, offsetY);
+        batch.end();
     }
 
+    rtype::ISpriteBatch& hud = _graphics.getSpriteBatch();
+    hud.begin();
+
     if (_gameState) {
         float health = _gameState->getPlayerHealth();
         float maxHealth = _gameState->getPlayerMaxHealth();
@@ -484,7 +509,7 @@ void Game::render()
         float barX = 20.0f * _scale;
         float barY = _window.getHeight() - 50.0f * _scale;
 
-        _graphics.drawRectangle(barX, barY, barWidth, barHeight, 0, 0, 0);
+        hud.drawRectangle(barX, barY, barWidth, barHeight, 0, 0, 0, 255);
 
         float healthPercent = health / maxHealth;
         float healthBarWidth = barWidth * healthPercent;
@@ -500,15 +525,15 @@ void Game::render()
             b = 0;
         }
 
-        _graphics.drawRectangle(barX, barY, healthBarWidth, barHeight, r, g, b);
+        hud.drawRectangle(barX, barY, healthBarWidth, barHeight, r, g, b, 255);
 
-        _graphics.drawRectangle(barX - 2, barY - 2, barWidth + 4, 2, 255, 255,
-                                255);
-        _graphics.drawRectangle(barX - 2, barY + barHeight, barWidth + 4, 2,
-                                255, 255, 255);
-        _graphics.drawRectangle(barX - 2, barY, 2, barHeight, 255, 255, 255);
-        _graphics.drawRectangle(barX + barWidth, barY, 2, barHeight, 255, 255,
-                                255);
+        hud.drawRectangle(barX - 2, barY - 2, barWidth + 4, 2, 255, 255, 255,
+                          255);
+        hud.drawRectangle(barX - 2, barY + barHeight, barWidth + 4, 2, 255,
+                          255, 255, 255);
+        hud.drawRectangle(barX - 2, barY, 2, barHeight, 255, 255, 255, 255);
+        hud.drawRectangle(barX + barWidth, barY, 2, barHeight, 255, 255, 255,
+                          255);
     }
 
     if (_gameState) {
@@ -521,7 +546,7 @@ void Game::render()
             float barX = (_window.getWidth() - barWidth) / 2.0f;
             float barY = 20.0f * _scale;
 
-            _graphics.drawRectangle(barX, barY, barWidth, barHeight, 0, 0, 0);
+            hud.drawRectangle(barX, barY, barWidth, barHeight, 0, 0, 0, 255);
 
             float healthPercent = bossHealth / bossMaxHealth;
             float healthBarWidth = barWidth * healthPercent;
@@ -530,20 +555,21 @@ void Game::render()
             int g = healthPercent < 0.3f ? 50 : 0;
             int b = 0;
 
-            _graphics.drawRectangle(barX, barY, healthBarWidth, barHeight, r, g,
-                                    b);
-
-            _graphics.drawRectangle(barX - 2, barY - 2, barWidth + 4, 2, 255,
-                                    255, 255);
-            _graphics.drawRectangle(barX - 2, barY + barHeight, barWidth + 4, 2,
-                                    255, 255, 255);
-            _graphics.drawRectangle(barX - 2, barY, 2, barHeight, 255, 255,
-                                    255);
-            _graphics.drawRectangle(barX + barWidth, barY, 2, barHeight, 255,
-                                    255, 255);
+            hud.drawRectangle(barX, barY, healthBarWidth, barHeight, r, g, b,
+                              255);
+
+            hud.drawRectangle(barX - 2, barY - 2, barWidth + 4, 2, 255, 255,
+                              255, 255);
+            hud.drawRectangle(barX - 2, barY + barHeight, barWidth + 4, 2, 255,
+                              255, 255, 255);
+            hud.drawRectangle(barX - 2, barY, 2, barHeight, 255, 255, 255, 255);
+            hud.drawRectangle(barX + barWidth, barY, 2, barHeight, 255, 255,
+                              255, 255);
         }
     }
 
+    hud.end();
+
     std::string fpsStr = "FPS: " + std::to_string(_currentFps);
     _graphics.drawText(fpsStr, 10 * _scale, 10 * _scale,
                        static_cast<unsigned int>(20 * _scale), 0, 255, 0,
@@ -591,7 +617,9 @@ void Game::render()
         _connectionDialog->render(_scale, "assets/fonts/default.ttf");
     }
 
-    _window.display();
+    if (!_renderThread) {
+        _window.display();
+    }
 }
 
 void Game::updateFps(float deltaTime)
@@ -13,9 +13,11 @@
 #include "../ConnectionDialog.hpp"
 #include "../network/ClientGameState.hpp"
 #include "../wrapper/graphics/GraphicsSFML.hpp"
+#include "../wrapper/graphics/RenderThreadSFML.hpp"
 #include "../wrapper/input/InputSFML.hpp"
 #include "../wrapper/window/WindowSFML.hpp"
 #include "Background.hpp"
+#include "RenderQueue.hpp"
 
 /**
  * @brief Main game class - Game loop, update, render (uses the wrapper)
@@ -35,6 +37,7 @@ class Game {
     void handleEvents();
     void update(float deltaTime);
     void render();
+    void renderFrame();
     void updateFps(float deltaTime);
     bool tryConnect(const std::string& address, uint16_t port);
     void updateMusicBasedOnGameState();
@@ -47,6 +50,8 @@ class Game {
     bool _returnToMenu;
 
     std::unique_ptr<rtype::ClientGameState> _gameState;
+    std::unique_ptr<rtype::RenderThreadSFML> _renderThread;
+    rtype::RenderQueue _renderQueue;
     std::shared_ptr<Background> _background;
     rtype::ColorBlindFilter& _colorBlindFilter;
 
@@ -58,7 +63,7 @@ class Game {
     int _currentFps;
     float _scale;
     std::chrono::steady_clock::time_point _lastShootTime;
-    std::chrono::steady_clock::time_point _lastInputTime;
+    std::chrono::steady_clock::time_point _nextInputTime;
 
     float _screenShakeIntensity;
     float _screenShakeTimer;
@@ -0,0 +1,95 @@
+/*
+** EPITECH PROJECT, 2025
+** r-type
+** File description:
+** ParticlePool
+*/
+
+#include "ParticlePool.hpp"
+
+#include <cmath>
+
+namespace rtype {
+
+ParticlePool::ParticlePool(std::span<const ParticleEmitter> emitters,
+                           size_t capacity)
+    : _emitters(emitters),
+      _x(capacity),
+      _y(capacity),
+      _vx(capacity),
+      _vy(capacity),
+      _age(capacity),
+      _effect(capacity)
+{
+}
+
+void ParticlePool::emit(uint8_t effect, float x, float y)
+{
+    const ParticleEmitter& emitter = _emitters[effect];
+
+    int burst = emitter.burstCount;
+    if (_count >= capacity() * 3 / 4) {
+        burst = 1;
+    }
+
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    for (int i = 0; i < burst && _count < capacity(); ++i) {
+        float px = x;
+        float py = y;
+        float vx = 0.0f;
+        float vy = 0.0f;
+        if (emitter.burstCount > 1) {
+            float angle = unit(_random) * 6.2831853f;
+            float distance = unit(_random) * emitter.spread;
+            float speed = emitter.minSpeed +
+                          unit(_random) * (emitter.maxSpeed - emitter.minSpeed);
+            px += std::cos(angle) * distance;
+            py += std::sin(angle) * distance;
+            vx = std::cos(angle) * speed;
+            vy = std::sin(angle) * speed;
+        }
+        spawn(effect, px, py, vx, vy);
+    }
+}
+
+void ParticlePool::spawn(uint8_t effect, float x, float y, float vx, float vy)
+{
+    _x[_count] = x;
+    _y[_count] = y;
+    _vx[_count] = vx;
+    _vy[_count] = vy;
+    _age[_count] = 0.0f;
+    _effect[_count] = effect;
+    _count++;
+}
+
+void ParticlePool::kill(size_t index)
+{
+    size_t last = --_count;
+    _x[index] = _x[last];
+    _y[index] = _y[last];
+    _vx[index] = _vx[last];
+    _vy[index] = _vy[last];
+    _age[index] = _age[last];
+    _effect[index] = _effect[last];
+}
+
+void ParticlePool::update(float deltaTime)
+{
+    for (size_t i = 0; i < _count; ++i) {
+        _age[i] += deltaTime;
+        _x[i] += _vx[i] * deltaTime;
+        _y[i] += _vy[i] * deltaTime;
+    }
+
+    size_t i = 0;
+    while (i < _count) {
+        if (_age[i] >= _emitters[_effect[i]].getLifetime()) {
+            kill(i);
+        } else {
+            ++i;
+        }
+    }
+}
+
+}  // namespace rtype
@@ -0,0 +1,88 @@
+/*
+** EPITECH PROJECT, 2025
+** r-type
+** File description:
+** ParticlePool
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <vector>
+
+namespace rtype {
+
+/**
+ * @brief How the particles of one effect are spawned and how long they live
+ */
+struct ParticleEmitter {
+    int frameCount;
+    float frameDuration;
+    int burstCount;  ///< Particles per emit()
+    float spread;    ///< Max random offset from the emit position
+    float minSpeed;  ///< Random speed range, in a random direction
+    float maxSpeed;
+
+    float getLifetime() const { return frameDuration * frameCount; }
+};
+
+/**
+ * @brief Fixed-capacity particle storage, without any visuals
+ *
+ * Particles live in parallel arrays (structure of arrays) that are
+ * allocated once; dead particles are swap-removed so the live ones stay
+ * packed in [0, size()).
+ *
+ * Past three quarters of the capacity, bursts shrink to their first
+ * particle, and once full new particles are dropped.
+ */
+class ParticlePool {
+   public:
+    /**
+     * @param emitters Emitter of each effect, indexed by emit()'s effect;
+     * must outlive the pool
+     * @param capacity Maximum number of live particles
+     */
+    ParticlePool(std::span<const ParticleEmitter> emitters, size_t capacity);
+
+    /**
+     * @brief Spawn an effect's burst at a map position
+     */
+    void emit(uint8_t effect, float x, float y);
+
+    /**
+     * @brief Age and move every particle, then remove the expired ones
+     */
+    void update(float deltaTime);
+
+    void clear() { _count = 0; }
+    size_t size() const { return _count; }
+    size_t capacity() const { return _x.size(); }
+
+    float getX(size_t index) const { return _x[index]; }
+    float getY(size_t index) const { return _y[index]; }
+    float getAge(size_t index) const { return _age[index]; }
+    uint8_t getEffect(size_t index) const { return _effect[index]; }
+
+   private:
+    void spawn(uint8_t effect, float x, float y, float vx, float vy);
+    void kill(size_t index);
+
+    std::span<const ParticleEmitter> _emitters;
+
+    // Live particles are [0, _count) in every array
+    std::vector<float> _x;
+    std::vector<float> _y;
+    std::vector<float> _vx;
+    std::vector<float> _vy;
+    std::vector<float> _age;
+    std::vector<uint8_t> _effect;
+    size_t _count = 0;
+
+    std::minstd_rand _random;
+};
+
+}  // namespace rtype
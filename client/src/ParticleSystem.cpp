@@ -0,0 +1,84 @@
+/*
+** EPITECH PROJECT, 2025
+** r-type
+** File description:
+** ParticleSystem
+*/
+
+#include "ParticleSystem.hpp"
+
+#include "../wrapper/resources/EmbeddedResources.hpp"
+
+namespace rtype {
+
+const std::array<ParticleEmitter,
+                 static_cast<size_t>(ParticleSystem::Effect::COUNT)>&
+ParticleSystem::getEmitters()
+{
+    static const std::array<ParticleEmitter,
+                            static_cast<size_t>(Effect::COUNT)>
+        emitters = {{
+            {6, 0.08f, 1, 0.0f, 0.0f, 0.0f},
+            {8, 0.08f, 1, 0.0f, 0.0f, 0.0f},
+            {8, 0.06f, 5, 48.0f, 20.0f, 80.0f},
+        }};
+    return emitters;
+}
+
+const std::array<ParticleSystem::EffectVisual,
+                 static_cast<size_t>(ParticleSystem::Effect::COUNT)>&
+ParticleSystem::getVisuals()
+{
+    static const std::array<EffectVisual, static_cast<size_t>(Effect::COUNT)>
+        visuals = {{
+            {ASSET_SPAN(embedded::blowup_1_data), 32, 32, 2.0f},
+            {ASSET_SPAN(embedded::blowup_2_data), 64, 64, 4.0f},
+            {ASSET_SPAN(embedded::blowup_2_data), 64, 64, 2.0f},
+        }};
+    return visuals;
+}
+
+ParticleSystem::ParticleSystem() : _pool(getEmitters(), MAX_PARTICLES)
+{
+    const auto& visuals = getVisuals();
+    for (size_t i = 0; i < visuals.size(); ++i) {
+        _stamps[i] = std::make_unique<SpriteSFML>();
+        if (_stamps[i]->loadTexture(visuals[i].texture)) {
+            _stamps[i]->setSmooth(false);
+        }
+    }
+}
+
+void ParticleSystem::emit(Effect effect, float x, float y)
+{
+    _pool.emit(static_cast<uint8_t>(effect), x, y);
+}
+
+void ParticleSystem::draw(ISpriteBatch& batch, float windowScale,
+                          float offsetX, float offsetY)
+{
+    const auto& emitters = getEmitters();
+    const auto& visuals = getVisuals();
+
+    for (size_t i = 0; i < _pool.size(); ++i) {
+        uint8_t effect = _pool.getEffect(i);
+        const ParticleEmitter& emitter = emitters[effect];
+        const EffectVisual& visual = visuals[effect];
+        SpriteSFML& stamp = *_stamps[effect];
+
+        int frame = static_cast<int>(_pool.getAge(i) / emitter.frameDuration);
+        if (frame >= emitter.frameCount) {
+            frame = emitter.frameCount - 1;
+        }
+        float scale = visual.scale * windowScale;
+
+        stamp.setTextureRect(frame * visual.frameWidth, 0, visual.frameWidth,
+                             visual.frameHeight);
+        stamp.setScale(scale, scale);
+        stamp.setPosition(_pool.getX(i) * windowScale + offsetX,
+                          _pool.getY(i) * windowScale + offsetY);
+        batch.draw(stamp);
+    }
+}
+
+}  // namespace rtype
@@ -0,0 +1,82 @@
+/*
+** EPITECH PROJECT, 2025
+** r-type
+** File description:
+** ParticleSystem
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+
+#include "../wrapper/graphics/SpriteBatch.hpp"
+#include "../wrapper/graphics/SpriteSFML.hpp"
+#include "ParticlePool.hpp"
+
+namespace rtype {
+
+/**
+ * @brief Pooled flipbook particles for explosions and other effects
+ *
+ * The particles themselves live in a ParticlePool capped at MAX_PARTICLES.
+ * Each effect type has an emitter configuration and one stamp sprite:
+ * drawing a particle only moves the stamp and queues it in the sprite
+ * batch, so all particles sharing a texture go out in one draw call.
+ */
+class ParticleSystem {
+   public:
+    enum class Effect : uint8_t {
+        SMALL_EXPLOSION,  ///< Projectile hit
+        LARGE_EXPLOSION,  ///< Ship destroyed
+        BOSS_EXPLOSION,   ///< One blast of a boss death sequence
+        COUNT,
+    };
+
+    static constexpr size_t MAX_PARTICLES = 1024;
+
+    ParticleSystem();
+
+    /**
+     * @brief Spawn an effect's burst at a map position
+     */
+    void emit(Effect effect, float x, float y);
+
+    void update(float deltaTime) { _pool.update(deltaTime); }
+
+    /**
+     * @brief Queue every live particle in an open sprite batch
+     */
+    void draw(ISpriteBatch& batch, float windowScale, float offsetX,
+              float offsetY);
+
+    void clear() { _pool.clear(); }
+    size_t getParticleCount() const { return _pool.size(); }
+
+   private:
+    /**
+     * @brief How an effect's particles look
+     */
+    struct EffectVisual {
+        std::span<const std::byte> texture;
+        int frameWidth;
+        int frameHeight;
+        float scale;
+    };
+
+    static const std::array<ParticleEmitter,
+                            static_cast<size_t>(Effect::COUNT)>&
+    getEmitters();
+    static const std::array<EffectVisual, static_cast<size_t>(Effect::COUNT)>&
+    getVisuals();
+
+    ParticlePool _pool;
+    std::array<std::unique_ptr<SpriteSFML>,
+               static_cast<size_t>(Effect::COUNT)>
+        _stamps;
+};
+
+}  // namespace rtype
@@ -0,0 +1,105 @@
+/*
+** EPITECH PROJECT, 2025
+** r-type
+** File description:
+** RenderQueue
+*/
+
+#include "RenderQueue.hpp"
+
+#include <algorithm>
+#include <functional>
+
+namespace rtype {
+
+void RenderQueue::begin(float viewWidth, float viewHeight)
+{
+    _items.clear();
+    _viewWidth = viewWidth;
+    _viewHeight = viewHeight;
+    _culled = 0;
+}
+
+bool RenderQueue::isVisible(float x, float y, float width, float height) const
+{
+    return x < _viewWidth && y < _viewHeight && x + width > 0.0f &&
+           y + height > 0.0f;
+}
+
+bool RenderQueue::push(Layer layer, const SpriteSFML& sprite)
+{
+    sf::FloatRect bounds = sprite.getGlobalBounds();
+    if (!isVisible(bounds.left, bounds.top, bounds.width, bounds.height)) {
+        _culled++;
+        return false;
+    }
+
+    Item item{};
+    item.layer = layer;
+    item.order = static_cast<uint32_t>(_items.size());
+    item.texture = sprite.getSFMLSprite().getTexture();
+    item.sprite = &sprite;
+    _items.push_back(item);
+    return true;
+}
+
+bool RenderQueue::pushRectangle(Layer layer, float x, float y, float width,
+                                float height, unsigned char r,
+                                unsigned char g, unsigned char b,
+                                unsigned char a)
+{
+    if (!isVisible(x, y, width, height)) {
+        _culled++;
+        return false;
+    }
+
+    Item item{};
+    item.layer = layer;
+    item.order = static_cast<uint32_t>(_items.size());
+    item.x = x;
+    item.y = y;
+    item.width = width;
+    item.height = height;
+    item.r = r;
+    item.g = g;
+    item.b = b;
+    item.a = a;
+    _items.push_back(item);
+    return true;
+}
+
+void RenderQueue::submit(ISpriteBatch& batch)
+{
+    // std::sort on a unique key instead of std::stable_sort, which may
+    // allocate a scratch buffer every frame
+    std::sort(_items.begin(), _items.end(),
+              [](const Item& lhs, const Item& rhs) {
+                  if (lhs.layer != rhs.layer) {
+                      return lhs.layer < rhs.layer;
+                  }
+                  if (lhs.texture != rhs.texture) {
+                      return std::less<const void*>()(lhs.texture,
+                                                      rhs.texture);
+                  }
+                  return lhs.order < rhs.order;
+              });
+
+    // The batch groups quads by texture across the whole batch: a layer
+    // must be submitted before the next one starts, or a texture first used
+    // in a lower layer would pull later quads under the ones in between
+    for (size_t i = 0; i < _items.size(); ++i) {
+        const Item& item = _items[i];
+        if (i > 0 && item.layer != _items[i - 1].layer) {
+            batch.end();
+            batch.begin();
+        }
+        if (item.sprite) {
+            batch.draw(*item.sprite);
+        } else {
+            batch.drawRectangle(item.x, item.y, item.width, item.height,
+                                item.r, item.g, item.b, item.a);
+        }
+    }
+}
+
+}  // namespace rtype
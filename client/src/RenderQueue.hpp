@@ -0,0 +1,89 @@
+/*
+** EPITECH PROJECT, 2025
+** r-type
+** File description:
+** RenderQueue
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "../wrapper/graphics/SpriteBatch.hpp"
+#include "../wrapper/graphics/SpriteSFML.hpp"
+
+namespace rtype {
+
+/**
+ * @brief Per-frame list of world draws, culled and sorted before batching
+ *
+ * Sprites and rectangles entirely outside the viewport are dropped when
+ * pushed. submit() then orders what is left by layer, then texture, keeping
+ * push order inside a texture, so each layer opens as few batch groups as
+ * possible. Each layer is a batch of its own, drawn above the previous one.
+ * The item storage is kept between frames.
+ */
+class RenderQueue {
+   public:
+    /**
+     * @brief Draw layers, lowest first
+     */
+    enum class Layer : uint8_t {
+        WORLD,    ///< Ships, enemies, projectiles, items
+        EFFECTS,  ///< Shields and speed arrows over their ship
+        DEBUG,    ///< Hitbox outlines
+    };
+
+    /**
+     * @brief Start a new frame
+     * @param viewWidth Width of the visible area in pixels
+     * @param viewHeight Height of the visible area in pixels
+     */
+    void begin(float viewWidth, float viewHeight);
+
+    /**
+     * @brief Queue a sprite with its current transform
+     * @return false if it is off screen and was culled
+     */
+    bool push(Layer layer, const SpriteSFML& sprite);
+
+    /**
+     * @brief Queue a filled rectangle
+     * @return false if it is off screen and was culled
+     */
+    bool pushRectangle(Layer layer, float x, float y, float width,
+                       float height, unsigned char r, unsigned char g,
+                       unsigned char b, unsigned char a);
+
+    /**
+     * @brief Sort the queued items and draw them into an open batch
+     *
+     * The batch is ended and begun again between layers, so it is left
+     * open on the last layer.
+     */
+    void submit(ISpriteBatch& batch);
+
+    size_t getQueuedCount() const { return _items.size(); }
+    size_t getCulledCount() const { return _culled; }
+
+   private:
+    struct Item {
+        Layer layer;
+        uint32_t order;             ///< Push order, keeps the sort stable
+        const void* texture;        ///< Sort key, nullptr for rectangles
+        const SpriteSFML* sprite;   ///< nullptr for rectangles
+        float x, y, width, height;  ///< Rectangle only
+        unsigned char r, g, b, a;   ///< Rectangle only
+    };
+
+    bool isVisible(float x, float y, float width, float height) const;
+
+    std::vector<Item> _items;
+    float _viewWidth = 0.0f;
+    float _viewHeight = 0.0f;
+    size_t _culled = 0;
+};
+
+}  // namespace rtype
@@ -20,7 +20,10 @@ ReplayViewer::ReplayViewer(rtype::WindowSFML& window,
       _graphics(graphics),
       _running(false),
       _returnToMenu(false),
-      _colorBlindFilter(rtype::ColorBlindFilter::getInstance())
+      _colorBlindFilter(rtype::ColorBlindFilter::getInstance()),
+      _snapshots(SNAPSHOT_COUNT),
+      _snapshotStart(0),
+      _snapshotCount(0)
 {
     float windowWidth = static_cast<float>(_window.getWidth());
     float windowHeight = static_cast<float>(_window.getHeight());
@@ -33,6 +36,12 @@ ReplayViewer::ReplayViewer(rtype::WindowSFML& window,
         windowHeight);
 
     _gameState = std::make_unique<rtype::ClientGameState>();
+    rtype::Config& config = rtype::Config::getInstance();
+    _gameState->setInterpolation(
+        config.getFloat("interpolationDelayMs", 100.0f) / 1000.0f,
+        config.getString("interpolation", "hermite") == "linear"
+            ? rtype::InterpolationMode::Linear
+            : rtype::InterpolationMode::Hermite);
 
     _replayPlayer = std::make_unique<rtype::ReplayPlayer>(replayPath);
     if (!_replayPlayer->load()) {
@@ -51,6 +60,7 @@ ReplayViewer::ReplayViewer(rtype::WindowSFML& window,
 
     _replayControls = std::make_unique<rtype::ReplayControls>(
         window, graphics, input, *_replayPlayer);
+    _replayControls->setSeekCallback([this](float seconds) { seek(seconds); });
 
     std::cout << "[ReplayViewer] Loaded replay: "
               << _replayPlayer->getReplayName() << std::endl;
@@ -113,7 +123,8 @@ void ReplayViewer::update(float deltaTime)
     }
 
     if (_replayPlayer && _gameState) {
-        bool isSeeking = _replayPlayer->isSeeking();
+        bool isSeeking = _replayPlayer->isSeeking() ||
+                         _replayPlayer->isFastForwarding();
         _gameState->setSeekingMode(isSeeking);
     }
 
@@ -138,6 +149,71 @@ void ReplayViewer::update(float deltaTime)
     if (_gameState) {
         _gameState->update(deltaTime);
     }
+
+    if (_replayPlayer && _gameState) {
+        saveSnapshot();
+    }
+}
+
+void ReplayViewer::saveSnapshot()
+{
+    uint64_t now = _replayPlayer->getCurrentTime();
+    if (_snapshotCount > 0) {
+        const RewindSnapshot& newest =
+            _snapshots[(_snapshotStart + _snapshotCount - 1) % SNAPSHOT_COUNT];
+        if (now < newest.checkpoint.time + SNAPSHOT_INTERVAL_MS) {
+            return;
+        }
+    }
+
+    // Once full, the oldest slot is overwritten and its storage reused
+    size_t slot = (_snapshotStart + _snapshotCount) % SNAPSHOT_COUNT;
+    if (_snapshotCount < SNAPSHOT_COUNT) {
+        _snapshotCount++;
+    } else {
+        _snapshotStart = (_snapshotStart + 1) % SNAPSHOT_COUNT;
+    }
+    _replayPlayer->saveCheckpoint(_snapshots[slot].checkpoint);
+    _gameState->saveSnapshot(_snapshots[slot].client);
+}
+
+void ReplayViewer::seek(float seconds)
+{
+    if (seconds >= 0.0f) {
+        _replayPlayer->seek(seconds);
+        return;
+    }
+
+    int64_t target = static_cast<int64_t>(_replayPlayer->getCurrentTime()) +
+                     static_cast<int64_t>(seconds * 1000.0f);
+    uint64_t targetTime = target > 0 ? static_cast<uint64_t>(target) : 0;
+
+    // Snapshots past the target would be taken again while playing
+    while (_snapshotCount > 0 &&
+           _snapshots[(_snapshotStart + _snapshotCount - 1) % SNAPSHOT_COUNT]
+                   .checkpoint.time > targetTime) {
+        _snapshotCount--;
+    }
+
+    // A keyframe of the file closer to the target replays fewer packets
+    if (_snapshotCount == 0) {
+        _replayPlayer->seek(seconds);
+        return;
+    }
+    const RewindSnapshot& snapshot =
+        _snapshots[(_snapshotStart + _snapshotCount - 1) % SNAPSHOT_COUNT];
+    if (snapshot.checkpoint.time <
+        _replayPlayer->getSeekStartTime(targetTime)) {
+        _replayPlayer->seek(seconds);
+        return;
+    }
+
+    std::cout << "[ReplayViewer] Rewinding to " << targetTime
+              << "ms from the snapshot at " << snapshot.checkpoint.time << "ms"
+              << std::endl;
+    _gameState->setSeekingMode(true);
+    _gameState->restoreSnapshot(snapshot.client);
+    _replayPlayer->seekFromCheckpoint(snapshot.checkpoint, targetTime);
 }
 
 void ReplayViewer::render()
@@ -165,12 +241,12 @@ void ReplayViewer::render()
         float offsetX = (winW - mapWidth * windowScale) / 2.0f;
         float offsetY = (winH - mapHeight * windowScale) / 2.0f;
 
+        using Layer = rtype::RenderQueue::Layer;
         const auto& entities = _gameState->getAllEntities();
+        _renderQueue.begin(winW, winH);
 
         for (const auto& [id, entity] : entities) {
-            if (!entity || entity->type == 7) continue;
-
-            rtype::ISprite* spriteToRender = entity->sprite.get();
+            rtype::SpriteSFML* spriteToRender = entity->sprite.get();
             if (!spriteToRender) continue;
 
             try {
@@ -184,7 +260,7 @@ void ReplayViewer::render()
                 float sy = entity->y * windowScale + offsetY;
 
                 spriteToRender->setPosition(sx, sy);
-                _graphics.drawSprite(*spriteToRender);
+                _renderQueue.push(Layer::WORLD, *spriteToRender);
 
                 if (entity->type == 1 && entity->hasShield &&
                     entity->shieldSprite) {
@@ -204,7 +280,7 @@ void ReplayViewer::render()
                     entity->shieldSprite->setPosition(
                         offsetShieldX - 90.0f * windowScale,
                         offsetShieldY - 100.0f * windowScale);
-                    _graphics.drawSprite(*entity->shieldSprite);
+                    _renderQueue.push(Layer::EFFECTS, *entity->shieldSprite);
                 }
             } catch (const std::exception& e) {
                 std::cerr << "[ERROR] Exception while drawing entity ID " << id
@@ -212,31 +288,11 @@ void ReplayViewer::render()
             }
         }
 
-        for (const auto& [id, entity] : entities) {
-            if (!entity || entity->type != 7) continue;
-
-            rtype::ISprite* spriteToRender = entity->sprite.get();
-            if (!spriteToRender) continue;
-
-            try {
-                float baseScale = 1.0f;
-                if (entity->spriteScale > 0.0f) {
-                    baseScale = entity->spriteScale;
-                }
-                spriteToRender->setScale(baseScale * windowScale,
-                                         baseScale * windowScale);
-                float sx = entity->x * windowScale + offsetX;
-                float sy = entity->y * windowScale + offsetY;
-
-                spriteToRender->setPosition(sx, sy);
-                _graphics.drawSprite(*spriteToRender);
-            } catch (const std::exception& e) {
-                std::cerr << "[ERROR] Exception while drawing explosion ID "
-                          << id << ": " << e.what() << std::endl;
-            }
-        }
-
+        rtype::ISpriteBatch& batch = _graphics.getSpriteBatch();
+        batch.begin();
+        _renderQueue.submit(batch);
         _gameState->render(_graphics, windowScale, offsetX, offsetY);
+        batch.end();
     }
 
     if (_replayControls) {
@@ -255,6 +311,11 @@ void ReplayViewer::processReplayPacket(const void* data, size_t)
         return;
     }
 
+    // Packets fed by a seek or a coalesced fast-forward frame must not
+    // spawn effects
+    _gameState->setSeekingMode(_replayPlayer->isSeeking() ||
+                               _replayPlayer->isFastForwarding());
+
     const Header* header = static_cast<const Header*>(data);
 
     switch (header->opCode) {
@@ -286,7 +347,12 @@ void ReplayViewer::processReplayPacket(const void* data, size_t)
             _gameState->processEntityDead(packet->entityId);
             break;
         }
-        case S2C_SCORE_UPDATE:
+        case S2C_SCORE_UPDATE: {
+            const ScoreUpdatePacket* packet =
+                static_cast<const ScoreUpdatePacket*>(data);
+            _gameState->processScoreUpdate(packet->score);
+            break;
+        }
         case S2C_BOSS_SPAWN:
         case S2C_BOSS_STATE:
         case S2C_BOSS_DEATH:
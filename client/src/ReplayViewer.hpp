@@ -7,7 +7,9 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <vector>
 
 #include "../ColorBlindFilter.hpp"
 #include "../ReplayControls.hpp"
@@ -16,6 +18,7 @@
 #include "../wrapper/input/InputSFML.hpp"
 #include "../wrapper/window/WindowSFML.hpp"
 #include "Background.hpp"
+#include "RenderQueue.hpp"
 #include "common/replay/ReplayPlayer.hpp"
 
 /**
@@ -23,6 +26,11 @@
  *
  * Loads a replay file and displays it using the game rendering system.
  * Provides playback controls for pausing, seeking, and speed adjustment.
+ *
+ * Every second of playback, the replay and game states are copied into a
+ * ring of in-memory snapshots. Rewinding restores the closest one before
+ * the target and replays at most a second of packets, instead of
+ * restarting from the previous keyframe of the file.
  */
 class ReplayViewer {
    public:
@@ -41,6 +49,19 @@ class ReplayViewer {
     void update(float deltaTime);
     void render();
     void processReplayPacket(const void* data, size_t size);
+    void saveSnapshot();
+    void seek(float seconds);
+
+    /**
+     * @brief Replay and game state at the same playback time
+     */
+    struct RewindSnapshot {
+        rtype::ReplayCheckpoint checkpoint;
+        rtype::ClientStateSnapshot client;
+    };
+
+    static constexpr uint64_t SNAPSHOT_INTERVAL_MS = 1000;
+    static constexpr size_t SNAPSHOT_COUNT = 64;
 
    private:
     rtype::WindowSFML& _window;
@@ -50,9 +71,15 @@ class ReplayViewer {
 
     std::unique_ptr<rtype::ReplayPlayer> _replayPlayer;
     std::unique_ptr<rtype::ClientGameState> _gameState;
+    rtype::RenderQueue _renderQueue;
     std::unique_ptr<rtype::ReplayControls> _replayControls;
     std::shared_ptr<Background> _background;
     rtype::ColorBlindFilter& _colorBlindFilter;
 
     float _scale;
+
+    // Ring of snapshots, oldest first, in increasing playback time
+    std::vector<RewindSnapshot> _snapshots;
+    size_t _snapshotStart;
+    size_t _snapshotCount;
 };
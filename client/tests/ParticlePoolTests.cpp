@@ -0,0 +1,103 @@
+/*
+** EPITECH PROJECT, 2025
+** r-type
+** File description:
+** ParticlePoolTests
+*/
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath>
+
+#include "client/src/ParticlePool.hpp"
+
+using namespace rtype;
+
+namespace {
+
+constexpr uint8_t SINGLE = 0;
+constexpr uint8_t BURST = 1;
+
+// SINGLE lives 0.5 s, BURST 1 s
+const std::array<ParticleEmitter, 2> EMITTERS = {{
+    {5, 0.1f, 1, 0.0f, 0.0f, 0.0f},
+    {10, 0.1f, 4, 20.0f, 10.0f, 50.0f},
+}};
+
+}  // namespace
+
+TEST(ParticlePoolTests, BurstsSpreadAroundTheEmitPosition)
+{
+    ParticlePool pool(EMITTERS, 64);
+    pool.emit(BURST, 100.0f, 200.0f);
+    ASSERT_EQ(pool.size(), 4u);
+
+    for (size_t i = 0; i < pool.size(); ++i) {
+        float distance =
+            std::hypot(pool.getX(i) - 100.0f, pool.getY(i) - 200.0f);
+        EXPECT_LE(distance, 20.0f + 1e-3f);
+        EXPECT_EQ(pool.getEffect(i), BURST);
+    }
+
+    // Particles move away at 10 to 50 pixels per second
+    float before = std::hypot(pool.getX(0) - 100.0f, pool.getY(0) - 200.0f);
+    pool.update(0.5f);
+    float after = std::hypot(pool.getX(0) - 100.0f, pool.getY(0) - 200.0f);
+    EXPECT_GE(after - before, 5.0f - 1e-3f);
+    EXPECT_LE(after - before, 25.0f + 1e-3f);
+}
+
+TEST(ParticlePoolTests, SingleParticlesStayPut)
+{
+    ParticlePool pool(EMITTERS, 64);
+    pool.emit(SINGLE, 10.0f, 20.0f);
+    ASSERT_EQ(pool.size(), 1u);
+    pool.update(0.2f);
+    EXPECT_FLOAT_EQ(pool.getX(0), 10.0f);
+    EXPECT_FLOAT_EQ(pool.getY(0), 20.0f);
+    EXPECT_FLOAT_EQ(pool.getAge(0), 0.2f);
+}
+
+TEST(ParticlePoolTests, BurstsShrinkPastThreeQuartersThenStopAtTheCap)
+{
+    ParticlePool pool(EMITTERS, 16);
+
+    // 3 full bursts reach three quarters of the capacity
+    for (int i = 0; i < 3; ++i) {
+        pool.emit(BURST, 0.0f, 0.0f);
+    }
+    EXPECT_EQ(pool.size(), 12u);
+
+    pool.emit(BURST, 0.0f, 0.0f);
+    EXPECT_EQ(pool.size(), 13u);
+
+    for (int i = 0; i < 10; ++i) {
+        pool.emit(BURST, 0.0f, 0.0f);
+    }
+    EXPECT_EQ(pool.size(), 16u);
+    EXPECT_EQ(pool.capacity(), 16u);
+}
+
+TEST(ParticlePoolTests, ExpiredParticlesAreRemovedAndTheRestStayPacked)
+{
+    ParticlePool pool(EMITTERS, 16);
+    pool.emit(SINGLE, 1.0f, 0.0f);
+    pool.emit(BURST, 2.0f, 0.0f);
+    pool.emit(SINGLE, 3.0f, 0.0f);
+    ASSERT_EQ(pool.size(), 6u);
+
+    pool.update(0.6f);
+    ASSERT_EQ(pool.size(), 4u);
+    for (size_t i = 0; i < pool.size(); ++i) {
+        EXPECT_EQ(pool.getEffect(i), BURST);
+        EXPECT_FLOAT_EQ(pool.getAge(i), 0.6f);
+    }
+
+    pool.update(0.5f);
+    EXPECT_EQ(pool.size(), 0u);
+
+    // Freed slots are reused
+    pool.emit(BURST, 0.0f, 0.0f);
+    EXPECT_EQ(pool.size(), 4u);
+}
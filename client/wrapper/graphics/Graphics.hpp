@@ -10,6 +10,7 @@
 #include <string>
 
 #include "Sprite.hpp"
+#include "SpriteBatch.hpp"
 
 namespace rtype {
 
@@ -110,6 +111,12 @@ class IGraphics {
      */
     virtual float getTextWidth(const std::string& text, unsigned int fontSize,
                                const std::string& fontPath) = 0;
+
+    /**
+     * @brief Get the batch used to draw many sprites in a few draw calls
+     * @return Batch drawing to the current target
+     */
+    virtual ISpriteBatch& getSpriteBatch() = 0;
 };
 
 }  // namespace rtype
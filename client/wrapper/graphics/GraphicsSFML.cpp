@@ -16,7 +16,7 @@
 namespace rtype {
 
 GraphicsSFML::GraphicsSFML(WindowSFML& window)
-    : _window(window), _renderTarget(nullptr)
+    : _window(window), _renderTarget(nullptr), _spriteBatch(*this)
 {
 }
 
@@ -25,11 +25,30 @@ void GraphicsSFML::setRenderTarget(IRenderTarget* renderTarget)
     _renderTarget = renderTarget;
 }
 
+sf::RenderTarget* GraphicsSFML::getSFMLTarget()
+{
+    if (_renderTarget) {
+        RenderTargetSFML* sfmlTarget =
+            dynamic_cast<RenderTargetSFML*>(_renderTarget);
+        if (sfmlTarget && sfmlTarget->getSFMLRenderTexture()) {
+            return sfmlTarget->getSFMLRenderTexture();
+        }
+        return nullptr;
+    }
+    return &_window.getSFMLWindow();
+}
+
+void GraphicsSFML::setRecording(RenderFrame* frame) { _recording = frame; }
+
+ISpriteBatch& GraphicsSFML::getSpriteBatch() { return _spriteBatch; }
+
 void GraphicsSFML::drawSprite(const ISprite& sprite)
 {
     const SpriteSFML* spriteSFML = dynamic_cast<const SpriteSFML*>(&sprite);
     if (spriteSFML) {
-        if (_renderTarget) {
+        if (_recording) {
+            _recording->addSprite(spriteSFML->getSFMLSprite());
+        } else if (_renderTarget) {
             RenderTargetSFML* sfmlTarget =
                 dynamic_cast<RenderTargetSFML*>(_renderTarget);
             if (sfmlTarget && sfmlTarget->getSFMLRenderTexture()) {
@@ -51,6 +70,11 @@ void GraphicsSFML::drawRectangle(float x, float y, float width, float height,
                                  unsigned char r, unsigned char g,
                                  unsigned char b)
 {
+    if (_recording) {
+        _recording->addRectangle(x, y, width, height, sf::Color(r, g, b));
+        return;
+    }
+
     sf::RectangleShape rectangle(sf::Vector2f(width, height));
     rectangle.setPosition(x, y);
     rectangle.setFillColor(sf::Color(r, g, b));
@@ -70,6 +94,11 @@ void GraphicsSFML::drawRectangle(float x, float y, float width, float height,
                                  unsigned char r, unsigned char g,
                                  unsigned char b, unsigned char a)
 {
+    if (_recording) {
+        _recording->addRectangle(x, y, width, height, sf::Color(r, g, b, a));
+        return;
+    }
+
     sf::RectangleShape rectangle(sf::Vector2f(width, height));
     rectangle.setPosition(x, y);
     rectangle.setFillColor(sf::Color(r, g, b, a));
@@ -88,6 +117,11 @@ void GraphicsSFML::drawRectangle(float x, float y, float width, float height,
 void GraphicsSFML::drawCircle(float x, float y, float radius, unsigned char r,
                               unsigned char g, unsigned char b)
 {
+    if (_recording) {
+        _recording->addCircle(x, y, radius, sf::Color(r, g, b));
+        return;
+    }
+
     sf::CircleShape circle(radius);
     circle.setPosition(x - radius, y - radius);
     circle.setFillColor(sf::Color(r, g, b));
@@ -123,6 +157,11 @@ void GraphicsSFML::drawText(const std::string& text, float x, float y,
                             unsigned char g, unsigned char b,
                             const std::string& fontPath)
 {
+    if (_recording) {
+        _recording->addText(text, x, y, fontSize, sf::Color(r, g, b));
+        return;
+    }
+
     sf::Font* font = loadFont(fontPath);
     if (!font) {
         std::cerr << "Warning: GraphicsSFML::drawText() - Failed to load font, "
@@ -154,6 +193,11 @@ void GraphicsSFML::drawText(const std::string& text, float x, float y,
                             unsigned char g, unsigned char b, unsigned char a,
                             const std::string& fontPath)
 {
+    if (_recording) {
+        _recording->addText(text, x, y, fontSize, sf::Color(r, g, b, a));
+        return;
+    }
+
     sf::Font* font = loadFont(fontPath);
     if (!font) {
         std::cerr << "Warning: GraphicsSFML::drawText() - Failed to load font, "
@@ -13,7 +13,9 @@
 #include <string>
 
 #include "Graphics.hpp"
+#include "RenderFrame.hpp"
 #include "RenderTarget.hpp"
+#include "SpriteBatchSFML.hpp"
 #include "SpriteSFML.hpp"
 
 namespace rtype {
@@ -51,6 +53,7 @@ class GraphicsSFML : public IGraphics {
                   const std::string& fontPath) override;
     float getTextWidth(const std::string& text, unsigned int fontSize,
                        const std::string& fontPath) override;
+    ISpriteBatch& getSpriteBatch() override;
 
     /**
      * @brief Set a render target as the draw target (for post-processing)
@@ -59,12 +62,31 @@ class GraphicsSFML : public IGraphics {
      */
     void setRenderTarget(IRenderTarget* renderTarget);
 
+    /**
+     * @brief Get the SFML target draws currently go to
+     * @return The render texture set with setRenderTarget(), else the window
+     */
+    sf::RenderTarget* getSFMLTarget();
+
+    /**
+     * @brief Record draws into a frame instead of drawing them
+     * @param frame Frame to append to, or nullptr to draw directly again
+     */
+    void setRecording(RenderFrame* frame);
+
+    /**
+     * @brief Get the frame draws are recorded into, nullptr if none
+     */
+    RenderFrame* getRecording() const { return _recording; }
+
    private:
     sf::Font* loadFont(const std::string& fontPath);
 
     WindowSFML& _window;
     IRenderTarget* _renderTarget;
+    RenderFrame* _recording = nullptr;
     mutable std::map<std::string, sf::Font> _fontCache;
+    SpriteBatchSFML _spriteBatch;
 };
 
 }  // namespace rtype
@@ -0,0 +1,126 @@
+/*
+** EPITECH PROJECT, 2025
+** r-type
+** File description:
+** RenderFrame
+*/
+
+#include "RenderFrame.hpp"
+
+#include <cmath>
+#include <cstdlib>
+
+namespace rtype {
+
+namespace {
+constexpr int CIRCLE_POINTS = 30;  ///< Same as sf::CircleShape's default
+}
+
+void RenderFrame::clear()
+{
+    _commands.clear();
+    _vertices.clear();
+    _texts.clear();
+}
+
+void RenderFrame::extendCommand(const sf::Texture* texture, size_t count)
+{
+    if (!_commands.empty() && _commands.back().count > 0 &&
+        _commands.back().texture == texture) {
+        _commands.back().count += count;
+        return;
+    }
+    _commands.push_back({texture, _vertices.size() - count, count});
+}
+
+void RenderFrame::addTriangles(const sf::Texture* texture,
+                               const sf::Vertex* vertices, size_t count)
+{
+    if (count == 0) {
+        return;
+    }
+    _vertices.insert(_vertices.end(), vertices, vertices + count);
+    extendCommand(texture, count);
+}
+
+void RenderFrame::appendQuad(const sf::Texture* texture,
+                             const sf::Vector2f corners[4],
+                             const sf::Vector2f texCoords[4], sf::Color color)
+{
+    static constexpr int TRIANGLES[6] = {0, 1, 2, 0, 2, 3};
+    for (int index : TRIANGLES) {
+        _vertices.emplace_back(corners[index], color, texCoords[index]);
+    }
+    extendCommand(texture, 6);
+}
+
+void RenderFrame::addSprite(const sf::Sprite& sprite)
+{
+    const sf::Texture* texture = sprite.getTexture();
+    if (!texture) {
+        return;
+    }
+
+    sf::IntRect rect = sprite.getTextureRect();
+    float width = static_cast<float>(std::abs(rect.width));
+    float height = static_cast<float>(std::abs(rect.height));
+    float left = static_cast<float>(rect.left);
+    float top = static_cast<float>(rect.top);
+    float right = left + static_cast<float>(rect.width);
+    float bottom = top + static_cast<float>(rect.height);
+
+    const sf::Transform& transform = sprite.getTransform();
+    const sf::Vector2f corners[4] = {
+        transform.transformPoint(0.0f, 0.0f),
+        transform.transformPoint(width, 0.0f),
+        transform.transformPoint(width, height),
+        transform.transformPoint(0.0f, height),
+    };
+    const sf::Vector2f texCoords[4] = {
+        {left, top},
+        {right, top},
+        {right, bottom},
+        {left, bottom},
+    };
+    appendQuad(texture, corners, texCoords, sprite.getColor());
+}
+
+void RenderFrame::addRectangle(float x, float y, float width, float height,
+                               sf::Color color)
+{
+    const sf::Vector2f corners[4] = {
+        {x, y},
+        {x + width, y},
+        {x + width, y + height},
+        {x, y + height},
+    };
+    const sf::Vector2f texCoords[4] = {};
+    appendQuad(nullptr, corners, texCoords, color);
+}
+
+void RenderFrame::addCircle(float x, float y, float radius, sf::Color color)
+{
+    const float step = 2.0f * 3.14159265f / CIRCLE_POINTS;
+    const sf::Vector2f center(x, y);
+    for (int i = 0; i < CIRCLE_POINTS; ++i) {
+        float a0 = step * static_cast<float>(i);
+        float a1 = step * static_cast<float>(i + 1);
+        _vertices.emplace_back(center, color);
+        _vertices.emplace_back(
+            sf::Vector2f(x + radius * std::cos(a0), y + radius * std::sin(a0)),
+            color);
+        _vertices.emplace_back(
+            sf::Vector2f(x + radius * std::cos(a1), y + radius * std::sin(a1)),
+            color);
+    }
+    extendCommand(nullptr, CIRCLE_POINTS * 3);
+}
+
+void RenderFrame::addText(const std::string& string, float x, float y,
+                          unsigned int fontSize, sf::Color color)
+{
+    _texts.push_back({string, x, y, fontSize, color});
+    _commands.push_back({nullptr, _texts.size() - 1, 0});
+}
+
+}  // namespace rtype
@@ -0,0 +1,77 @@
+/*
+** EPITECH PROJECT, 2025
+** r-type
+** File description:
+** RenderFrame
+*/
+
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <string>
+#include <vector>
+
+namespace rtype {
+
+/**
+ * @brief Self-contained recording of one frame's draw calls
+ *
+ * Sprites and shapes are stored as transformed, tinted triangles together
+ * with the texture they sample, and text as plain strings, so the frame can
+ * be drawn later on another thread without touching the sprites it was
+ * recorded from. Consecutive triangles sharing a texture are merged into a
+ * single command. Textures must outlive the frame (TextureCacheSFML never
+ * frees them).
+ */
+class RenderFrame {
+   public:
+    struct Text {
+        std::string string;
+        float x;
+        float y;
+        unsigned int fontSize;
+        sf::Color color;
+    };
+
+    struct Command {
+        const sf::Texture* texture;  ///< nullptr for text and flat shapes
+        size_t first;  ///< First vertex, or index in getTexts() for text
+        size_t count;  ///< Vertex count, 0 for text
+    };
+
+    /**
+     * @brief Empty the frame, keeping its storage for the next recording
+     */
+    void clear();
+
+    void addSprite(const sf::Sprite& sprite);
+    void addRectangle(float x, float y, float width, float height,
+                      sf::Color color);
+    void addCircle(float x, float y, float radius, sf::Color color);
+    void addText(const std::string& string, float x, float y,
+                 unsigned int fontSize, sf::Color color);
+
+    /**
+     * @brief Append already transformed triangles
+     * @param texture Texture they sample, nullptr for flat color
+     * @param vertices First vertex
+     * @param count Number of vertices, a multiple of 3
+     */
+    void addTriangles(const sf::Texture* texture, const sf::Vertex* vertices,
+                      size_t count);
+
+    const std::vector<Command>& getCommands() const { return _commands; }
+    const std::vector<sf::Vertex>& getVertices() const { return _vertices; }
+    const std::vector<Text>& getTexts() const { return _texts; }
+
+   private:
+    void appendQuad(const sf::Texture* texture, const sf::Vector2f corners[4],
+                    const sf::Vector2f texCoords[4], sf::Color color);
+    void extendCommand(const sf::Texture* texture, size_t count);
+
+    std::vector<Command> _commands;
+    std::vector<sf::Vertex> _vertices;
+    std::vector<Text> _texts;
+};
+
+}  // namespace rtype
@@ -0,0 +1,100 @@
+/*
+** EPITECH PROJECT, 2025
+** r-type
+** File description:
+** RenderThreadSFML
+*/
+
+#include "RenderThreadSFML.hpp"
+
+#include <iostream>
+
+#include "../resources/EmbeddedResources.hpp"
+#include "../window/WindowSFML.hpp"
+
+namespace rtype {
+
+RenderThreadSFML::RenderThreadSFML(WindowSFML& window) : _window(window)
+{
+    _fontLoaded = _font.loadFromMemory(rtype::embedded::font_data,
+                                       sizeof(rtype::embedded::font_data));
+    if (!_fontLoaded) {
+        std::cerr << "Error: RenderThreadSFML - Failed to load embedded font"
+                  << std::endl;
+    }
+}
+
+RenderThreadSFML::~RenderThreadSFML() { stop(); }
+
+void RenderThreadSFML::start()
+{
+    if (_running) {
+        return;
+    }
+    _window.getSFMLWindow().setActive(false);
+    _running = true;
+    _thread = std::thread(&RenderThreadSFML::run, this);
+}
+
+void RenderThreadSFML::stop()
+{
+    if (!_running) {
+        return;
+    }
+    _running = false;
+    if (_thread.joinable()) {
+        _thread.join();
+    }
+    _window.getSFMLWindow().setActive(true);
+}
+
+RenderFrame& RenderThreadSFML::beginFrame()
+{
+    RenderFrame& frame = _frames.getWriteBuffer();
+    frame.clear();
+    return frame;
+}
+
+void RenderThreadSFML::submitFrame() { _frames.publish(); }
+
+void RenderThreadSFML::run()
+{
+    sf::RenderWindow& window = _window.getSFMLWindow();
+    window.setActive(true);
+
+    while (_running) {
+        _frames.consume();
+        window.clear(sf::Color::Black);
+        drawFrame(window, _frames.getReadBuffer());
+        window.display();
+    }
+
+    window.setActive(false);
+}
+
+void RenderThreadSFML::drawFrame(sf::RenderTarget& target,
+                                 const RenderFrame& frame)
+{
+    const std::vector<sf::Vertex>& vertices = frame.getVertices();
+    const std::vector<RenderFrame::Text>& texts = frame.getTexts();
+
+    for (const RenderFrame::Command& command : frame.getCommands()) {
+        if (command.count > 0) {
+            target.draw(&vertices[command.first], command.count,
+                        sf::Triangles, sf::RenderStates(command.texture));
+            continue;
+        }
+        if (!_fontLoaded) {
+            continue;
+        }
+        const RenderFrame::Text& text = texts[command.first];
+        _text.setFont(_font);
+        _text.setString(text.string);
+        _text.setCharacterSize(text.fontSize);
+        _text.setFillColor(text.color);
+        _text.setPosition(text.x, text.y);
+        target.draw(_text);
+    }
+}
+
+}  // namespace rtype
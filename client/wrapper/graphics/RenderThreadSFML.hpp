@@ -0,0 +1,82 @@
+/*
+** EPITECH PROJECT, 2025
+** r-type
+** File description:
+** RenderThreadSFML
+*/
+
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <atomic>
+#include <thread>
+
+#include "../utils/TripleBuffer.hpp"
+#include "RenderFrame.hpp"
+
+namespace rtype {
+
+class WindowSFML;
+
+/**
+ * @brief Draws recorded frames to the window from a dedicated thread
+ *
+ * While running, the render thread owns the window's OpenGL context: it
+ * draws the latest submitted RenderFrame, then displays it (so it runs at
+ * the window's framerate limit or vsync), redrawing the previous frame when
+ * nothing new arrived. The thread that created the window keeps polling
+ * events and records frames through GraphicsSFML::setRecording(), handing
+ * them over through a lock-free triple buffer.
+ */
+class RenderThreadSFML {
+   public:
+    /**
+     * @brief Construct a stopped render thread
+     * @param window Window to draw to
+     */
+    explicit RenderThreadSFML(WindowSFML& window);
+
+    /**
+     * @brief Stop the thread and give the window back to the caller
+     */
+    ~RenderThreadSFML();
+
+    RenderThreadSFML(const RenderThreadSFML&) = delete;
+    RenderThreadSFML& operator=(const RenderThreadSFML&) = delete;
+
+    /**
+     * @brief Take over the window's context and start drawing
+     */
+    void start();
+
+    /**
+     * @brief Stop drawing and reactivate the window on the calling thread
+     */
+    void stop();
+
+    bool isRunning() const { return _running.load(); }
+
+    /**
+     * @brief Get an empty frame to record the next frame into
+     */
+    RenderFrame& beginFrame();
+
+    /**
+     * @brief Hand the frame from beginFrame() to the render thread
+     */
+    void submitFrame();
+
+   private:
+    void run();
+    void drawFrame(sf::RenderTarget& target, const RenderFrame& frame);
+
+    WindowSFML& _window;
+    TripleBuffer<RenderFrame> _frames;
+    std::atomic<bool> _running{false};
+    std::thread _thread;
+    sf::Font _font;  ///< Render thread's own copy, fonts are not shared
+    bool _fontLoaded = false;
+    sf::Text _text;
+};
+
+}  // namespace rtype
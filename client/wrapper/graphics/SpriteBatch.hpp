@@ -0,0 +1,66 @@
+/*
+** EPITECH PROJECT, 2025
+** r-type
+** File description:
+** SpriteBatch
+*/
+
+#pragma once
+
+#include <cstddef>
+
+#include "Sprite.hpp"
+
+namespace rtype {
+
+/**
+ * @brief Abstract interface for batched sprite rendering
+ *
+ * Sprites and rectangles queued between begin() and end() are grouped by
+ * texture and submitted with one draw call per texture. Groups are drawn in
+ * the order their texture was first used; inside a group, quads keep their
+ * queue order. Start a new batch when something must appear above quads of
+ * another texture.
+ */
+class ISpriteBatch {
+   public:
+    virtual ~ISpriteBatch() = default;
+
+    /**
+     * @brief Start a new batch, discarding anything not submitted
+     */
+    virtual void begin() = 0;
+
+    /**
+     * @brief Queue a sprite with its current transform, rect and color
+     * @param sprite Sprite to draw
+     */
+    virtual void draw(const ISprite& sprite) = 0;
+
+    /**
+     * @brief Queue a filled rectangle
+     * @param x X position
+     * @param y Y position
+     * @param width Width
+     * @param height Height
+     * @param r Red component (0-255)
+     * @param g Green component (0-255)
+     * @param b Blue component (0-255)
+     * @param a Alpha component (0-255, 0=transparent, 255=opaque)
+     */
+    virtual void drawRectangle(float x, float y, float width, float height,
+                               unsigned char r, unsigned char g,
+                               unsigned char b, unsigned char a) = 0;
+
+    /**
+     * @brief Submit everything queued since begin()
+     */
+    virtual void end() = 0;
+
+    /**
+     * @brief Get the number of draw calls issued by the last end()
+     */
+    virtual size_t getDrawCallCount() const = 0;
+};
+
+}  // namespace rtype
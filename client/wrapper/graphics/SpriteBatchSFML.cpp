@@ -0,0 +1,140 @@
+/*
+** EPITECH PROJECT, 2025
+** r-type
+** File description:
+** SpriteBatchSFML
+*/
+
+#include "SpriteBatchSFML.hpp"
+
+#include <cstdlib>
+
+#include "GraphicsSFML.hpp"
+#include "SpriteSFML.hpp"
+
+namespace rtype {
+
+SpriteBatchSFML::SpriteBatchSFML(GraphicsSFML& graphics) : _graphics(graphics)
+{
+}
+
+void SpriteBatchSFML::begin()
+{
+    for (size_t i = 0; i < _groupCount; ++i) {
+        _groups[i].vertices.clear();
+    }
+    _groupCount = 0;
+}
+
+sf::VertexArray& SpriteBatchSFML::getGroup(const sf::Texture* texture)
+{
+    for (size_t i = 0; i < _groupCount; ++i) {
+        if (_groups[i].texture == texture) {
+            return _groups[i].vertices;
+        }
+    }
+
+    if (_groupCount == _groups.size()) {
+        _groups.emplace_back();
+    }
+    Group& group = _groups[_groupCount++];
+    group.texture = texture;
+    group.vertices.clear();
+    return group.vertices;
+}
+
+void SpriteBatchSFML::appendQuad(sf::VertexArray& vertices,
+                                 const sf::Vector2f corners[4],
+                                 const sf::Vector2f texCoords[4],
+                                 sf::Color color)
+{
+    static constexpr int TRIANGLES[6] = {0, 1, 2, 0, 2, 3};
+    for (int index : TRIANGLES) {
+        vertices.append(sf::Vertex(corners[index], color, texCoords[index]));
+    }
+}
+
+void SpriteBatchSFML::draw(const ISprite& sprite)
+{
+    const auto* spriteSFML = dynamic_cast<const SpriteSFML*>(&sprite);
+    if (!spriteSFML) {
+        return;
+    }
+
+    const sf::Sprite& sfSprite = spriteSFML->getSFMLSprite();
+    const sf::Texture* texture = sfSprite.getTexture();
+    if (!texture) {
+        return;
+    }
+
+    sf::IntRect rect = sfSprite.getTextureRect();
+    float width = static_cast<float>(std::abs(rect.width));
+    float height = static_cast<float>(std::abs(rect.height));
+    float left = static_cast<float>(rect.left);
+    float top = static_cast<float>(rect.top);
+    float right = left + static_cast<float>(rect.width);
+    float bottom = top + static_cast<float>(rect.height);
+
+    const sf::Transform& transform = sfSprite.getTransform();
+    const sf::Vector2f corners[4] = {
+        transform.transformPoint(0.0f, 0.0f),
+        transform.transformPoint(width, 0.0f),
+        transform.transformPoint(width, height),
+        transform.transformPoint(0.0f, height),
+    };
+    const sf::Vector2f texCoords[4] = {
+        {left, top},
+        {right, top},
+        {right, bottom},
+        {left, bottom},
+    };
+
+    appendQuad(getGroup(texture), corners, texCoords, sfSprite.getColor());
+}
+
+void SpriteBatchSFML::drawRectangle(float x, float y, float width,
+                                    float height, unsigned char r,
+                                    unsigned char g, unsigned char b,
+                                    unsigned char a)
+{
+    const sf::Vector2f corners[4] = {
+        {x, y},
+        {x + width, y},
+        {x + width, y + height},
+        {x, y + height},
+    };
+    const sf::Vector2f texCoords[4] = {};
+
+    appendQuad(getGroup(nullptr), corners, texCoords, sf::Color(r, g, b, a));
+}
+
+void SpriteBatchSFML::end()
+{
+    _drawCalls = 0;
+
+    RenderFrame* frame = _graphics.getRecording();
+    sf::RenderTarget* target = frame ? nullptr : _graphics.getSFMLTarget();
+    if (frame) {
+        for (size_t i = 0; i < _groupCount; ++i) {
+            const Group& group = _groups[i];
+            size_t count = group.vertices.getVertexCount();
+            if (count > 0) {
+                frame->addTriangles(group.texture, &group.vertices[0], count);
+                _drawCalls++;
+            }
+        }
+    } else if (target) {
+        for (size_t i = 0; i < _groupCount; ++i) {
+            const Group& group = _groups[i];
+            if (group.vertices.getVertexCount() == 0) {
+                continue;
+            }
+            target->draw(group.vertices, sf::RenderStates(group.texture));
+            _drawCalls++;
+        }
+    }
+
+    begin();
+}
+
+}  // namespace rtype
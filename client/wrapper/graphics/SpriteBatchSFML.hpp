@@ -0,0 +1,63 @@
+/*
+** EPITECH PROJECT, 2025
+** r-type
+** File description:
+** SpriteBatchSFML
+*/
+
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <vector>
+
+#include "SpriteBatch.hpp"
+
+namespace rtype {
+
+class GraphicsSFML;
+
+/**
+ * @brief SFML implementation of ISpriteBatch
+ *
+ * Quads are appended to one sf::VertexArray per texture (rectangles go to an
+ * untextured one). Vertex arrays are kept between frames so a warmed-up
+ * batch does not allocate. While the graphics is recording a RenderFrame,
+ * end() appends the groups to that frame instead of drawing them.
+ */
+class SpriteBatchSFML : public ISpriteBatch {
+   public:
+    /**
+     * @brief Construct a batch drawing to the graphics' current target
+     * @param graphics Graphics the batch is submitted through
+     */
+    explicit SpriteBatchSFML(GraphicsSFML& graphics);
+
+    void begin() override;
+    void draw(const ISprite& sprite) override;
+    void drawRectangle(float x, float y, float width, float height,
+                       unsigned char r, unsigned char g, unsigned char b,
+                       unsigned char a) override;
+    void end() override;
+    size_t getDrawCallCount() const override { return _drawCalls; }
+
+   private:
+    struct Group {
+        const sf::Texture* texture = nullptr;
+        sf::VertexArray vertices{sf::Triangles};
+    };
+
+    /**
+     * @brief Get the group of a texture, opening one on first use
+     */
+    sf::VertexArray& getGroup(const sf::Texture* texture);
+
+    void appendQuad(sf::VertexArray& vertices, const sf::Vector2f corners[4],
+                    const sf::Vector2f texCoords[4], sf::Color color);
+
+    GraphicsSFML& _graphics;
+    std::vector<Group> _groups;  ///< First _groupCount are in use
+    size_t _groupCount = 0;
+    size_t _drawCalls = 0;
+};
+
+}  // namespace rtype
@@ -7,23 +7,31 @@
 
 #include "SpriteSFML.hpp"
 
-#include <iostream>
+#include <algorithm>
+
+#include "TextureCacheSFML.hpp"
 
 namespace rtype {
 
-SpriteSFML::SpriteSFML()
-    : _texture(std::make_unique<sf::Texture>()),
-      _sprite(std::make_unique<sf::Sprite>())
+SpriteSFML::SpriteSFML() : _sprite(std::make_unique<sf::Sprite>()) {}
+
+void SpriteSFML::reset()
 {
+    *_sprite = sf::Sprite();
+    _texture = nullptr;
+    _region = sf::IntRect();
 }
 
 bool SpriteSFML::loadTexture(std::span<const std::byte> binaryData)
 {
-    if (!_texture->loadFromMemory(binaryData.data(), binaryData.size())) {
-        std::cerr << "Error: Failed to load texture from memory" << std::endl;
+    const auto* region = TextureCacheSFML::getInstance().get(binaryData);
+    if (!region) {
         return false;
     }
+    _texture = region->texture;
+    _region = region->rect;
     _sprite->setTexture(*_texture);
+    _sprite->setTextureRect(_region);
     return true;
 }
 
@@ -49,19 +57,30 @@ float SpriteSFML::getPositionY() const { return _sprite->getPosition().y; }
 
 void SpriteSFML::setTextureRect(int left, int top, int width, int height)
 {
-    _sprite->setTextureRect(sf::IntRect(left, top, width, height));
+    // Never sample outside the image: in an atlas page that would show its
+    // neighbours
+    width = std::min(width, _region.width - left);
+    height = std::min(height, _region.height - top);
+    _sprite->setTextureRect(sf::IntRect(_region.left + left,
+                                        _region.top + top, width, height));
 }
 
-void SpriteSFML::setSmooth(bool smooth) { _texture->setSmooth(smooth); }
+void SpriteSFML::setSmooth(bool smooth)
+{
+    // Applies to the whole shared texture; atlas sprites are all pixel art
+    if (_texture) {
+        _texture->setSmooth(smooth);
+    }
+}
 
 float SpriteSFML::getTextureWidth() const
 {
-    return static_cast<float>(_texture->getSize().x);
+    return static_cast<float>(_region.width);
 }
 
 float SpriteSFML::getTextureHeight() const
 {
-    return static_cast<float>(_texture->getSize().y);
+    return static_cast<float>(_region.height);
 }
 
 void SpriteSFML::setAlpha(unsigned char alpha)
@@ -75,8 +94,16 @@ void SpriteSFML::setAlpha(unsigned char alpha)
 
 const sf::Sprite& SpriteSFML::getSFMLSprite() const { return *_sprite; }
 
+sf::FloatRect SpriteSFML::getGlobalBounds() const
+{
+    return _sprite->getGlobalBounds();
+}
+
 void SpriteSFML::setTexture(const sf::Texture& texture)
 {
+    _texture = nullptr;
+    _region = sf::IntRect(0, 0, static_cast<int>(texture.getSize().x),
+                          static_cast<int>(texture.getSize().y));
     _sprite->setTexture(texture);
 }
 
@@ -16,6 +16,10 @@ namespace rtype {
 
 /**
  * @brief SFML implementation of ISprite interface
+ *
+ * Textures loaded from memory come from TextureCacheSFML: the sprite only
+ * references the shared texture and the image's sub-rectangle, and texture
+ * rects are relative to that image.
  */
 class SpriteSFML : public ISprite {
    public:
@@ -46,6 +50,12 @@ class SpriteSFML : public ISprite {
      */
     const sf::Sprite& getSFMLSprite() const;
 
+    /**
+     * @brief Get the on-screen bounds with the current transform applied
+     * @return Axis-aligned bounding rectangle
+     */
+    sf::FloatRect getGlobalBounds() const;
+
     /**
      * @brief Set texture from an external SFML texture
      * @param texture The SFML texture to use
@@ -53,8 +63,14 @@ class SpriteSFML : public ISprite {
      */
     void setTexture(const sf::Texture& texture);
 
+    /**
+     * @brief Drop the texture and transform so the sprite can be reused
+     */
+    void reset();
+
    private:
-    std::unique_ptr<sf::Texture> _texture;
+    sf::Texture* _texture = nullptr;  ///< Shared, owned by TextureCacheSFML
+    sf::IntRect _region;              ///< Image bounds inside the texture
     std::unique_ptr<sf::Sprite> _sprite;
 };
 
@@ -0,0 +1,125 @@
+/*
+** EPITECH PROJECT, 2025
+** r-type
+** File description:
+** TextureCacheSFML
+*/
+
+#include "TextureCacheSFML.hpp"
+
+#include <iostream>
+
+namespace rtype {
+
+TextureCacheSFML& TextureCacheSFML::getInstance()
+{
+    static TextureCacheSFML instance;
+    return instance;
+}
+
+const TextureCacheSFML::Region* TextureCacheSFML::get(
+    std::span<const std::byte> binaryData)
+{
+    auto known = _byAddress.find(binaryData.data());
+    if (known != _byAddress.end()) {
+        return known->second;
+    }
+
+    std::string_view content(reinterpret_cast<const char*>(binaryData.data()),
+                             binaryData.size());
+    auto it = _regions.find(content);
+    if (it != _regions.end()) {
+        _byAddress.emplace(binaryData.data(), &it->second);
+        return &it->second;
+    }
+
+    sf::Image image;
+    if (!image.loadFromMemory(binaryData.data(), binaryData.size())) {
+        std::cerr << "Error: Failed to load texture from memory" << std::endl;
+        return nullptr;
+    }
+
+    sf::Vector2u size = image.getSize();
+    sf::Texture* page = nullptr;
+    sf::Vector2u position;
+    Region region;
+
+    if (allocate(size.x, size.y, page, position)) {
+        page->update(image, position.x, position.y);
+        region = {page,
+                  sf::IntRect(static_cast<int>(position.x),
+                              static_cast<int>(position.y),
+                              static_cast<int>(size.x),
+                              static_cast<int>(size.y))};
+    } else {
+        auto texture = std::make_unique<sf::Texture>();
+        if (!texture->loadFromImage(image)) {
+            std::cerr << "Error: Failed to create texture" << std::endl;
+            return nullptr;
+        }
+        region = {texture.get(),
+                  sf::IntRect(0, 0, static_cast<int>(size.x),
+                              static_cast<int>(size.y))};
+        _standalone.push_back(std::move(texture));
+    }
+
+    const Region* stored = &_regions.emplace(content, region).first->second;
+    _byAddress.emplace(binaryData.data(), stored);
+    return stored;
+}
+
+void TextureCacheSFML::preload(
+    std::span<const std::span<const std::byte>> images)
+{
+    for (const auto& image : images) {
+        get(image);
+    }
+}
+
+bool TextureCacheSFML::allocate(unsigned int width, unsigned int height,
+                                sf::Texture*& page, sf::Vector2u& position)
+{
+    // Large images would waste most of a page
+    if (width > PAGE_SIZE / 2 || height > PAGE_SIZE / 2) {
+        return false;
+    }
+
+    unsigned int paddedWidth = width + PADDING;
+    unsigned int paddedHeight = height + PADDING;
+
+    if (_pages.empty()) {
+        addPage();
+    }
+    if (_cursorX + paddedWidth > PAGE_SIZE) {
+        _cursorX = 0;
+        _cursorY += _shelfHeight;
+        _shelfHeight = 0;
+    }
+    if (_cursorY + paddedHeight > PAGE_SIZE) {
+        addPage();
+    }
+
+    page = _pages.back().get();
+    position = {_cursorX, _cursorY};
+    _cursorX += paddedWidth;
+    if (paddedHeight > _shelfHeight) {
+        _shelfHeight = paddedHeight;
+    }
+    return true;
+}
+
+void TextureCacheSFML::addPage()
+{
+    sf::Image blank;
+    blank.create(PAGE_SIZE, PAGE_SIZE, sf::Color::Transparent);
+
+    auto page = std::make_unique<sf::Texture>();
+    page->loadFromImage(blank);
+    _pages.push_back(std::move(page));
+
+    _cursorX = 0;
+    _cursorY = 0;
+    _shelfHeight = 0;
+}
+
+}  // namespace rtype
@@ -0,0 +1,99 @@
+/*
+** EPITECH PROJECT, 2025
+** r-type
+** File description:
+** TextureCacheSFML
+*/
+
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace rtype {
+
+/**
+ * @brief Shared textures for embedded images, packed into atlas pages
+ *
+ * Each embedded asset is decoded and uploaded once, the first time a sprite
+ * loads it; later sprites only reference the shared texture and the
+ * sub-rectangle holding the image. Small images are packed row by row into
+ * a few atlas pages so most sprites share one texture; images too large for
+ * a page get a texture of their own.
+ *
+ * Embedded arrays are static, so every translation unit has its own copy:
+ * images are identified by content, and each copy's address is remembered
+ * so later lookups are a single pointer hash. Must be used from the thread
+ * owning the OpenGL context.
+ */
+class TextureCacheSFML {
+   public:
+    /**
+     * @brief Where an image lives once uploaded
+     */
+    struct Region {
+        sf::Texture* texture;  ///< Atlas page or standalone texture
+        sf::IntRect rect;      ///< Image bounds inside the texture
+    };
+
+    static TextureCacheSFML& getInstance();
+
+    TextureCacheSFML(const TextureCacheSFML&) = delete;
+    TextureCacheSFML& operator=(const TextureCacheSFML&) = delete;
+
+    /**
+     * @brief Get the texture region of an embedded image, decoding it the
+     * first time
+     * @param binaryData Encoded image (PNG, ...)
+     * @return nullptr if the image cannot be decoded
+     */
+    const Region* get(std::span<const std::byte> binaryData);
+
+    /**
+     * @brief Decode and upload images ahead of time
+     *
+     * Avoids decoding on the frame where the first sprite using an image is
+     * created.
+     */
+    void preload(std::span<const std::span<const std::byte>> images);
+
+    /**
+     * @brief Number of textures created so far (atlas pages + standalone)
+     */
+    size_t getTextureCount() const
+    {
+        return _pages.size() + _standalone.size();
+    }
+
+   private:
+    TextureCacheSFML() = default;
+
+    static constexpr unsigned int PAGE_SIZE = 1024;
+    static constexpr unsigned int PADDING = 2;  ///< Transparent gap between
+                                                ///< images to avoid bleeding
+
+    /**
+     * @brief Find room for an image in the atlas, adding a page if needed
+     * @return false if the image is too large to be packed
+     */
+    bool allocate(unsigned int width, unsigned int height, sf::Texture*& page,
+                  sf::Vector2u& position);
+    void addPage();
+
+    std::unordered_map<std::string_view, Region> _regions;
+    std::unordered_map<const std::byte*, const Region*> _byAddress;
+    std::vector<std::unique_ptr<sf::Texture>> _pages;
+    std::vector<std::unique_ptr<sf::Texture>> _standalone;
+
+    // Shelf packing cursor in the last page
+    unsigned int _cursorX = 0;
+    unsigned int _cursorY = 0;
+    unsigned int _shelfHeight = 0;
+};
+
+}  // namespace rtype
@@ -0,0 +1,74 @@
+/*
+** EPITECH PROJECT, 2025
+** r-type
+** File description:
+** TripleBuffer
+*/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace rtype {
+
+/**
+ * @brief Lock-free single producer / single consumer triple buffer
+ *
+ * The producer fills getWriteBuffer() and publishes it; the consumer picks
+ * up the most recent published buffer with consume() and reads it through
+ * getReadBuffer(). Neither side ever waits: frames the consumer was too
+ * slow to see are overwritten, and the consumer keeps its last buffer when
+ * nothing new was published.
+ *
+ * @tparam T Buffer type, reused in place (clear it before refilling)
+ */
+template <typename T>
+class TripleBuffer {
+   public:
+    /**
+     * @brief Get the buffer the producer may fill (producer thread only)
+     */
+    T& getWriteBuffer() { return _buffers[_write]; }
+
+    /**
+     * @brief Hand the write buffer over to the consumer
+     */
+    void publish()
+    {
+        uint8_t previous =
+            _pending.exchange(_write | FRESH, std::memory_order_acq_rel);
+        _write = previous & INDEX_MASK;
+    }
+
+    /**
+     * @brief Switch to the latest published buffer, if any
+     * @return true if a new buffer is now readable
+     */
+    bool consume()
+    {
+        if (!(_pending.load(std::memory_order_relaxed) & FRESH)) {
+            return false;
+        }
+        uint8_t previous = _pending.exchange(_read, std::memory_order_acq_rel);
+        _read = previous & INDEX_MASK;
+        return true;
+    }
+
+    /**
+     * @brief Get the buffer last consumed (consumer thread only)
+     */
+    const T& getReadBuffer() const { return _buffers[_read]; }
+
+   private:
+    static constexpr uint8_t INDEX_MASK = 0x3;
+    static constexpr uint8_t FRESH = 0x4;  ///< Pending buffer not consumed
+
+    std::array<T, 3> _buffers;
+    uint8_t _write = 0;
+    std::atomic<uint8_t> _pending{1};
+    uint8_t _read = 2;
+};
+
+}  // namespace rtype
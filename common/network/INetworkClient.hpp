@@ -56,16 +56,19 @@ class INetworkClient : public INetworkBase {
     /**
      * @brief Send login packet to server
      * @param username Player username (max 7 chars)
+     * @param roomId Room to join (0 = default room)
      * @return true if sent successfully
      */
-    virtual bool sendLogin(const std::string& username) = 0;
+    virtual bool sendLogin(const std::string& username,
+                           uint16_t roomId = 0) = 0;
 
     /**
      * @brief Send input packet to server
      * @param inputMask Bitmask of pressed inputs
-     * @return true if sent successfully
+     * @return Sequence ID stamped on the packet (echoed back by
+     * S2C_INPUT_ACK), 0 if it was not sent
      */
-    virtual bool sendInput(uint8_t inputMask) = 0;
+    virtual uint32_t sendInput(uint8_t inputMask) = 0;
 
     /**
      * @brief Send disconnect packet to server
@@ -13,7 +13,8 @@
 namespace rtype {
 
 ::LoginPacket NetworkMessage::createLoginPacket(const std::string& username,
-                                                uint32_t sequenceId)
+                                                uint32_t sequenceId,
+                                                uint16_t roomId)
 {
     ::LoginPacket packet = {};
     packet.header.opCode = OpCode::C2S_LOGIN;
@@ -23,6 +24,7 @@ namespace rtype {
     size_t copyLen = std::min(username.length(), sizeof(packet.username) - 1);
     std::memcpy(packet.username, username.c_str(), copyLen);
     packet.username[copyLen] = '\0';
+    packet.roomId = roomId;
 
     return packet;
 }
@@ -110,6 +112,60 @@ namespace rtype {
     return packet;
 }
 
+::HealthUpdatePacket NetworkMessage::createHealthUpdatePacket(
+    uint32_t entityId, float currentHealth, float maxHealth,
+    uint32_t sequenceId)
+{
+    ::HealthUpdatePacket packet = {};
+    packet.header.opCode = OpCode::S2C_HEALTH_UPDATE;
+    packet.header.packetSize = sizeof(HealthUpdatePacket);
+    packet.header.sequenceId = sequenceId;
+    packet.entityId = entityId;
+    packet.currentHealth = currentHealth;
+    packet.maxHealth = maxHealth;
+    return packet;
+}
+
+::ShieldStatusPacket NetworkMessage::createShieldStatusPacket(
+    uint32_t playerId, bool hasShield, uint32_t sequenceId)
+{
+    ::ShieldStatusPacket packet = {};
+    packet.header.opCode = OpCode::S2C_SHIELD_STATUS;
+    packet.header.packetSize = sizeof(ShieldStatusPacket);
+    packet.header.sequenceId = sequenceId;
+    packet.playerId = playerId;
+    packet.hasShield = hasShield ? 1 : 0;
+    return packet;
+}
+
+::GameEventPacket NetworkMessage::createGameEventPacket(uint8_t eventType,
+                                                        uint8_t waveNumber,
+                                                        uint8_t totalWaves,
+                                                        uint8_t levelId,
+                                                        uint32_t sequenceId)
+{
+    ::GameEventPacket packet = {};
+    packet.header.opCode = OpCode::S2C_GAME_EVENT;
+    packet.header.packetSize = sizeof(GameEventPacket);
+    packet.header.sequenceId = sequenceId;
+    packet.eventType = eventType;
+    packet.waveNumber = waveNumber;
+    packet.totalWaves = totalWaves;
+    packet.levelId = levelId;
+    return packet;
+}
+
+::SpectatePacket NetworkMessage::createSpectatePacket(uint16_t roomId,
+                                                      uint32_t sequenceId)
+{
+    ::SpectatePacket packet = {};
+    packet.header.opCode = OpCode::C2S_SPECTATE;
+    packet.header.packetSize = sizeof(SpectatePacket);
+    packet.header.sequenceId = sequenceId;
+    packet.roomId = roomId;
+    return packet;
+}
+
 ::EntityDeadPacket NetworkMessage::createEntityDeadPacket(uint32_t entityId,
                                                           uint32_t sequenceId)
 {
@@ -219,6 +275,10 @@ std::string NetworkMessage::entityTypeToString(uint8_t entityType)
             return "PLAYER";
         case EntityType::PLAYER_MISSILE:
             return "PLAYER_MISSILE";
+        case EntityType::BOSS:
+            return "BOSS";
+        case EntityType::BOSS_DUO:
+            return "BOSS_DUO";
         case EntityType::BASIC:
             return "BASIC";
         case EntityType::BASIC_MISSILE:
@@ -243,6 +303,14 @@ std::string NetworkMessage::entityTypeToString(uint8_t entityType)
             return "LASER_SHIP";
         case EntityType::LASER:
             return "LASER";
+        case EntityType::GUIDED_MISSILE:
+            return "GUIDED_MISSILE";
+        case EntityType::GLANDUS:
+            return "GLANDUS";
+        case EntityType::GLANDUS_MINI:
+            return "GLANDUS_MINI";
+        case EntityType::GREEN_BULLET:
+            return "GREEN_BULLET";
         default:
             return "UNKNOWN";
     }
@@ -253,22 +321,46 @@ std::string NetworkMessage::opCodeToString(uint8_t opCode)
     switch (opCode) {
         case C2S_LOGIN:
             return "C2S_LOGIN";
+        case C2S_START_GAME:
+            return "C2S_START_GAME";
         case C2S_ACK:
             return "C2S_ACK";
         case C2S_DISCONNECT:
             return "C2S_DISCONNECT";
         case C2S_INPUT:
             return "C2S_INPUT";
+        case C2S_SPECTATE:
+            return "C2S_SPECTATE";
         case S2C_LOGIN_OK:
             return "S2C_LOGIN_OK";
+        case S2C_LOGIN_REJECTED:
+            return "S2C_LOGIN_REJECTED";
         case S2C_ENTITY_NEW:
             return "S2C_ENTITY_NEW";
         case S2C_ENTITY_POS:
             return "S2C_ENTITY_POS";
         case S2C_ENTITY_DEAD:
             return "S2C_ENTITY_DEAD";
+        case S2C_MAP:
+            return "S2C_MAP";
         case S2C_SCORE_UPDATE:
             return "S2C_SCORE_UPDATE";
+        case S2C_BOSS_SPAWN:
+            return "S2C_BOSS_SPAWN";
+        case S2C_BOSS_STATE:
+            return "S2C_BOSS_STATE";
+        case S2C_BOSS_DEATH:
+            return "S2C_BOSS_DEATH";
+        case S2C_HEALTH_UPDATE:
+            return "S2C_HEALTH_UPDATE";
+        case S2C_SHIELD_STATUS:
+            return "S2C_SHIELD_STATUS";
+        case S2C_GAME_EVENT:
+            return "S2C_GAME_EVENT";
+        case S2C_INPUT_ACK:
+            return "S2C_INPUT_ACK";
+        case S2C_SPECTATE_BATCH:
+            return "S2C_SPECTATE_BATCH";
         default:
             return "UNKNOWN";
     }
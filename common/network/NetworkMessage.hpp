@@ -26,10 +26,12 @@ class NetworkMessage {
      * @brief Create login packet
      * @param username Player username (max 7 chars)
      * @param sequenceId Sequence ID for the packet
+     * @param roomId Room to join (0 = default room)
      * @return LoginPacket ready to send
      */
     static ::LoginPacket createLoginPacket(const std::string& username,
-                                           uint32_t sequenceId);
+                                           uint32_t sequenceId,
+                                           uint16_t roomId = 0);
 
     /**
      * @brief Create input packet
@@ -110,6 +112,54 @@ class NetworkMessage {
     static ::ScoreUpdatePacket createScoreUpdatePacket(uint32_t score,
                                                        uint32_t sequenceId);
 
+    /**
+     * @brief Create health update packet
+     * @param entityId Entity unique ID
+     * @param currentHealth Current health
+     * @param maxHealth Maximum health
+     * @param sequenceId Sequence ID for the packet
+     * @return HealthUpdatePacket ready to send
+     */
+    static ::HealthUpdatePacket createHealthUpdatePacket(uint32_t entityId,
+                                                         float currentHealth,
+                                                         float maxHealth,
+                                                         uint32_t sequenceId);
+
+    /**
+     * @brief Create shield status packet
+     * @param playerId Player entity ID
+     * @param hasShield Whether the player has a shield
+     * @param sequenceId Sequence ID for the packet
+     * @return ShieldStatusPacket ready to send
+     */
+    static ::ShieldStatusPacket createShieldStatusPacket(uint32_t playerId,
+                                                         bool hasShield,
+                                                         uint32_t sequenceId);
+
+    /**
+     * @brief Create game event packet
+     * @param eventType Event type (see GameEventType)
+     * @param waveNumber Current wave number
+     * @param totalWaves Total waves in level
+     * @param levelId Current level ID
+     * @param sequenceId Sequence ID for the packet
+     * @return GameEventPacket ready to send
+     */
+    static ::GameEventPacket createGameEventPacket(uint8_t eventType,
+                                                   uint8_t waveNumber,
+                                                   uint8_t totalWaves,
+                                                   uint8_t levelId,
+                                                   uint32_t sequenceId);
+
+    /**
+     * @brief Create spectate packet
+     * @param roomId Room to watch (0 = default room)
+     * @param sequenceId Sequence ID for the packet
+     * @return SpectatePacket ready to send
+     */
+    static ::SpectatePacket createSpectatePacket(uint16_t roomId,
+                                                 uint32_t sequenceId);
+
     /**
      * @brief Validate packet header
      * @param data Raw packet data
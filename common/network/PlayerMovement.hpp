@@ -0,0 +1,66 @@
+/*
+** EPITECH PROJECT, 2025
+** r-type
+** File description:
+** PlayerMovement
+*/
+
+#pragma once
+
+#include <cstdint>
+
+#include "InputMask.hpp"
+
+/**
+ * @brief Player ship movement rules shared by the server simulation and the
+ * client-side prediction
+ *
+ * Both sides must step a ship with exactly these rules, otherwise the client
+ * keeps predicting positions the server will correct.
+ */
+namespace PlayerMovement {
+constexpr float BASE_SPEED = 300.0f;
+constexpr float SPEED_BOOST_MULTIPLIER = 1.5f;
+constexpr float BOOSTED_SPEED = BASE_SPEED * SPEED_BOOST_MULTIPLIER;
+
+constexpr float MIN_X = 0.0f;
+constexpr float MAX_X = 1800.0f;
+constexpr float MIN_Y = 0.0f;
+constexpr float MAX_Y = 1000.0f;
+
+/**
+ * @brief Duration of movement applied for one input packet (one server tick)
+ */
+constexpr float INPUT_STEP = 1.0f / 60.0f;
+
+/**
+ * @brief Move a ship by one input
+ * @param x Position to update
+ * @param y Position to update
+ * @param inputMask InputMask bits
+ * @param speed Movement speed in pixels per second
+ * @param deltaTime Time the input is applied for
+ * @return true if the input contained a movement direction
+ */
+inline bool apply(float& x, float& y, uint8_t inputMask, float speed,
+                  float deltaTime)
+{
+    float moveX = 0.0f;
+    float moveY = 0.0f;
+
+    if (inputMask & InputMask::UP) moveY -= speed * deltaTime;
+    if (inputMask & InputMask::DOWN) moveY += speed * deltaTime;
+    if (inputMask & InputMask::LEFT) moveX -= speed * deltaTime;
+    if (inputMask & InputMask::RIGHT) moveX += speed * deltaTime;
+
+    x += moveX;
+    y += moveY;
+
+    if (x < MIN_X) x = MIN_X;
+    if (x > MAX_X) x = MAX_X;
+    if (y < MIN_Y) y = MIN_Y;
+    if (y > MAX_Y) y = MAX_Y;
+
+    return moveX != 0.0f || moveY != 0.0f;
+}
+}  // namespace PlayerMovement
@@ -44,6 +44,7 @@ enum OpCode : uint8_t {
     C2S_DISCONNECT = 3,  ///< Notification that client is leaving.
     C2S_ACK = 4,         ///< Acknowledgment of a reliable packet.
     C2S_INPUT = 5,       ///< Player input state (keys pressed).
+    C2S_SPECTATE = 6,    ///< Request to watch a match without playing.
 
     // --- S2C (Server to Client) ---
     S2C_LOGIN_OK = 10,  ///< Login accepted, contains player ID and map info.
@@ -60,6 +61,9 @@ enum OpCode : uint8_t {
     S2C_SHIELD_STATUS = 20,  ///< Shield status update (gained/lost).
     S2C_GAME_EVENT =
         21,  ///< Game event notification (wave start, level complete).
+    S2C_INPUT_ACK = 23,  ///< Last applied input and the resulting position.
+    S2C_SPECTATE_BATCH =
+        24,  ///< Delayed game packets sent to spectators.
 };
 
 /**
@@ -78,6 +82,8 @@ struct LoginPacket {
     Header header;
     char username[8];  ///< Player username (fixed size, null-terminated if < 8
                        ///< chars).
+    uint16_t roomId;   ///< Room (match) to join. Older clients omit this
+                       ///< field and are placed in room 0.
 };
 
 /**
@@ -135,8 +141,9 @@ struct LoginResponsePacket {
  * OpCode: S2C_LOGIN_REJECTED
  */
 enum class RejectReason : uint8_t {
-    SERVER_FULL = 1,  ///< Server has reached max players.
-    UNKNOWN = 255     ///< Unknown reason.
+    SERVER_FULL = 1,    ///< Server has reached max players.
+    NO_SPECTATORS = 2,  ///< Spectating is disabled or full.
+    UNKNOWN = 255       ///< Unknown reason.
 };
 
 struct LoginRejectPacket {
@@ -263,4 +270,47 @@ struct GameEventPacket {
     uint8_t levelId;     ///< Current level ID.
 };
 
+/**
+ * @brief Packet acknowledging the player's inputs.
+ * OpCode: S2C_INPUT_ACK
+ *
+ * Sent only to the owning client, once per server frame in which it had
+ * inputs applied. Lets the client drop predicted inputs the server has
+ * already simulated and replay the rest from the authoritative position.
+ */
+struct InputAckPacket {
+    Header header;
+    uint32_t inputSequenceId;  ///< Header sequenceId of the last input applied.
+    float x;                   ///< Player position after that input.
+    float y;                   ///< Player position after that input.
+};
+
+/**
+ * @brief Packet sent by a client to watch a match.
+ * OpCode: C2S_SPECTATE
+ *
+ * Spectators never get a ship and do not count against maxPlayers. They
+ * must repeat this packet (or send any other) before the server timeout;
+ * repeating it for the same room only keeps the session alive.
+ */
+struct SpectatePacket {
+    Header header;
+    uint16_t roomId;  ///< Room (match) to watch, 0 on a single-match server.
+};
+
+/**
+ * @brief Delayed game packets sent to spectators.
+ * OpCode: S2C_SPECTATE_BATCH
+ *
+ * The header is followed by up to packetSize - sizeof(Header) bytes of
+ * records, each a uint16_t size then a complete S2C packet (the keyframe
+ * layout of replay files). The first batches a spectator gets describe the
+ * delayed match as it stands, starting with an S2C_LOGIN_OK for player 0.
+ * The server repeats that description every few seconds to repair lost
+ * batches.
+ */
+struct SpectateBatchPacket {
+    Header header;
+};
+
 #pragma pack(pop)
@@ -0,0 +1,124 @@
+/*
+** EPITECH PROJECT, 2025
+** r-type
+** File description:
+** ByteRingBuffer
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <span>
+#include <vector>
+
+namespace rtype {
+
+/**
+ * @brief Lock-free single producer / single consumer byte queue
+ *
+ * The producer appends whole messages with write(), which never blocks: it
+ * fails instead when the message does not fit. The consumer reads the
+ * oldest bytes in place through peek() and releases them with consume().
+ * Positions grow forever and are masked into a power-of-two buffer, so a
+ * full and an empty queue are never confused.
+ */
+class ByteRingBuffer {
+   public:
+    /**
+     * @param capacity Size in bytes, rounded up to a power of two
+     */
+    explicit ByteRingBuffer(size_t capacity)
+    {
+        size_t size = 1;
+        while (size < capacity) {
+            size <<= 1;
+        }
+        _buffer.resize(size);
+        _mask = size - 1;
+    }
+
+    size_t capacity() const { return _buffer.size(); }
+
+    /**
+     * @brief Append the parts as one message (producer thread only)
+     * @return false, writing nothing, if the parts do not all fit
+     */
+    bool write(std::initializer_list<std::span<const uint8_t>> parts)
+    {
+        size_t total = 0;
+        for (auto part : parts) {
+            total += part.size();
+        }
+
+        size_t head = _head.load(std::memory_order_relaxed);
+        size_t tail = _tail.load(std::memory_order_acquire);
+        if (capacity() - (head - tail) < total) {
+            return false;
+        }
+
+        for (auto part : parts) {
+            size_t start = head & _mask;
+            size_t first = std::min(part.size(), capacity() - start);
+            std::memcpy(_buffer.data() + start, part.data(), first);
+            std::memcpy(_buffer.data(), part.data() + first,
+                        part.size() - first);
+            head += part.size();
+        }
+        _head.store(head, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Readable bytes (consumer thread only)
+     */
+    size_t size() const
+    {
+        return _head.load(std::memory_order_acquire) -
+               _tail.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Whether the consumer has released every byte written so far
+     * (producer thread only)
+     */
+    bool empty() const
+    {
+        return _tail.load(std::memory_order_acquire) ==
+               _head.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Oldest readable bytes up to the end of the buffer (consumer
+     * thread only); call again after consume() to get the wrapped part
+     */
+    std::span<const uint8_t> peek() const
+    {
+        size_t tail = _tail.load(std::memory_order_relaxed);
+        size_t readable = _head.load(std::memory_order_acquire) - tail;
+        size_t start = tail & _mask;
+        return {_buffer.data() + start,
+                std::min(readable, capacity() - start)};
+    }
+
+    /**
+     * @brief Release bytes returned by peek() (consumer thread only)
+     */
+    void consume(size_t count)
+    {
+        _tail.store(_tail.load(std::memory_order_relaxed) + count,
+                    std::memory_order_release);
+    }
+
+   private:
+    std::vector<uint8_t> _buffer;
+    size_t _mask = 0;
+    alignas(64) std::atomic<size_t> _head{0};  ///< Written by the producer
+    alignas(64) std::atomic<size_t> _tail{0};  ///< Written by the consumer
+};
+
+}  // namespace rtype
@@ -0,0 +1,195 @@
+/*
+** EPITECH PROJECT, 2025
+** r-type
+** File description:
+** Lz4Codec
+*/
+
+#include "Lz4Codec.hpp"
+
+#include <array>
+#include <cstring>
+
+namespace rtype::lz4 {
+
+namespace {
+
+constexpr size_t MIN_MATCH = 4;
+constexpr size_t LAST_LITERALS = 5;  ///< Format: a block ends with literals
+constexpr size_t MATCH_LIMIT = 12;   ///< Format: no match starts after this
+constexpr size_t MAX_OFFSET = 65535;
+constexpr unsigned HASH_LOG = 12;
+
+uint32_t read32(const uint8_t* p)
+{
+    uint32_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+uint32_t hash(uint32_t sequence)
+{
+    return (sequence * 2654435761u) >> (32 - HASH_LOG);
+}
+
+uint8_t* writeLength(uint8_t* op, size_t length)
+{
+    while (length >= 255) {
+        *op++ = 255;
+        length -= 255;
+    }
+    *op++ = static_cast<uint8_t>(length);
+    return op;
+}
+
+uint8_t* writeLiterals(uint8_t* op, uint8_t* token, const uint8_t* literals,
+                       size_t length)
+{
+    if (length >= 15) {
+        *token = 15 << 4;
+        op = writeLength(op, length - 15);
+    } else {
+        *token = static_cast<uint8_t>(length << 4);
+    }
+    // An empty block may come with null pointers, which memcpy rejects
+    if (length > 0) {
+        std::memcpy(op, literals, length);
+    }
+    return op + length;
+}
+
+bool readLength(const uint8_t*& ip, const uint8_t* iend, size_t& length)
+{
+    uint8_t byte;
+    do {
+        if (ip >= iend) {
+            return false;
+        }
+        byte = *ip++;
+        length += byte;
+    } while (byte == 255);
+    return true;
+}
+
+}  // namespace
+
+size_t compress(const uint8_t* src, size_t srcSize, uint8_t* dst)
+{
+    std::array<uint32_t, 1u << HASH_LOG> table{};
+    const uint8_t* ip = src;
+    const uint8_t* anchor = src;
+    const uint8_t* end = src + srcSize;
+    uint8_t* op = dst;
+
+    if (srcSize > MATCH_LIMIT) {
+        const uint8_t* matchLimit = end - MATCH_LIMIT;
+        const uint8_t* literalsStart = end - LAST_LITERALS;
+
+        while (ip < matchLimit) {
+            uint32_t sequence = read32(ip);
+            uint32_t& slot = table[hash(sequence)];
+            const uint8_t* ref = src + slot;
+            slot = static_cast<uint32_t>(ip - src);
+
+            if (ref >= ip || static_cast<size_t>(ip - ref) > MAX_OFFSET ||
+                read32(ref) != sequence) {
+                ip++;
+                continue;
+            }
+
+            size_t matchLength = MIN_MATCH;
+            while (ip + matchLength < literalsStart &&
+                   ref[matchLength] == ip[matchLength]) {
+                matchLength++;
+            }
+
+            uint8_t* token = op++;
+            op = writeLiterals(op, token, anchor,
+                               static_cast<size_t>(ip - anchor));
+
+            uint16_t offset = static_cast<uint16_t>(ip - ref);
+            *op++ = static_cast<uint8_t>(offset & 0xFF);
+            *op++ = static_cast<uint8_t>(offset >> 8);
+
+            size_t extra = matchLength - MIN_MATCH;
+            if (extra >= 15) {
+                *token |= 15;
+                op = writeLength(op, extra - 15);
+            } else {
+                *token |= static_cast<uint8_t>(extra);
+            }
+
+            ip += matchLength;
+            anchor = ip;
+        }
+    }
+
+    uint8_t* token = op++;
+    op = writeLiterals(op, token, anchor, static_cast<size_t>(end - anchor));
+    return static_cast<size_t>(op - dst);
+}
+
+bool decompress(const uint8_t* src, size_t srcSize, uint8_t* dst,
+                size_t dstSize)
+{
+    const uint8_t* ip = src;
+    const uint8_t* iend = src + srcSize;
+    uint8_t* op = dst;
+    uint8_t* oend = dst + dstSize;
+
+    while (ip < iend) {
+        uint8_t token = *ip++;
+
+        size_t literalLength = token >> 4;
+        if (literalLength == 15 && !readLength(ip, iend, literalLength)) {
+            return false;
+        }
+        if (literalLength > static_cast<size_t>(iend - ip) ||
+            literalLength > static_cast<size_t>(oend - op)) {
+            return false;
+        }
+        if (literalLength > 0) {
+            std::memcpy(op, ip, literalLength);
+        }
+        ip += literalLength;
+        op += literalLength;
+
+        if (ip == iend) {
+            break;
+        }
+
+        if (iend - ip < 2) {
+            return false;
+        }
+        size_t offset = static_cast<size_t>(ip[0]) |
+                        (static_cast<size_t>(ip[1]) << 8);
+        ip += 2;
+        if (offset == 0 || offset > static_cast<size_t>(op - dst)) {
+            return false;
+        }
+
+        size_t matchLength = token & 15;
+        if (matchLength == 15 && !readLength(ip, iend, matchLength)) {
+            return false;
+        }
+        matchLength += MIN_MATCH;
+        if (matchLength > static_cast<size_t>(oend - op)) {
+            return false;
+        }
+
+        const uint8_t* match = op - offset;
+        if (offset >= matchLength) {
+            std::memcpy(op, match, matchLength);
+            op += matchLength;
+        } else {
+            // Overlapping copy repeats the last offset bytes
+            for (size_t i = 0; i < matchLength; ++i) {
+                *op++ = *match++;
+            }
+        }
+    }
+
+    return op == oend;
+}
+
+}  // namespace rtype::lz4
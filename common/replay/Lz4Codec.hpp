@@ -0,0 +1,44 @@
+/*
+** EPITECH PROJECT, 2025
+** r-type
+** File description:
+** Lz4Codec
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace rtype::lz4 {
+
+/**
+ * @brief Largest output compress() can produce for srcSize input bytes
+ */
+inline constexpr size_t compressBound(size_t srcSize)
+{
+    return srcSize + srcSize / 255 + 16;
+}
+
+/**
+ * @brief Compress one block in the LZ4 block format
+ *
+ * Greedy single-pass matcher over a 4-byte hash table: much weaker than the
+ * reference implementation's compressor, but its output decodes with any
+ * LZ4 block decoder and decoding is just as fast.
+ *
+ * @param dst Must hold compressBound(srcSize) bytes
+ * @return Compressed size
+ */
+size_t compress(const uint8_t* src, size_t srcSize, uint8_t* dst);
+
+/**
+ * @brief Decompress one LZ4 block
+ * @param dstSize Exact decompressed size
+ * @return false if the input is malformed or does not decode to exactly
+ * dstSize bytes
+ */
+bool decompress(const uint8_t* src, size_t srcSize, uint8_t* dst,
+                size_t dstSize);
+
+}  // namespace rtype::lz4
@@ -0,0 +1,54 @@
+/*
+** EPITECH PROJECT, 2025
+** r-type
+** File description:
+** MappedFile
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+
+namespace rtype {
+
+/**
+ * @brief Read-only memory mapping of a whole file
+ *
+ * The operating system pages the file in on access, so opening is cheap
+ * whatever the file size and only the parts actually read become resident.
+ */
+class MappedFile {
+   public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    /**
+     * @brief Map a file, replacing any previous mapping
+     * @return false if the file cannot be opened, is empty or cannot be
+     * mapped
+     */
+    bool open(const std::string& filePath);
+
+    void close();
+
+    bool isOpen() const { return _data != nullptr; }
+    std::span<const uint8_t> data() const { return {_data, _size}; }
+
+   private:
+    const uint8_t* _data = nullptr;
+    size_t _size = 0;
+#ifdef _WIN32
+    void* _fileHandle = nullptr;
+    void* _mappingHandle = nullptr;
+#endif
+};
+
+}  // namespace rtype
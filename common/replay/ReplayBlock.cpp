@@ -0,0 +1,269 @@
+/*
+** EPITECH PROJECT, 2025
+** r-type
+** File description:
+** ReplayBlock
+*/
+
+#include "ReplayBlock.hpp"
+
+#include <cstring>
+
+#include "Lz4Codec.hpp"
+#include "common/network/Protocol.hpp"
+
+namespace rtype {
+
+namespace {
+
+/**
+ * @brief How a record is stored inside a block
+ */
+enum EncodedKind : uint8_t {
+    ENCODED_PACKET = 0,    ///< varint size + raw packet
+    ENCODED_KEYFRAME = 1,  ///< varint size + raw keyframe
+    ENCODED_POSITION = 2,  ///< S2C_ENTITY_POS as per-entity deltas
+};
+
+void putVarint(std::vector<uint8_t>& out, uint64_t value)
+{
+    while (value >= 0x80) {
+        out.push_back(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(value));
+}
+
+bool getVarint(const uint8_t*& p, const uint8_t* end, uint64_t& value)
+{
+    value = 0;
+    for (unsigned shift = 0; shift < 64; shift += 7) {
+        if (p >= end) {
+            return false;
+        }
+        uint8_t byte = *p++;
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+uint64_t zigzag(int64_t value)
+{
+    return (static_cast<uint64_t>(value) << 1) ^
+           static_cast<uint64_t>(value >> 63);
+}
+
+int64_t unzigzag(uint64_t value)
+{
+    return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+/**
+ * @brief Whether a packet is a position update stored as deltas
+ */
+bool isPositionPacket(std::span<const uint8_t> payload)
+{
+    if (payload.size() != sizeof(EntityPositionPacket)) {
+        return false;
+    }
+    EntityPositionPacket packet;
+    std::memcpy(&packet, payload.data(), sizeof(packet));
+    return packet.header.opCode == S2C_ENTITY_POS &&
+           packet.header.packetSize == sizeof(EntityPositionPacket);
+}
+
+uint32_t floatBits(float value)
+{
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+float bitsFloat(uint32_t bits)
+{
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+/**
+ * @brief Write one record at out, which must stay within end
+ * @return false if the record does not fit
+ */
+bool writeRecord(uint8_t*& out, const uint8_t* end, uint64_t timestamp,
+                 replay::RecordKind kind, const void* payload, size_t size)
+{
+    if (static_cast<size_t>(end - out) <
+        sizeof(replay::RecordHeader) + size) {
+        return false;
+    }
+    replay::RecordHeader header;
+    header.timestamp = timestamp;
+    header.kind = static_cast<uint8_t>(kind);
+    header.size = static_cast<uint32_t>(size);
+
+    std::memcpy(out, &header, sizeof(header));
+    std::memcpy(out + sizeof(header), payload, size);
+    out += sizeof(header) + size;
+    return true;
+}
+
+}  // namespace
+
+void ReplayBlockEncoder::add(uint64_t timestamp, replay::RecordKind kind,
+                             std::span<const uint8_t> payload)
+{
+    if (_recordCount == 0) {
+        _firstTimestamp = timestamp;
+        _lastTimestamp = timestamp;
+        _flags = kind == replay::RecordKind::KEYFRAME ? replay::BLOCK_KEYFRAME
+                                                       : 0;
+    }
+    int64_t timeDelta = static_cast<int64_t>(timestamp - _lastTimestamp);
+    _lastTimestamp = timestamp;
+
+    if (kind == replay::RecordKind::PACKET && isPositionPacket(payload)) {
+        EntityPositionPacket packet;
+        std::memcpy(&packet, payload.data(), sizeof(packet));
+        uint32_t entityId = packet.entityId;
+        Position& previous = _positions[entityId];
+        uint32_t x = floatBits(packet.x);
+        uint32_t y = floatBits(packet.y);
+
+        _encoded.push_back(ENCODED_POSITION);
+        putVarint(_encoded, zigzag(timeDelta));
+        putVarint(_encoded, entityId);
+        putVarint(_encoded, zigzag(static_cast<int32_t>(
+                                packet.header.sequenceId - _lastSequence)));
+        putVarint(_encoded, zigzag(static_cast<int32_t>(x - previous.x)));
+        putVarint(_encoded, zigzag(static_cast<int32_t>(y - previous.y)));
+        _lastSequence = packet.header.sequenceId;
+        previous = {x, y};
+    } else {
+        _encoded.push_back(kind == replay::RecordKind::KEYFRAME
+                               ? ENCODED_KEYFRAME
+                               : ENCODED_PACKET);
+        putVarint(_encoded, zigzag(timeDelta));
+        putVarint(_encoded, payload.size());
+        _encoded.insert(_encoded.end(), payload.begin(), payload.end());
+    }
+
+    _recordCount++;
+    _decodedSize +=
+        static_cast<uint32_t>(sizeof(replay::RecordHeader) + payload.size());
+}
+
+replay::BlockHeader ReplayBlockEncoder::finish(std::vector<uint8_t>& out)
+{
+    replay::BlockHeader header;
+    header.firstTimestamp = _firstTimestamp;
+    header.lastTimestamp = _lastTimestamp;
+    header.recordCount = _recordCount;
+    header.encodedSize = static_cast<uint32_t>(_encoded.size());
+    header.decodedSize = _decodedSize;
+    header.flags = _flags;
+
+    out.resize(sizeof(header) + lz4::compressBound(_encoded.size()));
+    header.compressedSize = static_cast<uint32_t>(lz4::compress(
+        _encoded.data(), _encoded.size(), out.data() + sizeof(header)));
+    std::memcpy(out.data(), &header, sizeof(header));
+    out.resize(sizeof(header) + header.compressedSize);
+
+    _encoded.clear();
+    _positions.clear();
+    _lastSequence = 0;
+    _recordCount = 0;
+    _decodedSize = 0;
+    _flags = 0;
+    return header;
+}
+
+bool ReplayBlockDecoder::decode(const replay::BlockHeader& header,
+                                std::span<const uint8_t> payload,
+                                std::vector<uint8_t>& records)
+{
+    records.clear();
+    // Sizes a damaged header could claim but no encoder can produce
+    if (header.encodedSize > uint64_t{header.compressedSize} * 255 ||
+        header.decodedSize > uint64_t{header.encodedSize} * 16) {
+        return false;
+    }
+
+    _encoded.resize(header.encodedSize);
+    if (payload.size() != header.compressedSize ||
+        !lz4::decompress(payload.data(), payload.size(), _encoded.data(),
+                         _encoded.size())) {
+        return false;
+    }
+
+    // Records are written in place: decodedSize bounds the whole block
+    records.resize(header.decodedSize);
+    uint8_t* out = records.data();
+    const uint8_t* outEnd = out + records.size();
+    _positions.clear();
+    const uint8_t* p = _encoded.data();
+    const uint8_t* end = p + _encoded.size();
+    uint64_t timestamp = header.firstTimestamp;
+    uint32_t sequence = 0;
+
+    for (uint32_t i = 0; i < header.recordCount; ++i) {
+        if (p >= end) {
+            return false;
+        }
+        uint8_t kind = *p++;
+        uint64_t timeDelta;
+        if (!getVarint(p, end, timeDelta)) {
+            return false;
+        }
+        timestamp += static_cast<uint64_t>(unzigzag(timeDelta));
+
+        if (kind == ENCODED_POSITION) {
+            uint64_t entityId, sequenceDelta, xDelta, yDelta;
+            if (!getVarint(p, end, entityId) ||
+                !getVarint(p, end, sequenceDelta) ||
+                !getVarint(p, end, xDelta) || !getVarint(p, end, yDelta)) {
+                return false;
+            }
+            Position& previous = _positions[static_cast<uint32_t>(entityId)];
+            sequence += static_cast<uint32_t>(unzigzag(sequenceDelta));
+            previous.x += static_cast<uint32_t>(unzigzag(xDelta));
+            previous.y += static_cast<uint32_t>(unzigzag(yDelta));
+
+            EntityPositionPacket packet;
+            packet.header.opCode = S2C_ENTITY_POS;
+            packet.header.packetSize = sizeof(EntityPositionPacket);
+            packet.header.sequenceId = sequence;
+            packet.entityId = static_cast<uint32_t>(entityId);
+            packet.x = bitsFloat(previous.x);
+            packet.y = bitsFloat(previous.y);
+            if (!writeRecord(out, outEnd, timestamp,
+                             replay::RecordKind::PACKET, &packet,
+                             sizeof(packet))) {
+                return false;
+            }
+        } else if (kind == ENCODED_PACKET || kind == ENCODED_KEYFRAME) {
+            uint64_t size;
+            if (!getVarint(p, end, size) ||
+                size > static_cast<uint64_t>(end - p)) {
+                return false;
+            }
+            if (!writeRecord(out, outEnd, timestamp,
+                             kind == ENCODED_KEYFRAME
+                                 ? replay::RecordKind::KEYFRAME
+                                 : replay::RecordKind::PACKET,
+                             p, static_cast<size_t>(size))) {
+                return false;
+            }
+            p += size;
+        } else {
+            return false;
+        }
+    }
+    records.resize(static_cast<size_t>(out - records.data()));
+    return p == end;
+}
+
+}  // namespace rtype
@@ -0,0 +1,98 @@
+/*
+** EPITECH PROJECT, 2025
+** r-type
+** File description:
+** ReplayBlock
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include "ReplayFormat.hpp"
+
+namespace rtype {
+
+/**
+ * @brief Groups replay records into version 3 blocks
+ *
+ * Inside a block, timestamps are stored as varint deltas. Entity position
+ * packets, which make up most of a replay, are stored as the entity ID
+ * plus the change of the sequence ID and of each coordinate's bits since
+ * that entity's previous position in the block. The result is then LZ4
+ * compressed. All delta state is reset per block, so any block decodes
+ * without the ones before it.
+ */
+class ReplayBlockEncoder {
+   public:
+    /**
+     * @brief Decoded size at which the recorder closes a block
+     */
+    static constexpr size_t TARGET_SIZE = 64 * 1024;
+
+    void add(uint64_t timestamp, replay::RecordKind kind,
+             std::span<const uint8_t> payload);
+
+    bool empty() const { return _recordCount == 0; }
+
+    /**
+     * @brief Size of the pending records as version 2 records
+     */
+    size_t getDecodedSize() const { return _decodedSize; }
+
+    /**
+     * @brief Compress the pending records and start a new block
+     * @param out Receives the BlockHeader followed by the payload
+     * @return The header written to out
+     */
+    replay::BlockHeader finish(std::vector<uint8_t>& out);
+
+   private:
+    struct Position {
+        uint32_t x;  ///< Float bits
+        uint32_t y;
+    };
+
+    std::vector<uint8_t> _encoded;
+    std::unordered_map<uint32_t, Position> _positions;
+    uint64_t _firstTimestamp = 0;
+    uint64_t _lastTimestamp = 0;
+    uint32_t _lastSequence = 0;
+    uint32_t _recordCount = 0;
+    uint32_t _decodedSize = 0;
+    uint8_t _flags = 0;
+};
+
+/**
+ * @brief Expands version 3 blocks back into version 2 records
+ *
+ * Keeps its buffers between blocks, so decoding does not allocate once they
+ * have grown to the largest block.
+ */
+class ReplayBlockDecoder {
+   public:
+    /**
+     * @brief Decode one block
+     * @param payload The compressedSize bytes after the header
+     * @param records Receives RecordHeader + payload per record
+     * @return false if the block is damaged
+     */
+    bool decode(const replay::BlockHeader& header,
+                std::span<const uint8_t> payload,
+                std::vector<uint8_t>& records);
+
+   private:
+    struct Position {
+        uint32_t x;
+        uint32_t y;
+    };
+
+    std::vector<uint8_t> _encoded;
+    std::unordered_map<uint32_t, Position> _positions;
+};
+
+}  // namespace rtype
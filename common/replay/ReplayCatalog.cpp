@@ -0,0 +1,308 @@
+/*
+** EPITECH PROJECT, 2025
+** r-type
+** File description:
+** ReplayCatalog
+*/
+
+#include "ReplayCatalog.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <unordered_map>
+#include <utility>
+
+#include "ReplayStream.hpp"
+
+namespace rtype {
+
+namespace {
+
+constexpr char CACHE_MAGIC[4] = {'R', 'T', 'I', 'C'};
+constexpr uint32_t CACHE_VERSION = 1;
+
+template <typename T>
+void writeValue(std::ofstream& file, const T& value)
+{
+    file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+template <typename T>
+bool readValue(std::ifstream& file, T& value)
+{
+    return static_cast<bool>(
+        file.read(reinterpret_cast<char*>(&value), sizeof(value)));
+}
+
+}  // namespace
+
+ReplayCatalog::ReplayCatalog(std::string directory)
+    : _directory(std::move(directory))
+{
+}
+
+ReplayCatalog::~ReplayCatalog()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    if (_scanner.joinable()) {
+        _scanner.join();
+    }
+}
+
+void ReplayCatalog::refresh()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _rescan = true;
+    if (_scanning) {
+        return;
+    }
+
+    // The previous scanner has left scanLoop, joining does not block
+    if (_scanner.joinable()) {
+        _scanner.join();
+    }
+    _scanning = true;
+    _scanner = std::thread(&ReplayCatalog::scanLoop, this);
+}
+
+bool ReplayCatalog::poll(std::vector<ReplaySummary>& summaries)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (!_published) {
+        return false;
+    }
+    summaries = _summaries;
+    _published = false;
+    return true;
+}
+
+bool ReplayCatalog::isScanning() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _scanning;
+}
+
+void ReplayCatalog::scanLoop()
+{
+    for (;;) {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (_stop || !_rescan) {
+                _scanning = false;
+                return;
+            }
+            _rescan = false;
+        }
+        scan();
+    }
+}
+
+void ReplayCatalog::scan()
+{
+    if (!_cacheLoaded) {
+        loadCache();
+        _cacheLoaded = true;
+        if (!_cache.empty()) {
+            publish(_cache);
+        }
+    }
+
+    std::error_code error;
+    if (!std::filesystem::exists(_directory, error)) {
+        std::filesystem::create_directories(_directory, error);
+    }
+
+    std::unordered_map<std::string, const ReplaySummary*> cached;
+    for (const auto& summary : _cache) {
+        cached[summary.fileName] = &summary;
+    }
+
+    std::vector<ReplaySummary> found;
+    bool changed = false;
+    std::filesystem::directory_iterator it(_directory, error);
+    for (; !error && it != std::filesystem::directory_iterator();
+         it.increment(error)) {
+        if (shouldStop()) {
+            return;
+        }
+
+        const auto& entry = *it;
+        std::error_code entryError;
+        if (!entry.is_regular_file(entryError) ||
+            entry.path().extension() != ".rtr") {
+            continue;
+        }
+
+        auto match = cached.find(entry.path().filename().string());
+        if (match != cached.end() &&
+            match->second->fileSize == entry.file_size(entryError) &&
+            match->second->writeTime ==
+                entry.last_write_time(entryError).time_since_epoch().count()) {
+            found.push_back(*match->second);
+            continue;
+        }
+
+        // Unreadable files are still listed so they can be deleted
+        ReplaySummary summary;
+        readSummary(entry.path(), summary);
+        found.push_back(std::move(summary));
+        changed = true;
+    }
+    changed = changed || found.size() != _cache.size();
+
+    std::sort(found.begin(), found.end(),
+              [](const ReplaySummary& a, const ReplaySummary& b) {
+                  if (a.metadata.recordedAt != b.metadata.recordedAt) {
+                      return a.metadata.recordedAt > b.metadata.recordedAt;
+                  }
+                  return a.fileName < b.fileName;
+              });
+    _cache = found;
+    if (changed) {
+        saveCache();
+    }
+    publish(std::move(found));
+}
+
+void ReplayCatalog::publish(std::vector<ReplaySummary> summaries)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _summaries = std::move(summaries);
+    _published = true;
+}
+
+bool ReplayCatalog::shouldStop() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _stop;
+}
+
+bool ReplayCatalog::readSummary(const std::filesystem::path& path,
+                                ReplaySummary& summary)
+{
+    std::error_code error;
+    auto writeTime = std::filesystem::last_write_time(path, error);
+    summary.fileName = path.filename().string();
+    summary.fileSize = std::filesystem::file_size(path, error);
+    summary.writeTime = writeTime.time_since_epoch().count();
+    summary.version = 0;
+    summary.metadata = {};
+    auto systemTime =
+        std::chrono::time_point_cast<std::chrono::system_clock::duration>(
+            writeTime - std::filesystem::file_time_type::clock::now() +
+            std::chrono::system_clock::now());
+    summary.metadata.recordedAt = static_cast<int64_t>(
+        std::chrono::system_clock::to_time_t(systemTime));
+
+    std::ifstream file(path, std::ios::binary);
+    char magic[sizeof(replay::MAGIC)];
+    uint32_t version;
+    if (!file.read(magic, sizeof(magic)) ||
+        std::memcmp(magic, replay::MAGIC, sizeof(magic)) != 0 ||
+        !readValue(file, version)) {
+        return false;
+    }
+    summary.version = version;
+
+    if (version >= replay::VERSION_4) {
+        replay::ReplayMetadata metadata;
+        if (!readValue(file, metadata)) {
+            return false;
+        }
+        summary.metadata = metadata;
+        if (metadata.flags & replay::METADATA_COMPLETE) {
+            return true;
+        }
+    }
+
+    // Older or interrupted recordings: the index footer, or a scan, gives
+    // the duration and record count
+    ReplayStream stream;
+    if (!stream.open(path.string())) {
+        return false;
+    }
+    summary.metadata.duration = stream.getDuration();
+    summary.metadata.packetCount =
+        stream.getRecordCount() - stream.getKeyframes().size();
+    return true;
+}
+
+void ReplayCatalog::loadCache()
+{
+    std::ifstream file(std::filesystem::path(_directory) / INDEX_FILE_NAME,
+                       std::ios::binary);
+    char magic[sizeof(CACHE_MAGIC)];
+    uint32_t version;
+    uint32_t count;
+    if (!file.read(magic, sizeof(magic)) ||
+        std::memcmp(magic, CACHE_MAGIC, sizeof(magic)) != 0 ||
+        !readValue(file, version) || version != CACHE_VERSION ||
+        !readValue(file, count)) {
+        return;
+    }
+
+    std::vector<ReplaySummary> cache;
+    for (uint32_t i = 0; i < count; ++i) {
+        ReplaySummary summary;
+        uint16_t nameLength;
+        if (!readValue(file, nameLength)) {
+            return;
+        }
+        summary.fileName.resize(nameLength);
+        if (!file.read(summary.fileName.data(), nameLength) ||
+            !readValue(file, summary.fileSize) ||
+            !readValue(file, summary.writeTime) ||
+            !readValue(file, summary.version) ||
+            !readValue(file, summary.metadata)) {
+            return;
+        }
+        cache.push_back(std::move(summary));
+    }
+    _cache = std::move(cache);
+}
+
+void ReplayCatalog::saveCache() const
+{
+    std::filesystem::path path =
+        std::filesystem::path(_directory) / INDEX_FILE_NAME;
+    std::filesystem::path tempPath = path;
+    tempPath += ".tmp";
+
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            return;
+        }
+        file.write(CACHE_MAGIC, sizeof(CACHE_MAGIC));
+        writeValue(file, CACHE_VERSION);
+        writeValue(file, static_cast<uint32_t>(_cache.size()));
+        for (const auto& summary : _cache) {
+            auto nameLength = static_cast<uint16_t>(summary.fileName.size());
+            writeValue(file, nameLength);
+            file.write(summary.fileName.data(), nameLength);
+            writeValue(file, summary.fileSize);
+            writeValue(file, summary.writeTime);
+            writeValue(file, summary.version);
+            writeValue(file, summary.metadata);
+        }
+        if (!file) {
+            return;
+        }
+    }
+
+    // Readers never see a half-written index
+    std::error_code error;
+    std::filesystem::rename(tempPath, path, error);
+    if (error) {
+        std::cerr << "[WARN] Failed to save replay index: " << error.message()
+                  << std::endl;
+    }
+}
+
+}  // namespace rtype
@@ -0,0 +1,98 @@
+/*
+** EPITECH PROJECT, 2025
+** r-type
+** File description:
+** ReplayCatalog
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ReplayFormat.hpp"
+
+namespace rtype {
+
+/**
+ * @brief What a replay browser shows about one replay file
+ */
+struct ReplaySummary {
+    std::string fileName;
+    uint64_t fileSize = 0;
+    int64_t writeTime = 0;  ///< Last write, in filesystem clock ticks
+    uint32_t version = 0;
+    /// Read from the file header (version 4) or rebuilt from the index
+    /// footer of older files; recordedAt falls back to the write time
+    replay::ReplayMetadata metadata{};
+};
+
+/**
+ * @brief Lists the replays of a directory without parsing them
+ *
+ * Summaries are cached in a .index file inside the directory, keyed by file
+ * name, size and write time. refresh() scans on a background thread: the
+ * cached list is published first, then only new or changed files are
+ * opened, which for version 4 means reading their first bytes. Callers poll
+ * for the latest list from their own thread.
+ */
+class ReplayCatalog {
+   public:
+    explicit ReplayCatalog(std::string directory);
+    ~ReplayCatalog();
+
+    ReplayCatalog(const ReplayCatalog&) = delete;
+    ReplayCatalog& operator=(const ReplayCatalog&) = delete;
+
+    /**
+     * @brief Rescan the directory in the background
+     *
+     * Calls made while a scan runs queue one more scan after it.
+     */
+    void refresh();
+
+    /**
+     * @brief Take the latest list if it changed since the last poll
+     * @param summaries Receives the replays, most recent first
+     * @return false if there is nothing new
+     */
+    bool poll(std::vector<ReplaySummary>& summaries);
+
+    bool isScanning() const;
+
+    /**
+     * @brief Read the summary of one replay file
+     * @return false if the file is not a replay
+     */
+    static bool readSummary(const std::filesystem::path& path,
+                            ReplaySummary& summary);
+
+    static constexpr const char* INDEX_FILE_NAME = ".index";
+
+   private:
+    std::string _directory;
+    std::thread _scanner;
+    mutable std::mutex _mutex;
+    bool _scanning = false;
+    bool _rescan = false;
+    bool _stop = false;
+    bool _published = false;
+    std::vector<ReplaySummary> _summaries;  // Guarded by _mutex
+
+    // Scanner thread state
+    std::vector<ReplaySummary> _cache;
+    bool _cacheLoaded = false;
+
+    void scanLoop();
+    void scan();
+    void publish(std::vector<ReplaySummary> summaries);
+    bool shouldStop() const;
+    void loadCache();
+    void saveCache() const;
+};
+
+}  // namespace rtype
@@ -0,0 +1,195 @@
+/*
+** EPITECH PROJECT, 2025
+** r-type
+** File description:
+** ReplayFormat
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace rtype {
+
+/**
+ * @brief Layout of .rtr replay files
+ *
+ * Version 1:
+ * - Header: "RTYPE_REPLAY\0" + version (uint32_t)
+ * - Each entry: timestamp (uint64_t ms) + packet size (uint16_t) + raw packet
+ *
+ * Version 2:
+ * - Header: same as version 1, with version = 2
+ * - Each record: timestamp (uint64_t ms) + kind (uint8_t) + size (uint32_t)
+ *   + payload. A PACKET payload is one raw server packet. A KEYFRAME payload
+ *   is a sequence of size (uint16_t) + raw packet that rebuilds the whole
+ *   game state when fed to an empty client.
+ * - Index, written when recording stops: one timestamp (uint64_t) + record
+ *   offset (uint64_t) per keyframe, then the index footer (which also holds
+ *   the duration and record count). A file without a footer (interrupted
+ *   recording) is still readable, its records are scanned.
+ *
+ * Version 3:
+ * - Header: same as version 1, with version = 3
+ * - Records are grouped in blocks: BlockHeader + LZ4-compressed payload.
+ *   Each block decodes on its own (see ReplayBlock.hpp). A keyframe is
+ *   always the first record of its block.
+ * - Index, written when recording stops: one BlockIndexEntry per block,
+ *   then the index footer. Without a footer the block headers are scanned.
+ *
+ * Version 4:
+ * - Header: same as version 1, with version = 4, followed by a fixed-size
+ *   ReplayMetadata. The recorder writes it when recording starts and fills
+ *   it in when recording stops, so listing replays only reads the start of
+ *   each file.
+ * - Blocks and index: same as version 3.
+ */
+namespace replay {
+
+inline constexpr char MAGIC[] = "RTYPE_REPLAY";
+inline constexpr uint32_t VERSION_1 = 1;
+inline constexpr uint32_t VERSION_2 = 2;
+inline constexpr uint32_t VERSION_3 = 3;
+inline constexpr uint32_t VERSION_4 = 4;
+inline constexpr uint32_t CURRENT_VERSION = VERSION_4;
+
+/**
+ * @brief Size of the file header (magic with its terminator + version)
+ */
+inline constexpr size_t HEADER_SIZE = sizeof(MAGIC) + sizeof(uint32_t);
+
+enum class RecordKind : uint8_t {
+    PACKET = 0,    ///< One server packet
+    KEYFRAME = 1,  ///< Full game state as a packet sequence
+};
+
+#pragma pack(push, 1)
+
+struct RecordHeader {
+    uint64_t timestamp;  ///< Milliseconds from the start of the recording
+    uint8_t kind;        ///< RecordKind
+    uint32_t size;       ///< Payload size in bytes
+};
+
+struct IndexEntry {
+    uint64_t timestamp;  ///< Keyframe timestamp in milliseconds
+    uint64_t offset;     ///< File offset of the keyframe record header
+};
+
+/**
+ * @brief Flags of a version 3 block
+ */
+enum BlockFlags : uint8_t {
+    BLOCK_KEYFRAME = 1,  ///< The first record is a keyframe
+};
+
+struct BlockHeader {
+    uint64_t firstTimestamp;  ///< Timestamp of the first record
+    uint64_t lastTimestamp;   ///< Timestamp of the last record
+    uint32_t recordCount;
+    uint32_t encodedSize;     ///< Payload size once decompressed
+    uint32_t compressedSize;  ///< Payload size in the file
+    uint32_t decodedSize;     ///< Size as version 2 records
+    uint8_t flags;            ///< BlockFlags
+};
+
+struct BlockIndexEntry {
+    uint64_t firstTimestamp;  ///< Timestamp of the block's first record
+    uint64_t offset;          ///< File offset of the BlockHeader
+    uint8_t flags;            ///< BlockFlags
+};
+
+struct IndexFooter {
+    uint32_t entryCount;   ///< IndexEntry (v2) or BlockIndexEntry (v3) count
+    uint64_t indexOffset;  ///< File offset of the first index entry
+    uint64_t duration;     ///< Timestamp of the last record
+    uint64_t recordCount;  ///< Records before the index
+    char magic[4];         ///< INDEX_MAGIC
+};
+
+/**
+ * @brief Flags of ReplayMetadata
+ */
+enum MetadataFlags : uint8_t {
+    METADATA_COMPLETE = 1,  ///< Filled in by stopRecording
+};
+
+/**
+ * @brief Summary of a version 4 replay, stored right after the file header
+ *
+ * Only recordedAt is set until the recording stops cleanly.
+ */
+struct ReplayMetadata {
+    int64_t recordedAt;    ///< Unix time in seconds at the start
+    uint64_t duration;     ///< Timestamp of the last record in milliseconds
+    uint64_t packetCount;  ///< PACKET records (keyframes excluded)
+    uint32_t finalScore;
+    uint8_t level;        ///< Last level played, 0 if unknown
+    uint8_t playerCount;  ///< Most players in the game at once
+    uint8_t flags;        ///< MetadataFlags
+    uint8_t reserved[17];
+};
+
+#pragma pack(pop)
+
+inline constexpr char INDEX_MAGIC[4] = {'R', 'T', 'I', 'X'};
+
+/**
+ * @brief File offset of the first record (or block) of a version
+ */
+inline constexpr size_t getDataStart(uint32_t version)
+{
+    return version >= VERSION_4 ? HEADER_SIZE + sizeof(ReplayMetadata)
+                                : HEADER_SIZE;
+}
+
+/**
+ * @brief Append a packet to a keyframe payload
+ *
+ * The header's opCode must already be set; its size and sequence ID are
+ * filled here.
+ */
+template <typename Packet>
+void appendKeyframePacket(std::vector<uint8_t>& keyframe, Packet packet)
+{
+    packet.header.packetSize = static_cast<uint16_t>(sizeof(Packet));
+    packet.header.sequenceId = 0;
+
+    uint16_t size = static_cast<uint16_t>(sizeof(Packet));
+    size_t offset = keyframe.size();
+    keyframe.resize(offset + sizeof(size) + sizeof(Packet));
+    std::memcpy(keyframe.data() + offset, &size, sizeof(size));
+    std::memcpy(keyframe.data() + offset + sizeof(size), &packet,
+                sizeof(Packet));
+}
+
+/**
+ * @brief Call callback(data, size) for each packet of a keyframe payload
+ * @return false if the payload is truncated
+ */
+template <typename Callback>
+bool forEachKeyframePacket(const uint8_t* data, size_t size,
+                           Callback&& callback)
+{
+    size_t offset = 0;
+    while (offset < size) {
+        uint16_t packetSize;
+        if (size - offset < sizeof(packetSize)) {
+            return false;
+        }
+        std::memcpy(&packetSize, data + offset, sizeof(packetSize));
+        offset += sizeof(packetSize);
+        if (size - offset < packetSize) {
+            return false;
+        }
+        callback(data + offset, static_cast<size_t>(packetSize));
+        offset += packetSize;
+    }
+    return true;
+}
+
+}  // namespace replay
+
+}  // namespace rtype
@@ -7,7 +7,7 @@
 
 #include "ReplayPlayer.hpp"
 
-#include <cstring>
+#include <algorithm>
 #include <filesystem>
 #include <iostream>
 
@@ -15,7 +15,6 @@ namespace rtype {
 
 ReplayPlayer::ReplayPlayer(const std::string& filePath)
     : _filePath(filePath),
-      _currentIndex(0),
       _currentTime(0),
       _totalDuration(0),
       _isPaused(false),
@@ -27,41 +26,32 @@ ReplayPlayer::ReplayPlayer(const std::string& filePath)
 
 bool ReplayPlayer::load()
 {
-    std::ifstream file(_filePath, std::ios::binary);
-    if (!file.is_open()) {
+    if (!_stream.open(_filePath)) {
         std::cerr << "Failed to open replay file: " << _filePath << std::endl;
         return false;
     }
 
-    if (!readHeader(file)) {
-        std::cerr << "Invalid replay file header" << std::endl;
-        return false;
-    }
-
-    if (!readEntries(file)) {
-        std::cerr << "Failed to read replay entries" << std::endl;
-        return false;
-    }
-
-    if (!_entries.empty()) {
-        _totalDuration = _entries.back().timestamp;
-    }
+    _totalDuration = _stream.getDuration();
+    _currentPosition = _stream.getStart();
 
-    std::cout << "Loaded replay: " << _filePath << " with " << _entries.size()
-              << " entries, duration: " << _totalDuration << "ms" << std::endl;
+    std::cout << "Loaded replay: " << _filePath << " with "
+              << _stream.getRecordCount() << " entries, "
+              << _stream.getKeyframes().size() << " keyframes, duration: "
+              << _totalDuration << "ms" << std::endl;
 
     return true;
 }
 
 void ReplayPlayer::startPlayback(PacketCallback callback)
 {
-    if (_entries.empty()) {
+    if (_stream.getRecordCount() == 0) {
         std::cerr << "No replay data loaded!" << std::endl;
         return;
     }
 
     _callback = callback;
-    _currentIndex = 0;
+    _state.clear();
+    _currentPosition = _stream.getStart();
     _currentTime = 0;
     _isPaused = false;
     _isPlaying = true;
@@ -87,7 +77,16 @@ void ReplayPlayer::update(float deltaTime)
     uint64_t deltaMs = static_cast<uint64_t>(deltaTime * 1000.0f * speedMult);
     _currentTime += deltaMs;
 
-    processPacketsUntilTime(_currentTime);
+    if (!isFastForwarding()) {
+        processPacketsUntilTime(_currentTime, true);
+        return;
+    }
+    // Only the state at the end of the frame will be drawn
+    _state.beginChanges();
+    processPacketsUntilTime(_currentTime, false);
+    if (_callback) {
+        _state.emitChanges(_callback);
+    }
 }
 
 void ReplayPlayer::togglePause() { _isPaused = !_isPaused; }
@@ -98,6 +97,11 @@ bool ReplayPlayer::isPaused() const { return _isPaused; }
 
 bool ReplayPlayer::isSeeking() const { return _isSeeking; }
 
+bool ReplayPlayer::isFastForwarding() const
+{
+    return getSpeedMultiplier() > MAX_DIRECT_SPEED;
+}
+
 void ReplayPlayer::seek(float seconds)
 {
     int64_t seekMs = static_cast<int64_t>(seconds * 1000.0f);
@@ -121,19 +125,67 @@ void ReplayPlayer::seek(float seconds)
         _isPaused = false;
     }
 
-    if (_resetCallback) {
-        _resetCallback();
+    // Going forward inside the current keyframe interval only needs the
+    // packets in between; anything else restarts from the closest keyframe
+    size_t keyframe = _stream.findKeyframe(targetTime);
+    bool canContinue =
+        targetTime >= _currentTime &&
+        (keyframe == ReplayStream::NO_KEYFRAME ||
+         _stream.getKeyframes()[keyframe].position < _currentPosition);
+
+    if (canContinue) {
+        _state.beginChanges();
+        processPacketsUntilTime(targetTime, false);
+        if (_callback) {
+            _state.emitChanges(_callback);
+        }
+    } else {
+        if (keyframe == ReplayStream::NO_KEYFRAME) {
+            _state.clear();
+            _currentPosition = _stream.getStart();
+        } else {
+            restoreKeyframe(keyframe);
+        }
+        processPacketsUntilTime(targetTime, false);
+        materializeState();
     }
-
-    _currentIndex = 0;
     _currentTime = targetTime;
 
-    std::cout << "[REPLAY] Replaying packets from start to " << targetTime
-              << "ms..." << std::endl;
-    processPacketsUntilTime(targetTime);
+    std::cout << "[REPLAY] Seek complete" << std::endl;
+}
+
+void ReplayPlayer::saveCheckpoint(ReplayCheckpoint& checkpoint) const
+{
+    checkpoint.time = _currentTime;
+    checkpoint.position = _currentPosition;
+    checkpoint.state = _state;
+}
+
+void ReplayPlayer::seekFromCheckpoint(const ReplayCheckpoint& checkpoint,
+                                      uint64_t targetTime)
+{
+    targetTime = std::min(std::max(targetTime, checkpoint.time),
+                          _totalDuration);
+    _isSeeking = true;
+    _isPaused = false;
 
-    std::cout << "[REPLAY] Seek complete, processed " << _currentIndex
-              << " packets" << std::endl;
+    _state = checkpoint.state;
+    _currentPosition = checkpoint.position;
+    _state.beginChanges();
+    processPacketsUntilTime(targetTime, false);
+    if (_callback) {
+        _state.emitChanges(_callback);
+    }
+    _currentTime = targetTime;
+}
+
+uint64_t ReplayPlayer::getSeekStartTime(uint64_t targetTime) const
+{
+    size_t keyframe = _stream.findKeyframe(targetTime);
+    if (keyframe == ReplayStream::NO_KEYFRAME) {
+        return 0;
+    }
+    return _stream.getKeyframes()[keyframe].timestamp;
 }
 
 void ReplayPlayer::setSpeed(PlaybackSpeed speed) { _speed = speed; }
@@ -147,6 +199,12 @@ float ReplayPlayer::getSpeedMultiplier() const
             return 1.0f;
         case PlaybackSpeed::Double:
             return 2.0f;
+        case PlaybackSpeed::Quadruple:
+            return 4.0f;
+        case PlaybackSpeed::Octuple:
+            return 8.0f;
+        case PlaybackSpeed::Sixteenfold:
+            return 16.0f;
         default:
             return 1.0f;
     }
@@ -154,7 +212,7 @@ float ReplayPlayer::getSpeedMultiplier() const
 
 bool ReplayPlayer::isFinished() const
 {
-    return _currentIndex >= _entries.size();
+    return _currentPosition >= _stream.getEnd();
 }
 
 uint64_t ReplayPlayer::getCurrentTime() const { return _currentTime; }
@@ -169,7 +227,8 @@ std::string ReplayPlayer::getReplayName() const
 
 void ReplayPlayer::reset()
 {
-    _currentIndex = 0;
+    _state.clear();
+    _currentPosition = _stream.getStart();
     _currentTime = 0;
     _isPaused = false;
 }
@@ -178,69 +237,59 @@ void ReplayPlayer::stop()
 {
     _isPlaying = false;
     _isPaused = false;
-    _currentIndex = 0;
+    _state.clear();
+    _currentPosition = _stream.getStart();
     _currentTime = 0;
 }
 
-bool ReplayPlayer::readHeader(std::ifstream& file)
+void ReplayPlayer::restoreKeyframe(size_t keyframe)
 {
-    char magic[14] = {0};
-    file.read(magic, 13);
-    if (std::strcmp(magic, "RTYPE_REPLAY") != 0) {
-        return false;
-    }
-
-    uint32_t version;
-    file.read(reinterpret_cast<char*>(&version), sizeof(version));
-    if (version != 1) {
-        std::cerr << "Unsupported replay version: " << version << std::endl;
-        return false;
+    ReplayRecord record;
+    if (!_stream.readRecord(_stream.getKeyframes()[keyframe].position,
+                            record)) {
+        _state.clear();
+        _currentPosition = _stream.getStart();
+        return;
     }
-
-    return true;
+    _state.applyKeyframe(record.payload.data(), record.payload.size());
+    _currentPosition = record.next;
 }
 
-bool ReplayPlayer::readEntries(std::ifstream& file)
+void ReplayPlayer::materializeState()
 {
-    while (file.good() && !file.eof()) {
-        ReplayEntry entry;
-
-        file.read(reinterpret_cast<char*>(&entry.timestamp),
-                  sizeof(entry.timestamp));
-        if (file.eof()) break;
-        if (!file.good()) return false;
-
-        uint16_t packetSize;
-        file.read(reinterpret_cast<char*>(&packetSize), sizeof(packetSize));
-        if (!file.good()) return false;
-
-        entry.packetData.resize(packetSize);
-        file.read(reinterpret_cast<char*>(entry.packetData.data()), packetSize);
-        if (!file.good()) return false;
-
-        _entries.push_back(std::move(entry));
+    if (_resetCallback) {
+        _resetCallback();
     }
-
-    return true;
-}
-
-void ReplayPlayer::processPacketsUntilTime(uint64_t targetTime)
-{
     if (!_callback) {
         return;
     }
 
-    while (_currentIndex < _entries.size()) {
-        const auto& entry = _entries[_currentIndex];
+    std::vector<uint8_t> keyframe;
+    _state.appendKeyframe(keyframe);
+    replay::forEachKeyframePacket(keyframe.data(), keyframe.size(),
+                                  [this](const uint8_t* data, size_t size) {
+                                      _callback(data, size);
+                                  });
+}
 
-        if (entry.timestamp > targetTime) {
-            break;
+void ReplayPlayer::processPacketsUntilTime(uint64_t targetTime, bool deliver)
+{
+    deliver = deliver && _callback;
+
+    auto it = _stream.at(_currentPosition);
+    const auto end = _stream.end();
+    for (; it != end && it->timestamp <= targetTime; ++it) {
+        // Keyframes only matter when seeking; the state already matches them
+        if (it->isKeyframe) {
+            continue;
+        }
+        _state.apply(it->payload.data(), it->payload.size());
+        if (deliver) {
+            _callback(it->payload.data(), it->payload.size());
         }
-
-        _callback(entry.packetData.data(), entry.packetData.size());
-
-        _currentIndex++;
     }
+    // A damaged record also ends the stream
+    _currentPosition = it == end ? _stream.getEnd() : it->position;
 }
 
 }  // namespace rtype
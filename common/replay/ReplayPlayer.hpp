@@ -7,31 +7,37 @@
 
 #pragma once
 
-#include <chrono>
-#include <fstream>
 #include <functional>
 #include <string>
-#include <vector>
 
+#include "ReplayState.hpp"
+#include "ReplayStream.hpp"
 #include "common/network/Protocol.hpp"
 
 namespace rtype {
 
 /**
- * @brief Entry in a replay file
+ * @brief Playback speed multiplier
  */
-struct ReplayEntry {
-    uint64_t timestamp;  ///< Timestamp in milliseconds from replay start
-    std::vector<uint8_t> packetData;  ///< Raw packet data
+enum class PlaybackSpeed {
+    Half = 0,        // 0.5x speed
+    Normal = 1,      // 1.0x speed
+    Double = 2,      // 2.0x speed
+    Quadruple = 3,   // 4.0x speed
+    Octuple = 4,     // 8.0x speed
+    Sixteenfold = 5  // 16.0x speed
 };
 
 /**
- * @brief Playback speed multiplier
+ * @brief Where playback stood at some time, enough to resume from there
+ *
+ * Plain data: copying one costs a copy of the headless state, and playback
+ * can return to it without reading the file before it.
  */
-enum class PlaybackSpeed {
-    Half = 0,    // 0.5x speed
-    Normal = 1,  // 1.0x speed
-    Double = 2   // 2.0x speed
+struct ReplayCheckpoint {
+    uint64_t time = 0;        ///< Playback time in ms
+    ReplayPosition position;  ///< Next record to play
+    ReplayState state;        ///< State at time
 };
 
 /**
@@ -39,6 +45,24 @@ enum class PlaybackSpeed {
  *
  * Reads replay files and calls a callback for each packet at the appropriate
  * time. Supports playback controls: pause, seek, speed adjustment.
+ *
+ * The file is memory-mapped and walked record by record (see ReplayStream);
+ * packets are handed to the callback without being copied.
+ *
+ * Version 2 files contain periodic keyframes. A seek restores the last
+ * keyframe before the target (found by binary search) and only replays the
+ * packets after it; version 1 files have none and replay from the start.
+ *
+ * Every packet is also folded into a headless ReplayState. Seeks and
+ * speeds above 2x advance that state alone and then hand the callback only
+ * the net changes, so entities that live and die within the skipped time
+ * never reach the game state. After a seek to an earlier keyframe, the
+ * reset callback runs and the callback receives the whole state at the
+ * target.
+ *
+ * Callers that keep their own copies of earlier states can also save
+ * checkpoints and seek back from them, which only replays the packets
+ * between the checkpoint and the target.
  */
 class ReplayPlayer {
    public:
@@ -52,7 +76,7 @@ class ReplayPlayer {
     explicit ReplayPlayer(const std::string& filePath);
 
     /**
-     * @brief Load the replay file into memory
+     * @brief Map the replay file and read its index
      * @return true if replay loaded successfully
      */
     bool load();
@@ -95,17 +119,52 @@ class ReplayPlayer {
      */
     bool isSeeking() const;
 
+    /**
+     * @brief Whether frames are coalesced because of a speed above 2x
+     *
+     * Positions then jump from frame to frame and destroyed entities should
+     * not leave effects behind, as while seeking.
+     */
+    bool isFastForwarding() const;
+
     /**
      * @brief Seek forward or backward in time
      * @param seconds Amount to seek (negative = backward)
      */
     void seek(float seconds);
 
+    /**
+     * @brief Save the current playback position and state
+     * @param checkpoint Overwritten, reusing its storage
+     */
+    void saveCheckpoint(ReplayCheckpoint& checkpoint) const;
+
+    /**
+     * @brief Seek to targetTime by replaying from a checkpoint
+     *
+     * The receiver of the callback must already be back in the state it
+     * had at the checkpoint: it then receives only the net changes up to
+     * targetTime, and the reset callback is not called.
+     *
+     * @param checkpoint Saved by this player, at or before targetTime
+     * @param targetTime Playback time to seek to, in ms
+     */
+    void seekFromCheckpoint(const ReplayCheckpoint& checkpoint,
+                            uint64_t targetTime);
+
+    /**
+     * @brief Time from which seek() would replay to reach an earlier time
+     * @return Timestamp of the closest keyframe before targetTime, 0 if none
+     */
+    uint64_t getSeekStartTime(uint64_t targetTime) const;
+
     /**
      * @brief Set playback speed
      */
     void setSpeed(PlaybackSpeed speed);
 
+    PlaybackSpeed getSpeed() const { return _speed; }
+
     /**
      * @brief Get current playback speed multiplier
      */
@@ -126,6 +185,11 @@ class ReplayPlayer {
      */
     uint64_t getTotalDuration() const;
 
+    /**
+     * @brief Headless state at the current playback position
+     */
+    const ReplayState& getState() const { return _state; }
+
     /**
      * @brief Get replay file name without path
      */
@@ -143,11 +207,12 @@ class ReplayPlayer {
 
    private:
     std::string _filePath;
-    std::vector<ReplayEntry> _entries;
+    ReplayStream _stream;
     PacketCallback _callback;
     ResetCallback _resetCallback;
+    ReplayState _state;
 
-    size_t _currentIndex;
+    ReplayPosition _currentPosition;  // Next record to play
     uint64_t _currentTime;  // Current playback position in ms
     uint64_t _totalDuration;
     bool _isPaused;
@@ -155,9 +220,16 @@ class ReplayPlayer {
     bool _isSeeking;  // True when fast-forwarding during seek
     PlaybackSpeed _speed;
 
-    bool readHeader(std::ifstream& file);
-    bool readEntries(std::ifstream& file);
-    void processPacketsUntilTime(uint64_t targetTime);
+    /// Fastest speed at which every packet still reaches the callback
+    static constexpr float MAX_DIRECT_SPEED = 2.0f;
+
+    /**
+     * @brief Fold the packets up to targetTime into the state
+     * @param deliver Also pass each packet to the callback
+     */
+    void processPacketsUntilTime(uint64_t targetTime, bool deliver);
+    void restoreKeyframe(size_t keyframe);
+    void materializeState();
 };
 
 }  // namespace rtype
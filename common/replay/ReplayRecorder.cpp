@@ -11,8 +11,20 @@
 
 namespace rtype {
 
-ReplayRecorder::ReplayRecorder(const std::string& filePath)
-    : _filePath(filePath), _isRecording(false)
+ReplayRecorder::ReplayRecorder(const std::string& filePath,
+                               size_t ringCapacity)
+    : _filePath(filePath),
+      _isRecording(false),
+      _lastKeyframeAttempt(0),
+      _lastTimestamp(0),
+      _recordCount(0),
+      _packetCount(0),
+      _droppedRecords(0),
+      _resyncPending(false),
+      _metadata{},
+      _ring(ringCapacity),
+      _stopWriter(false),
+      _fileOffset(0)
 {
 }
 
@@ -36,8 +48,22 @@ bool ReplayRecorder::startRecording()
         return false;
     }
 
+    _metadata = {};
+    _metadata.recordedAt = static_cast<int64_t>(
+        std::chrono::system_clock::to_time_t(std::chrono::system_clock::now()));
     writeHeader();
     _startTime = std::chrono::steady_clock::now();
+    _lastKeyframeAttempt = 0;
+    _lastTimestamp = 0;
+    _recordCount = 0;
+    _packetCount = 0;
+    _droppedRecords = 0;
+    _resyncPending = false;
+    _pending.clear();
+    _fileOffset = replay::getDataStart(replay::CURRENT_VERSION);
+    _blockIndex.clear();
+    _stopWriter.store(false, std::memory_order_relaxed);
+    _writer = std::thread(&ReplayRecorder::writerLoop, this);
     _isRecording = true;
 
     std::cout << "Started recording replay to: " << _filePath << std::endl;
@@ -50,34 +76,62 @@ void ReplayRecorder::stopRecording()
         return;
     }
 
+    // The writer writes everything queued before exiting; the index goes
+    // after
+    _stopWriter.store(true, std::memory_order_release);
+    _writer.join();
+    writeIndex();
+    writeMetadata();
     _file.close();
     _isRecording = false;
 
-    std::cout << "Stopped recording. Duration: " << getRecordingDuration()
-              << "ms" << std::endl;
+    std::cout << "Stopped recording. Duration: " << _lastTimestamp << "ms";
+    if (_droppedRecords > 0) {
+        std::cout << ", " << _droppedRecords << " records dropped";
+    }
+    std::cout << std::endl;
 }
 
 void ReplayRecorder::recordPacket(const void* data, size_t size)
 {
-    if (!_isRecording || !_file.is_open()) {
+    if (!_isRecording) {
         return;
     }
 
-    uint64_t timestamp = getCurrentTimestamp();
-
-    _file.write(reinterpret_cast<const char*>(&timestamp), sizeof(timestamp));
+    queueRecord(replay::RecordKind::PACKET, getCurrentTimestamp(), data, size);
+}
 
-    uint16_t packetSize = static_cast<uint16_t>(size);
-    _file.write(reinterpret_cast<const char*>(&packetSize), sizeof(packetSize));
+bool ReplayRecorder::isKeyframeDue() const
+{
+    if (!_isRecording) {
+        return false;
+    }
+    uint64_t interval = _resyncPending ? RESYNC_RETRY_MS : KEYFRAME_INTERVAL_MS;
+    return getCurrentTimestamp() - _lastKeyframeAttempt >= interval;
+}
 
-    _file.write(reinterpret_cast<const char*>(data), size);
+void ReplayRecorder::recordKeyframe(const std::vector<uint8_t>& keyframe)
+{
+    if (!_isRecording) {
+        return;
+    }
 
-    static int writeCount = 0;
-    if (++writeCount % 10 == 0) {
-        _file.flush();
+    uint64_t timestamp = getCurrentTimestamp();
+    _lastKeyframeAttempt = timestamp;
+    if (queueRecord(replay::RecordKind::KEYFRAME, timestamp, keyframe.data(),
+                    keyframe.size())) {
+        _resyncPending = false;
     }
 }
 
+void ReplayRecorder::setGameInfo(uint8_t level, uint8_t playerCount,
+                                 uint32_t finalScore)
+{
+    _metadata.level = level;
+    _metadata.playerCount = playerCount;
+    _metadata.finalScore = finalScore;
+}
+
 bool ReplayRecorder::isRecording() const { return _isRecording; }
 
 uint64_t ReplayRecorder::getRecordingDuration() const
@@ -88,16 +142,150 @@ uint64_t ReplayRecorder::getRecordingDuration() const
     return getCurrentTimestamp();
 }
 
+void ReplayRecorder::waitForWriter() const
+{
+    while (_isRecording && !_ring.empty()) {
+        std::this_thread::sleep_for(WRITER_POLL_INTERVAL);
+    }
+}
+
 void ReplayRecorder::writeHeader()
 {
-    _file.write(REPLAY_MAGIC, std::strlen(REPLAY_MAGIC) + 1);
+    _file.write(replay::MAGIC, sizeof(replay::MAGIC));
+
+    uint32_t version = replay::CURRENT_VERSION;
+    _file.write(reinterpret_cast<const char*>(&version), sizeof(version));
+    _file.write(reinterpret_cast<const char*>(&_metadata), sizeof(_metadata));
+}
+
+bool ReplayRecorder::queueRecord(replay::RecordKind kind, uint64_t timestamp,
+                                 const void* data, size_t size)
+{
+    replay::RecordHeader header;
+    header.timestamp = timestamp;
+    header.kind = static_cast<uint8_t>(kind);
+    header.size = static_cast<uint32_t>(size);
+
+    bool queued = _ring.write(
+        {{reinterpret_cast<const uint8_t*>(&header), sizeof(header)},
+         {static_cast<const uint8_t*>(data), size}});
+    if (!queued) {
+        if (_droppedRecords++ == 0) {
+            std::cerr << "[WARN] Replay writer is behind, dropping records"
+                      << std::endl;
+        }
+        _resyncPending = true;
+        return false;
+    }
+
+    _lastTimestamp = timestamp;
+    _recordCount++;
+    if (kind == replay::RecordKind::PACKET) {
+        _packetCount++;
+    }
+    return true;
+}
+
+void ReplayRecorder::writerLoop()
+{
+    auto lastFlush = std::chrono::steady_clock::now();
+
+    while (!_stopWriter.load(std::memory_order_acquire)) {
+        drainRing();
+        auto now = std::chrono::steady_clock::now();
+        if (now - lastFlush >= FLUSH_INTERVAL) {
+            writeBlock();
+            lastFlush = now;
+        }
+        std::this_thread::sleep_for(WRITER_POLL_INTERVAL);
+    }
+    drainRing();
+    writeBlock();
+}
+
+void ReplayRecorder::drainRing()
+{
+    for (auto chunk = _ring.peek(); !chunk.empty(); chunk = _ring.peek()) {
+        _pending.insert(_pending.end(), chunk.begin(), chunk.end());
+        _ring.consume(chunk.size());
+    }
 
-    _file.write(reinterpret_cast<const char*>(&REPLAY_VERSION),
-                sizeof(REPLAY_VERSION));
+    size_t offset = 0;
+    replay::RecordHeader header;
+    while (_pending.size() - offset >= sizeof(header)) {
+        std::memcpy(&header, _pending.data() + offset, sizeof(header));
+        if (_pending.size() - offset - sizeof(header) < header.size) {
+            break;
+        }
+
+        auto kind = static_cast<replay::RecordKind>(header.kind);
+        if (kind == replay::RecordKind::KEYFRAME) {
+            writeBlock();
+        }
+        _encoder.add(header.timestamp, kind,
+                     {_pending.data() + offset + sizeof(header), header.size});
+        if (_encoder.getDecodedSize() >= ReplayBlockEncoder::TARGET_SIZE) {
+            writeBlock();
+        }
+        offset += sizeof(header) + header.size;
+    }
+    _pending.erase(_pending.begin(),
+                   _pending.begin() + static_cast<std::ptrdiff_t>(offset));
+}
+
+void ReplayRecorder::writeBlock()
+{
+    if (_encoder.empty()) {
+        return;
+    }
+
+    replay::BlockHeader header = _encoder.finish(_blockBuffer);
+    replay::BlockIndexEntry entry;
+    entry.firstTimestamp = header.firstTimestamp;
+    entry.offset = _fileOffset;
+    entry.flags = header.flags;
+    _blockIndex.push_back(entry);
+
+    _file.write(reinterpret_cast<const char*>(_blockBuffer.data()),
+                static_cast<std::streamsize>(_blockBuffer.size()));
+    _file.flush();
+    _fileOffset += _blockBuffer.size();
+}
+
+void ReplayRecorder::writeIndex()
+{
+    replay::IndexFooter footer;
+    footer.entryCount = static_cast<uint32_t>(_blockIndex.size());
+    footer.indexOffset = _fileOffset;
+    footer.duration = _lastTimestamp;
+    footer.recordCount = _recordCount;
+    std::memcpy(footer.magic, replay::INDEX_MAGIC, sizeof(footer.magic));
+
+    _file.write(reinterpret_cast<const char*>(_blockIndex.data()),
+                _blockIndex.size() * sizeof(replay::BlockIndexEntry));
+    _file.write(reinterpret_cast<const char*>(&footer), sizeof(footer));
+}
+
+void ReplayRecorder::writeMetadata()
+{
+    _metadata.duration = _lastTimestamp;
+    _metadata.packetCount = _packetCount;
+    _metadata.flags |= replay::METADATA_COMPLETE;
+
+    _file.seekp(static_cast<std::streamoff>(replay::HEADER_SIZE));
+    _file.write(reinterpret_cast<const char*>(&_metadata), sizeof(_metadata));
+}
+
+void ReplayRecorder::setClock(std::function<uint64_t()> clock)
+{
+    _clock = std::move(clock);
 }
 
 uint64_t ReplayRecorder::getCurrentTimestamp() const
 {
+    if (_clock) {
+        return _clock();
+    }
     auto now = std::chrono::steady_clock::now();
     auto duration =
         std::chrono::duration_cast<std::chrono::milliseconds>(now - _startTime);
@@ -7,12 +7,18 @@
 
 #pragma once
 
+#include <atomic>
 #include <chrono>
 #include <cstring>
 #include <fstream>
+#include <functional>
 #include <string>
+#include <thread>
 #include <vector>
 
+#include "ByteRingBuffer.hpp"
+#include "ReplayBlock.hpp"
+#include "ReplayFormat.hpp"
 #include "common/network/Protocol.hpp"
 
 namespace rtype {
@@ -21,18 +27,38 @@ namespace rtype {
  * @brief Records game packets to a replay file
  *
  * Records all server packets with timestamps to enable replay functionality.
- * File format:
- * - Header: "RTYPE_REPLAY\0" + version (uint32_t)
- * - Each entry: timestamp (uint64_t ms) + packet size (uint16_t) + raw packet
- * data
+ * Writes the version 4 format (see ReplayFormat.hpp). The owner adds a
+ * full-state keyframe whenever isKeyframeDue() says so. When recording
+ * stops, an index of the blocks is appended so players can seek without
+ * replaying the whole file, and the metadata after the header is filled
+ * in.
+ *
+ * Recording never touches the file on the caller's thread: records are
+ * appended to a lock-free ring buffer that a background thread drains. The
+ * writer groups them into compressed blocks of about
+ * ReplayBlockEncoder::TARGET_SIZE (a partial block at most once per
+ * FLUSH_INTERVAL, and each keyframe starts a new block). If the disk stalls
+ * long enough for the ring to fill, new records are dropped and the next
+ * keyframe is requested early, so the replay is only wrong between the loss
+ * and that keyframe.
+ *
+ * Blocks go to the file through the buffered stream as they are finished.
+ * They are compressed to varying sizes, so aligning them on disk would
+ * mean padding the format; the stream and the page cache already turn them
+ * into large sequential writes.
  */
 class ReplayRecorder {
    public:
+    static constexpr size_t DEFAULT_RING_CAPACITY = 2 * 1024 * 1024;
+
     /**
      * @brief Construct a new Replay Recorder
      * @param filePath Path where the replay will be saved
+     * @param ringCapacity Bytes queued for the writer thread before records
+     * are dropped
      */
-    explicit ReplayRecorder(const std::string& filePath);
+    explicit ReplayRecorder(const std::string& filePath,
+                            size_t ringCapacity = DEFAULT_RING_CAPACITY);
 
     /**
      * @brief Destructor - ensures file is properly closed
@@ -57,6 +83,26 @@ class ReplayRecorder {
      */
     void recordPacket(const void* data, size_t size);
 
+    /**
+     * @brief Whether a keyframe should be recorded now
+     *
+     * True every KEYFRAME_INTERVAL_MS, or sooner after records were dropped.
+     */
+    bool isKeyframeDue() const;
+
+    /**
+     * @brief Record a full-state keyframe
+     * @param keyframe Packet sequence built with replay::appendKeyframePacket
+     */
+    void recordKeyframe(const std::vector<uint8_t>& keyframe);
+
+    /**
+     * @brief Game details saved in the metadata when recording stops
+     * @param level Current level, 0 if unknown
+     * @param playerCount Most players seen in the game at once
+     */
+    void setGameInfo(uint8_t level, uint8_t playerCount, uint32_t finalScore);
+
     /**
      * @brief Check if currently recording
      */
@@ -67,16 +113,67 @@ class ReplayRecorder {
      */
     uint64_t getRecordingDuration() const;
 
+    /**
+     * @brief Take timestamps from a simulated clock instead of the wall clock
+     * @param clock Milliseconds since the recording started; an empty
+     * function restores the wall clock
+     *
+     * Lets a replay be generated faster than realtime.
+     */
+    void setClock(std::function<uint64_t()> clock);
+
+    /**
+     * @brief Block until the writer thread has taken every queued record
+     *
+     * For callers producing records faster than realtime (see setClock),
+     * which would otherwise fill the ring and drop records.
+     */
+    void waitForWriter() const;
+
+    /**
+     * @brief Records lost because the writer thread fell behind
+     */
+    uint64_t getDroppedRecordCount() const { return _droppedRecords; }
+
    private:
     std::string _filePath;
     std::ofstream _file;
     bool _isRecording;
     std::chrono::steady_clock::time_point _startTime;
+    std::function<uint64_t()> _clock;
+
+    // Caller thread state
+    uint64_t _lastKeyframeAttempt;
+    uint64_t _lastTimestamp;
+    uint64_t _recordCount;
+    uint64_t _packetCount;
+    uint64_t _droppedRecords;
+    bool _resyncPending;  ///< Records were dropped since the last keyframe
+    replay::ReplayMetadata _metadata;
+
+    // Writer thread state (read by the caller once the thread is joined)
+    ByteRingBuffer _ring;
+    std::thread _writer;
+    std::atomic<bool> _stopWriter;
+    std::vector<uint8_t> _pending;  ///< Drained bytes not yet parsed
+    std::vector<uint8_t> _blockBuffer;
+    ReplayBlockEncoder _encoder;
+    uint64_t _fileOffset;
+    std::vector<replay::BlockIndexEntry> _blockIndex;
 
-    static constexpr uint32_t REPLAY_VERSION = 1;
-    static constexpr char REPLAY_MAGIC[] = "RTYPE_REPLAY";
+    static constexpr uint64_t KEYFRAME_INTERVAL_MS = 5000;
+    static constexpr uint64_t RESYNC_RETRY_MS = 250;
+    static constexpr std::chrono::milliseconds FLUSH_INTERVAL{1000};
+    static constexpr std::chrono::milliseconds WRITER_POLL_INTERVAL{10};
 
     void writeHeader();
+    bool queueRecord(replay::RecordKind kind, uint64_t timestamp,
+                     const void* data, size_t size);
+    void writerLoop();
+    void drainRing();
+    void writeBlock();
+    void writeIndex();
+    void writeMetadata();
     uint64_t getCurrentTimestamp() const;
 };
 
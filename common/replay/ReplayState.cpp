@@ -0,0 +1,335 @@
+/*
+** EPITECH PROJECT, 2025
+** r-type
+** File description:
+** ReplayState
+*/
+
+#include "ReplayState.hpp"
+
+#include <cstring>
+
+#include "ReplayFormat.hpp"
+#include "common/network/EntityType.hpp"
+#include "common/network/Protocol.hpp"
+
+namespace rtype {
+
+namespace {
+
+/**
+ * @brief Copy a packet out of a replay record if it is long enough
+ *
+ * Records are not aligned, so the packed fields are not read in place.
+ */
+template <typename Packet>
+bool readPacket(const void* data, size_t size, Packet& packet)
+{
+    if (size < sizeof(Packet)) {
+        return false;
+    }
+    std::memcpy(&packet, data, sizeof(Packet));
+    return true;
+}
+
+}  // namespace
+
+void ReplayState::clear()
+{
+    _entities.clear();
+    _playerId = 0;
+    _mapWidth = 0;
+    _mapHeight = 0;
+    _score = 0;
+    _loggedIn = false;
+    _tracking = false;
+    _changes.clear();
+    _loginChanged = false;
+    _scoreChanged = false;
+    _unconfirmed.clear();
+}
+
+void ReplayState::apply(const void* data, size_t size)
+{
+    if (size < sizeof(Header)) {
+        return;
+    }
+
+    switch (static_cast<const Header*>(data)->opCode) {
+        case S2C_LOGIN_OK: {
+            LoginResponsePacket packet;
+            if (readPacket(data, size, packet)) {
+                if (packet.playerId == 0) {
+                    dropUnconfirmed();
+                }
+                _playerId = packet.playerId;
+                _mapWidth = packet.mapWidth;
+                _mapHeight = packet.mapHeight;
+                _loggedIn = true;
+                _loginChanged = _tracking;
+            }
+            break;
+        }
+        case S2C_ENTITY_NEW: {
+            EntitySpawnPacket packet;
+            if (readPacket(data, size, packet)) {
+                spawn(packet.entityId, packet.type, packet.x, packet.y);
+            }
+            break;
+        }
+        case S2C_ENTITY_POS: {
+            EntityPositionPacket packet;
+            if (!readPacket(data, size, packet)) {
+                break;
+            }
+            uint32_t entityId = packet.entityId;
+            auto it = _entities.find(entityId);
+            if (it != _entities.end()) {
+                it->second.x = packet.x;
+                it->second.y = packet.y;
+                markChanged(entityId, MOVED);
+            }
+            break;
+        }
+        case S2C_ENTITY_DEAD: {
+            EntityDeadPacket packet;
+            if (readPacket(data, size, packet)) {
+                destroy(packet.entityId);
+            }
+            break;
+        }
+        case S2C_SCORE_UPDATE: {
+            ScoreUpdatePacket packet;
+            if (readPacket(data, size, packet)) {
+                _score = packet.score;
+                _scoreChanged = _tracking;
+            }
+            break;
+        }
+        case S2C_HEALTH_UPDATE: {
+            HealthUpdatePacket packet;
+            if (!readPacket(data, size, packet)) {
+                break;
+            }
+            uint32_t entityId = packet.entityId;
+            auto it = _entities.find(entityId);
+            if (it != _entities.end()) {
+                it->second.health = packet.currentHealth;
+                it->second.maxHealth = packet.maxHealth;
+                markChanged(entityId, HEALTH);
+            }
+            break;
+        }
+        case S2C_SHIELD_STATUS: {
+            ShieldStatusPacket packet;
+            if (!readPacket(data, size, packet)) {
+                break;
+            }
+            uint32_t playerId = packet.playerId;
+            auto it = _entities.find(playerId);
+            if (it != _entities.end() &&
+                it->second.type == EntityType::PLAYER) {
+                it->second.hasShield = packet.hasShield != 0;
+                markChanged(playerId, SHIELD);
+            }
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+bool ReplayState::applyKeyframe(const uint8_t* data, size_t size)
+{
+    clear();
+    return replay::forEachKeyframePacket(
+        data, size,
+        [this](const uint8_t* packet, size_t packetSize) {
+            apply(packet, packetSize);
+        });
+}
+
+void ReplayState::appendKeyframe(std::vector<uint8_t>& keyframe) const
+{
+    if (_loggedIn) {
+        LoginResponsePacket login{};
+        login.header.opCode = S2C_LOGIN_OK;
+        login.playerId = _playerId;
+        login.mapWidth = _mapWidth;
+        login.mapHeight = _mapHeight;
+        replay::appendKeyframePacket(keyframe, login);
+    }
+
+    ScoreUpdatePacket score{};
+    score.header.opCode = S2C_SCORE_UPDATE;
+    score.score = _score;
+    replay::appendKeyframePacket(keyframe, score);
+
+    for (const auto& [id, entity] : _entities) {
+        EntitySpawnPacket spawnPacket{};
+        spawnPacket.header.opCode = S2C_ENTITY_NEW;
+        spawnPacket.entityId = id;
+        spawnPacket.type = entity.type;
+        spawnPacket.x = entity.x;
+        spawnPacket.y = entity.y;
+        replay::appendKeyframePacket(keyframe, spawnPacket);
+
+        HealthUpdatePacket health{};
+        health.header.opCode = S2C_HEALTH_UPDATE;
+        health.entityId = id;
+        health.currentHealth = entity.health;
+        health.maxHealth = entity.maxHealth;
+        replay::appendKeyframePacket(keyframe, health);
+
+        if (entity.hasShield) {
+            ShieldStatusPacket shield{};
+            shield.header.opCode = S2C_SHIELD_STATUS;
+            shield.playerId = id;
+            shield.hasShield = 1;
+            replay::appendKeyframePacket(keyframe, shield);
+        }
+    }
+}
+
+void ReplayState::beginChanges()
+{
+    _tracking = true;
+    _changes.clear();
+    _loginChanged = false;
+    _scoreChanged = false;
+}
+
+void ReplayState::emitChanges(const PacketCallback& callback)
+{
+    if (_loginChanged) {
+        LoginResponsePacket login{};
+        login.header.opCode = S2C_LOGIN_OK;
+        login.header.packetSize = sizeof(login);
+        login.playerId = _playerId;
+        login.mapWidth = _mapWidth;
+        login.mapHeight = _mapHeight;
+        callback(&login, sizeof(login));
+    }
+
+    for (const auto& [id, change] : _changes) {
+        if (change & DESTROYED) {
+            EntityDeadPacket dead{};
+            dead.header.opCode = S2C_ENTITY_DEAD;
+            dead.header.packetSize = sizeof(dead);
+            dead.entityId = id;
+            callback(&dead, sizeof(dead));
+        }
+
+        auto it = _entities.find(id);
+        if (it == _entities.end()) {
+            continue;
+        }
+        const ReplayEntityState& entity = it->second;
+
+        if (change & SPAWNED) {
+            EntitySpawnPacket spawnPacket{};
+            spawnPacket.header.opCode = S2C_ENTITY_NEW;
+            spawnPacket.header.packetSize = sizeof(spawnPacket);
+            spawnPacket.entityId = id;
+            spawnPacket.type = entity.type;
+            spawnPacket.x = entity.x;
+            spawnPacket.y = entity.y;
+            callback(&spawnPacket, sizeof(spawnPacket));
+        } else if (change & MOVED) {
+            EntityPositionPacket position{};
+            position.header.opCode = S2C_ENTITY_POS;
+            position.header.packetSize = sizeof(position);
+            position.entityId = id;
+            position.x = entity.x;
+            position.y = entity.y;
+            callback(&position, sizeof(position));
+        }
+        if (change & HEALTH) {
+            HealthUpdatePacket health{};
+            health.header.opCode = S2C_HEALTH_UPDATE;
+            health.header.packetSize = sizeof(health);
+            health.entityId = id;
+            health.currentHealth = entity.health;
+            health.maxHealth = entity.maxHealth;
+            callback(&health, sizeof(health));
+        }
+        if (change & SHIELD) {
+            ShieldStatusPacket shield{};
+            shield.header.opCode = S2C_SHIELD_STATUS;
+            shield.header.packetSize = sizeof(shield);
+            shield.playerId = id;
+            shield.hasShield = entity.hasShield ? 1 : 0;
+            callback(&shield, sizeof(shield));
+        }
+    }
+
+    if (_scoreChanged) {
+        ScoreUpdatePacket score{};
+        score.header.opCode = S2C_SCORE_UPDATE;
+        score.header.packetSize = sizeof(score);
+        score.score = _score;
+        callback(&score, sizeof(score));
+    }
+
+    _tracking = false;
+    _changes.clear();
+    _loginChanged = false;
+    _scoreChanged = false;
+}
+
+void ReplayState::markChanged(uint32_t entityId, uint8_t change)
+{
+    if (_tracking) {
+        _changes[entityId] |= change;
+    }
+}
+
+void ReplayState::spawn(uint32_t entityId, uint8_t type, float x, float y)
+{
+    _unconfirmed.erase(entityId);
+
+    // Like the client, a spawn for a live entity is ignored
+    auto [it, inserted] = _entities.try_emplace(entityId);
+    if (!inserted) {
+        return;
+    }
+    it->second.type = type;
+    it->second.x = x;
+    it->second.y = y;
+    markChanged(entityId, SPAWNED);
+}
+
+void ReplayState::destroy(uint32_t entityId)
+{
+    _unconfirmed.erase(entityId);
+    if (_entities.erase(entityId) == 0 || !_tracking) {
+        return;
+    }
+
+    auto it = _changes.find(entityId);
+    if (it != _changes.end() && (it->second & SPAWNED)) {
+        // Born since beginChanges(): the client never has to know about it,
+        // unless it replaced an entity that was there before
+        if (it->second & DESTROYED) {
+            it->second = DESTROYED;
+        } else {
+            _changes.erase(it);
+        }
+        return;
+    }
+    _changes[entityId] = DESTROYED;
+}
+
+void ReplayState::dropUnconfirmed()
+{
+    std::unordered_set<uint32_t> missed;
+    missed.swap(_unconfirmed);
+    for (uint32_t entityId : missed) {
+        destroy(entityId);
+    }
+    for (const auto& [entityId, entity] : _entities) {
+        _unconfirmed.insert(entityId);
+    }
+}
+
+}  // namespace rtype
@@ -0,0 +1,130 @@
+/*
+** EPITECH PROJECT, 2025
+** r-type
+** File description:
+** ReplayState
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace rtype {
+
+/**
+ * @brief What a replay says about one entity, without any visuals
+ */
+struct ReplayEntityState {
+    uint8_t type = 0;
+    float x = 0.0f;
+    float y = 0.0f;
+    float health = 100.0f;
+    float maxHealth = 100.0f;
+    bool hasShield = false;
+};
+
+/**
+ * @brief Headless decoder of replay packets
+ *
+ * Folds server packets into plain entity records (ids, types, positions,
+ * health, shields) plus the login and score, so a replay can be advanced
+ * without creating a sprite for every bullet that lives a few frames.
+ *
+ * The state is turned back into packets in two ways: appendKeyframe()
+ * writes all of it, and emitChanges() only what differs from the state at
+ * the last beginChanges(). An entity spawned and destroyed in between
+ * produces nothing at all.
+ *
+ * Spectator streams repeat the whole state after a login for player 0
+ * every few seconds, over an unreliable link. An entity that was alive at
+ * one such login and is not spawned again before the next one missed its
+ * S2C_ENTITY_DEAD, so that next login destroys it.
+ */
+class ReplayState {
+   public:
+    using PacketCallback = std::function<void(const void*, size_t)>;
+
+    void clear();
+
+    /**
+     * @brief Fold one packet into the state
+     *
+     * Packets that do not change the model (boss events, game events...)
+     * and truncated packets are ignored.
+     */
+    void apply(const void* data, size_t size);
+
+    /**
+     * @brief Replace the state with the content of a keyframe
+     * @return false if the keyframe payload is truncated
+     */
+    bool applyKeyframe(const uint8_t* data, size_t size);
+
+    /**
+     * @brief Append the whole state as a keyframe payload
+     * @see replay::appendKeyframePacket
+     */
+    void appendKeyframe(std::vector<uint8_t>& keyframe) const;
+
+    /**
+     * @brief Start tracking changes from the current state
+     */
+    void beginChanges();
+
+    /**
+     * @brief Send the packets that turn the state at beginChanges() into
+     * the current one, and stop tracking
+     */
+    void emitChanges(const PacketCallback& callback);
+
+    const std::unordered_map<uint32_t, ReplayEntityState>& getEntities() const
+    {
+        return _entities;
+    }
+    uint32_t getPlayerId() const { return _playerId; }
+    uint16_t getMapWidth() const { return _mapWidth; }
+    uint16_t getMapHeight() const { return _mapHeight; }
+    uint32_t getScore() const { return _score; }
+    bool isLoggedIn() const { return _loggedIn; }
+
+   private:
+    enum Change : uint8_t {
+        SPAWNED = 1 << 0,   ///< Not alive at beginChanges()
+        DESTROYED = 1 << 1,  ///< Alive at beginChanges(), maybe respawned
+        MOVED = 1 << 2,
+        HEALTH = 1 << 3,
+        SHIELD = 1 << 4,
+    };
+
+    std::unordered_map<uint32_t, ReplayEntityState> _entities;
+    uint32_t _playerId = 0;
+    uint16_t _mapWidth = 0;
+    uint16_t _mapHeight = 0;
+    uint32_t _score = 0;
+    bool _loggedIn = false;
+
+    bool _tracking = false;
+    std::unordered_map<uint32_t, uint8_t> _changes;
+    bool _loginChanged = false;
+    bool _scoreChanged = false;
+
+    /// Alive at the last login for player 0 and not spawned again since
+    std::unordered_set<uint32_t> _unconfirmed;
+
+    void markChanged(uint32_t entityId, uint8_t change);
+    void spawn(uint32_t entityId, uint8_t type, float x, float y);
+    void destroy(uint32_t entityId);
+
+    /**
+     * @brief Destroy the entities unconfirmed since the last login for
+     * player 0, then expect every live one to be spawned again
+     */
+    void dropUnconfirmed();
+};
+
+}  // namespace rtype
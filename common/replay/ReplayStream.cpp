@@ -0,0 +1,310 @@
+/*
+** EPITECH PROJECT, 2025
+** r-type
+** File description:
+** ReplayStream
+*/
+
+#include "ReplayStream.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace rtype {
+
+ReplayStream::Iterator::Iterator(const ReplayStream* stream,
+                                 ReplayPosition position)
+    : _stream(stream), _position(position)
+{
+    // end() is built for every comparison and has no record to read
+    if (_position == _stream->getEnd() ||
+        !_stream->readRecord(_position, _record)) {
+        _position = _stream->getEnd();
+    }
+}
+
+ReplayStream::Iterator& ReplayStream::Iterator::operator++()
+{
+    ReplayPosition next = _record.next;
+    if (!_stream->readRecord(next, _record)) {
+        next = _stream->getEnd();
+    }
+    _position = next;
+    return *this;
+}
+
+ReplayStream::Iterator ReplayStream::Iterator::operator++(int)
+{
+    Iterator previous = *this;
+    ++*this;
+    return previous;
+}
+
+bool ReplayStream::open(const std::string& filePath)
+{
+    close();
+
+    if (!_file.open(filePath) || !readHeader()) {
+        close();
+        return false;
+    }
+
+    _dataStart = replay::getDataStart(_version);
+    _dataEnd = _file.data().size();
+    if (_version == replay::VERSION_1 || !readIndex()) {
+        if (isBlocked()) {
+            scanBlocks();
+        } else {
+            scanRecords();
+        }
+    }
+    return true;
+}
+
+void ReplayStream::close()
+{
+    _file.close();
+    _version = 0;
+    _dataStart = 0;
+    _dataEnd = 0;
+    _duration = 0;
+    _recordCount = 0;
+    _metadata = {};
+    _keyframes.clear();
+    _block.clear();
+    _blockOffset = NO_BLOCK;
+    _nextBlockOffset = 0;
+}
+
+ReplayPosition ReplayStream::getStart() const
+{
+    return isBlocked() ? ReplayPosition{_dataStart, 0}
+                       : ReplayPosition{0, _dataStart};
+}
+
+ReplayPosition ReplayStream::getEnd() const
+{
+    return isBlocked() ? ReplayPosition{_dataEnd, 0}
+                       : ReplayPosition{0, _dataEnd};
+}
+
+bool ReplayStream::readHeader()
+{
+    std::span<const uint8_t> data = _file.data();
+    if (data.size() < replay::HEADER_SIZE ||
+        std::memcmp(data.data(), replay::MAGIC, sizeof(replay::MAGIC)) != 0) {
+        return false;
+    }
+
+    std::memcpy(&_version, data.data() + sizeof(replay::MAGIC),
+                sizeof(_version));
+    if (_version < replay::VERSION_1 || _version > replay::VERSION_4 ||
+        data.size() < replay::getDataStart(_version)) {
+        return false;
+    }
+    if (_version >= replay::VERSION_4) {
+        std::memcpy(&_metadata, data.data() + replay::HEADER_SIZE,
+                    sizeof(_metadata));
+    }
+    return true;
+}
+
+bool ReplayStream::readIndex()
+{
+    std::span<const uint8_t> data = _file.data();
+    replay::IndexFooter footer;
+    if (data.size() - _dataStart < sizeof(footer)) {
+        return false;
+    }
+
+    size_t footerOffset = data.size() - sizeof(footer);
+    std::memcpy(&footer, data.data() + footerOffset, sizeof(footer));
+    size_t entrySize = isBlocked() ? sizeof(replay::BlockIndexEntry)
+                                   : sizeof(replay::IndexEntry);
+    if (std::memcmp(footer.magic, replay::INDEX_MAGIC, sizeof(footer.magic)) !=
+            0 ||
+        footer.indexOffset < _dataStart || footer.indexOffset > footerOffset ||
+        footerOffset - footer.indexOffset != footer.entryCount * entrySize) {
+        return false;
+    }
+
+    const uint8_t* entries = data.data() + footer.indexOffset;
+    for (uint32_t i = 0; i < footer.entryCount; ++i) {
+        if (isBlocked()) {
+            replay::BlockIndexEntry entry;
+            std::memcpy(&entry, entries + i * entrySize, sizeof(entry));
+            if (entry.flags & replay::BLOCK_KEYFRAME) {
+                _keyframes.push_back(
+                    {entry.firstTimestamp,
+                     {static_cast<size_t>(entry.offset), 0}});
+            }
+        } else {
+            replay::IndexEntry entry;
+            std::memcpy(&entry, entries + i * entrySize, sizeof(entry));
+            _keyframes.push_back(
+                {entry.timestamp, {0, static_cast<size_t>(entry.offset)}});
+        }
+    }
+
+    _dataEnd = static_cast<size_t>(footer.indexOffset);
+    _duration = footer.duration;
+    _recordCount = footer.recordCount;
+    return true;
+}
+
+void ReplayStream::scanRecords()
+{
+    _keyframes.clear();
+    _duration = 0;
+    _recordCount = 0;
+
+    // Stops at the end of the last complete record, which becomes the end
+    // of the data for interrupted recordings
+    ReplayPosition position = getStart();
+    ReplayRecord record;
+    while (readRecord(position, record)) {
+        if (record.isKeyframe) {
+            _keyframes.push_back({record.timestamp, record.position});
+        }
+        _duration = record.timestamp;
+        _recordCount++;
+        position = record.next;
+    }
+    _dataEnd = position.offset;
+}
+
+void ReplayStream::scanBlocks()
+{
+    _keyframes.clear();
+    _duration = 0;
+    _recordCount = 0;
+
+    // Only the block headers are read; a truncated last block is dropped
+    size_t offset = _dataStart;
+    replay::BlockHeader header;
+    while (readBlockHeader(offset, header)) {
+        if (header.flags & replay::BLOCK_KEYFRAME) {
+            _keyframes.push_back({header.firstTimestamp, {offset, 0}});
+        }
+        _duration = header.lastTimestamp;
+        _recordCount += header.recordCount;
+        offset += sizeof(header) + header.compressedSize;
+    }
+    _dataEnd = offset;
+}
+
+bool ReplayStream::readBlockHeader(size_t offset,
+                                   replay::BlockHeader& header) const
+{
+    if (offset < _dataStart || offset >= _dataEnd ||
+        _dataEnd - offset < sizeof(header)) {
+        return false;
+    }
+    std::memcpy(&header, _file.data().data() + offset, sizeof(header));
+    return _dataEnd - offset - sizeof(header) >= header.compressedSize;
+}
+
+bool ReplayStream::loadBlock(size_t offset) const
+{
+    if (offset == _blockOffset) {
+        return true;
+    }
+
+    replay::BlockHeader header;
+    if (!readBlockHeader(offset, header)) {
+        return false;
+    }
+    std::span<const uint8_t> payload =
+        _file.data().subspan(offset + sizeof(header), header.compressedSize);
+    if (!_decoder.decode(header, payload, _block)) {
+        _blockOffset = NO_BLOCK;
+        return false;
+    }
+    _blockOffset = offset;
+    _nextBlockOffset = offset + sizeof(header) + header.compressedSize;
+    return true;
+}
+
+bool ReplayStream::readRawRecord(std::span<const uint8_t> data, size_t offset,
+                                 ReplayRecord& record) const
+{
+    size_t available = data.size() - offset;
+    const uint8_t* cursor = data.data() + offset;
+    size_t headerSize = 0;
+    size_t payloadSize = 0;
+
+    if (_version == replay::VERSION_1) {
+        uint16_t packetSize;
+        headerSize = sizeof(record.timestamp) + sizeof(packetSize);
+        if (available < headerSize) {
+            return false;
+        }
+        std::memcpy(&record.timestamp, cursor, sizeof(record.timestamp));
+        std::memcpy(&packetSize, cursor + sizeof(record.timestamp),
+                    sizeof(packetSize));
+        record.isKeyframe = false;
+        payloadSize = packetSize;
+    } else {
+        replay::RecordHeader header;
+        headerSize = sizeof(header);
+        if (available < headerSize) {
+            return false;
+        }
+        std::memcpy(&header, cursor, sizeof(header));
+        record.timestamp = header.timestamp;
+        record.isKeyframe =
+            header.kind == static_cast<uint8_t>(replay::RecordKind::KEYFRAME);
+        payloadSize = header.size;
+    }
+
+    if (available - headerSize < payloadSize) {
+        return false;
+    }
+    record.payload = {cursor + headerSize, payloadSize};
+    record.next.offset = offset + headerSize + payloadSize;
+    return true;
+}
+
+bool ReplayStream::readRecord(ReplayPosition position,
+                              ReplayRecord& record) const
+{
+    if (!isBlocked()) {
+        if (position.block != 0 || position.offset < _dataStart ||
+            position.offset >= _dataEnd) {
+            return false;
+        }
+        if (!readRawRecord(_file.data().first(_dataEnd), position.offset,
+                           record)) {
+            return false;
+        }
+        record.position = position;
+        record.next.block = 0;
+        return true;
+    }
+
+    if (!loadBlock(position.block) || position.offset >= _block.size() ||
+        !readRawRecord(_block, position.offset, record)) {
+        return false;
+    }
+    record.position = position;
+    record.next.block = position.block;
+    if (record.next.offset == _block.size()) {
+        record.next = {_nextBlockOffset, 0};
+    }
+    return true;
+}
+
+size_t ReplayStream::findKeyframe(uint64_t time) const
+{
+    auto it = std::upper_bound(
+        _keyframes.begin(), _keyframes.end(), time,
+        [](uint64_t value, const Keyframe& keyframe) {
+            return value < keyframe.timestamp;
+        });
+    if (it == _keyframes.begin()) {
+        return NO_KEYFRAME;
+    }
+    return static_cast<size_t>(it - _keyframes.begin()) - 1;
+}
+
+}  // namespace rtype
@@ -0,0 +1,175 @@
+/*
+** EPITECH PROJECT, 2025
+** r-type
+** File description:
+** ReplayStream
+*/
+
+#pragma once
+
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "MappedFile.hpp"
+#include "ReplayBlock.hpp"
+#include "ReplayFormat.hpp"
+
+namespace rtype {
+
+/**
+ * @brief Location of a record in a replay file
+ *
+ * Versions 1 and 2: block is 0 and offset is the record's file offset.
+ * Later versions: block is the file offset of the block and offset the
+ * record's offset in the decoded block. Positions of one stream compare in
+ * file order.
+ */
+struct ReplayPosition {
+    size_t block = 0;
+    size_t offset = 0;
+
+    auto operator<=>(const ReplayPosition&) const = default;
+};
+
+/**
+ * @brief One record of a replay file
+ */
+struct ReplayRecord {
+    uint64_t timestamp = 0;  ///< Milliseconds from replay start
+    bool isKeyframe = false;  ///< payload is a keyframe packet sequence
+    std::span<const uint8_t> payload;  ///< Raw packet or keyframe
+    ReplayPosition position;  ///< Where this record is
+    ReplayPosition next;      ///< Where the following record is
+};
+
+/**
+ * @brief Reader over a memory-mapped replay file
+ *
+ * Records are decoded on demand, so opening a replay does not allocate per
+ * packet. Files with an index footer open in constant time. Version 1
+ * files and interrupted recordings have no footer: their records (or block
+ * headers, from version 3) are walked once on open to find the duration,
+ * the keyframes and the end of the last complete record.
+ *
+ * Version 1 and 2 payloads point straight into the mapping. Later
+ * payloads point into the last decoded block, so they stay valid only
+ * until a record of another block is read. Not thread-safe.
+ */
+class ReplayStream {
+   public:
+    struct Keyframe {
+        uint64_t timestamp;
+        ReplayPosition position;  ///< Position of the keyframe record
+    };
+
+    /**
+     * @brief Forward iterator over the records of a stream
+     */
+    class Iterator {
+       public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = ReplayRecord;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const ReplayRecord*;
+        using reference = const ReplayRecord&;
+
+        Iterator() = default;
+        Iterator(const ReplayStream* stream, ReplayPosition position);
+
+        reference operator*() const { return _record; }
+        pointer operator->() const { return &_record; }
+        Iterator& operator++();
+        Iterator operator++(int);
+        bool operator==(const Iterator& other) const
+        {
+            return _position == other._position;
+        }
+
+       private:
+        const ReplayStream* _stream = nullptr;
+        ReplayPosition _position;
+        ReplayRecord _record;
+    };
+
+    /**
+     * @brief Map a replay file and read its header and index
+     * @return false if the file cannot be mapped or is not a replay
+     */
+    bool open(const std::string& filePath);
+
+    void close();
+
+    /**
+     * @brief Decode the record at position
+     * @return false past the last complete record
+     */
+    bool readRecord(ReplayPosition position, ReplayRecord& record) const;
+
+    Iterator begin() const { return Iterator(this, getStart()); }
+    Iterator end() const { return Iterator(this, getEnd()); }
+
+    /**
+     * @brief Iterate from a position returned in ReplayRecord or Keyframe
+     */
+    Iterator at(ReplayPosition position) const
+    {
+        return Iterator(this, position);
+    }
+
+    ReplayPosition getStart() const;
+    ReplayPosition getEnd() const;
+
+    uint32_t getVersion() const { return _version; }
+    uint64_t getDuration() const { return _duration; }
+    uint64_t getRecordCount() const { return _recordCount; }
+
+    /**
+     * @brief Metadata of a version 4 file, all zero for older versions
+     */
+    const replay::ReplayMetadata& getMetadata() const { return _metadata; }
+    const std::vector<Keyframe>& getKeyframes() const { return _keyframes; }
+
+    /**
+     * @brief Index of the last keyframe at or before time
+     * @return NO_KEYFRAME if there is none
+     */
+    size_t findKeyframe(uint64_t time) const;
+
+    static constexpr size_t NO_KEYFRAME = static_cast<size_t>(-1);
+
+   private:
+    bool isBlocked() const { return _version >= replay::VERSION_3; }
+
+    bool readHeader();
+    bool readIndex();
+    void scanRecords();
+    void scanBlocks();
+    bool readBlockHeader(size_t offset, replay::BlockHeader& header) const;
+    bool readRawRecord(std::span<const uint8_t> data, size_t offset,
+                       ReplayRecord& record) const;
+    bool loadBlock(size_t offset) const;
+
+    MappedFile _file;
+    uint32_t _version = 0;
+    size_t _dataStart = 0;
+    size_t _dataEnd = 0;
+    uint64_t _duration = 0;
+    uint64_t _recordCount = 0;
+    replay::ReplayMetadata _metadata{};
+    std::vector<Keyframe> _keyframes;  // Sorted by timestamp
+
+    // Version 3 and later: the last decoded block
+    mutable ReplayBlockDecoder _decoder;
+    mutable std::vector<uint8_t> _block;
+    mutable size_t _blockOffset = NO_BLOCK;
+    mutable size_t _nextBlockOffset = 0;
+
+    static constexpr size_t NO_BLOCK = static_cast<size_t>(-1);
+};
+
+}  // namespace rtype
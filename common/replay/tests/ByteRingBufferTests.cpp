@@ -0,0 +1,127 @@
+/*
+** EPITECH PROJECT, 2025
+** r-type
+** File description:
+** ByteRingBufferTests
+*/
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include "common/replay/ByteRingBuffer.hpp"
+
+using namespace rtype;
+
+namespace {
+
+std::vector<uint8_t> sequence(size_t size, uint8_t first)
+{
+    std::vector<uint8_t> bytes(size);
+    std::iota(bytes.begin(), bytes.end(), first);
+    return bytes;
+}
+
+std::vector<uint8_t> toVector(std::span<const uint8_t> bytes)
+{
+    return {bytes.begin(), bytes.end()};
+}
+
+}  // namespace
+
+TEST(ByteRingBufferTests, RoundsTheCapacityUpToAPowerOfTwo)
+{
+    EXPECT_EQ(ByteRingBuffer(100).capacity(), 128u);
+    EXPECT_EQ(ByteRingBuffer(64).capacity(), 64u);
+}
+
+TEST(ByteRingBufferTests, MessagesWrapAroundTheEnd)
+{
+    ByteRingBuffer ring(16);
+    auto skipped = sequence(12, 0);
+    ASSERT_TRUE(ring.write({skipped}));
+    ring.consume(12);
+
+    // Two parts starting 4 bytes before the end of the buffer
+    auto first = sequence(3, 100);
+    auto second = sequence(7, 103);
+    ASSERT_TRUE(ring.write({first, second}));
+    EXPECT_EQ(ring.size(), 10u);
+    EXPECT_FALSE(ring.empty());
+
+    EXPECT_EQ(toVector(ring.peek()), sequence(4, 100));
+    ring.consume(4);
+    EXPECT_EQ(toVector(ring.peek()), sequence(6, 104));
+    ring.consume(6);
+    EXPECT_EQ(ring.size(), 0u);
+    EXPECT_TRUE(ring.peek().empty());
+    EXPECT_TRUE(ring.empty());
+}
+
+TEST(ByteRingBufferTests, PartialConsumeKeepsTheRest)
+{
+    ByteRingBuffer ring(16);
+    auto bytes = sequence(8, 1);
+    ASSERT_TRUE(ring.write({bytes}));
+
+    ring.consume(3);
+    EXPECT_EQ(ring.size(), 5u);
+    EXPECT_EQ(toVector(ring.peek()), sequence(5, 4));
+}
+
+TEST(ByteRingBufferTests, RejectsMessagesThatDoNotFit)
+{
+    ByteRingBuffer ring(16);
+    auto ten = sequence(10, 0);
+    auto seven = sequence(7, 0);
+    auto six = sequence(6, 0);
+    ASSERT_TRUE(ring.write({ten}));
+
+    // Nothing of a rejected message is written, even of its first part
+    EXPECT_FALSE(ring.write({six, std::span<const uint8_t>(seven).first(1)}));
+    EXPECT_EQ(ring.size(), 10u);
+    EXPECT_FALSE(ring.write({seven}));
+    EXPECT_EQ(ring.size(), 10u);
+
+    EXPECT_TRUE(ring.write({six}));
+    EXPECT_EQ(ring.size(), 16u);
+    EXPECT_FALSE(ring.write({std::span<const uint8_t>(six).first(1)}));
+
+    ring.consume(16);
+    EXPECT_TRUE(ring.write({ten}));
+}
+
+TEST(ByteRingBufferTests, ConsumerSeesTheProducerBytesInOrder)
+{
+    constexpr uint32_t MESSAGES = 100000;
+    ByteRingBuffer ring(256);
+
+    std::thread producer([&ring]() {
+        for (uint32_t i = 0; i < MESSAGES;) {
+            const auto* bytes = reinterpret_cast<const uint8_t*>(&i);
+            if (ring.write({{bytes, sizeof(i)}})) {
+                ++i;
+            }
+        }
+    });
+
+    std::vector<uint8_t> received;
+    received.reserve(MESSAGES * sizeof(uint32_t));
+    while (received.size() < MESSAGES * sizeof(uint32_t)) {
+        auto chunk = ring.peek();
+        received.insert(received.end(), chunk.begin(), chunk.end());
+        ring.consume(chunk.size());
+    }
+    producer.join();
+
+    for (uint32_t i = 0; i < MESSAGES; ++i) {
+        uint32_t value;
+        std::memcpy(&value, received.data() + i * sizeof(value),
+                    sizeof(value));
+        ASSERT_EQ(value, i);
+    }
+}
@@ -0,0 +1,103 @@
+/*
+** EPITECH PROJECT, 2025
+** r-type
+** File description:
+** Lz4CodecTests
+*/
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "common/replay/Lz4Codec.hpp"
+
+using namespace rtype;
+
+namespace {
+
+std::vector<uint8_t> compress(const std::vector<uint8_t>& input)
+{
+    std::vector<uint8_t> output(lz4::compressBound(input.size()));
+    output.resize(lz4::compress(input.data(), input.size(), output.data()));
+    return output;
+}
+
+void expectRoundTrip(const std::vector<uint8_t>& input)
+{
+    std::vector<uint8_t> compressed = compress(input);
+    ASSERT_LE(compressed.size(), lz4::compressBound(input.size()));
+
+    std::vector<uint8_t> decoded(input.size());
+    ASSERT_TRUE(lz4::decompress(compressed.data(), compressed.size(),
+                                decoded.data(), decoded.size()));
+    EXPECT_EQ(decoded, input);
+}
+
+}  // namespace
+
+TEST(Lz4CodecTests, RoundTripsRandomData)
+{
+    std::mt19937 rng(42);
+    for (size_t size : {1u, 13u, 100u, 4096u, 70000u}) {
+        std::vector<uint8_t> input(size);
+        for (auto& byte : input) {
+            byte = static_cast<uint8_t>(rng());
+        }
+        expectRoundTrip(input);
+    }
+}
+
+TEST(Lz4CodecTests, RoundTripsAndShrinksRepetitiveData)
+{
+    std::vector<uint8_t> input(64 * 1024);
+    for (size_t i = 0; i < input.size(); ++i) {
+        input[i] = static_cast<uint8_t>("r-type packet "[i % 14]);
+    }
+    expectRoundTrip(input);
+    EXPECT_LT(compress(input).size(), input.size() / 20);
+
+    // Long runs use overlapping matches and extended lengths
+    std::vector<uint8_t> zeros(100000, 0);
+    expectRoundTrip(zeros);
+}
+
+TEST(Lz4CodecTests, RoundTripsEmptyInput)
+{
+    expectRoundTrip({});
+}
+
+TEST(Lz4CodecTests, RejectsMalformedInput)
+{
+    std::vector<uint8_t> input(4096);
+    for (size_t i = 0; i < input.size(); ++i) {
+        input[i] = static_cast<uint8_t>(i % 7);
+    }
+    std::vector<uint8_t> compressed = compress(input);
+    std::vector<uint8_t> decoded(input.size() + 1);
+
+    // Truncated block
+    EXPECT_FALSE(lz4::decompress(compressed.data(), compressed.size() - 1,
+                                 decoded.data(), input.size()));
+    // Decodes to a different size than announced
+    EXPECT_FALSE(lz4::decompress(compressed.data(), compressed.size(),
+                                 decoded.data(), input.size() - 1));
+    EXPECT_FALSE(lz4::decompress(compressed.data(), compressed.size(),
+                                 decoded.data(), input.size() + 1));
+
+    // One literal, then a match reaching before the start of the output
+    const uint8_t badOffset[] = {0x10, 'a', 0x05, 0x00};
+    EXPECT_FALSE(
+        lz4::decompress(badOffset, sizeof(badOffset), decoded.data(), 5));
+
+    // Zero offset
+    const uint8_t zeroOffset[] = {0x10, 'a', 0x00, 0x00};
+    EXPECT_FALSE(
+        lz4::decompress(zeroOffset, sizeof(zeroOffset), decoded.data(), 5));
+
+    // Literal length running past the end of the input
+    const uint8_t longLiterals[] = {0xF0, 0xFF, 0xFF};
+    EXPECT_FALSE(lz4::decompress(longLiterals, sizeof(longLiterals),
+                                 decoded.data(), decoded.size()));
+}
@@ -0,0 +1,345 @@
+/*
+** EPITECH PROJECT, 2025
+** r-type
+** File description:
+** ReplayRecorderTests
+*/
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "common/network/Protocol.hpp"
+#include "common/replay/ReplayPlayer.hpp"
+#include "common/replay/ReplayRecorder.hpp"
+#include "common/replay/ReplayState.hpp"
+#include "common/replay/ReplayStream.hpp"
+
+using namespace rtype;
+
+namespace {
+
+constexpr uint32_t ENTITY_COUNT = 10;
+constexpr uint64_t DURATION_MS = 12000;
+constexpr uint64_t FRAME_MS = 20;
+
+using Packet = std::vector<uint8_t>;
+
+bool sameState(const ReplayState& expected, const ReplayState& actual)
+{
+    if (expected.getEntities().size() != actual.getEntities().size() ||
+        expected.getScore() != actual.getScore() ||
+        expected.getPlayerId() != actual.getPlayerId()) {
+        return false;
+    }
+    for (const auto& [id, entity] : expected.getEntities()) {
+        auto it = actual.getEntities().find(id);
+        if (it == actual.getEntities().end() ||
+            it->second.type != entity.type || it->second.x != entity.x ||
+            it->second.y != entity.y || it->second.health != entity.health) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
+class ReplayRecorderTests : public ::testing::Test {
+   protected:
+    std::filesystem::path path;
+    std::vector<Packet> recorded;
+    std::map<uint64_t, ReplayState> stateAtSecond;
+
+    void SetUp() override
+    {
+        path = std::filesystem::temp_directory_path() /
+               ("rtype_replay_" +
+                std::string(::testing::UnitTest::GetInstance()
+                                ->current_test_info()
+                                ->name()) +
+                ".rtr");
+    }
+
+    void TearDown() override { std::filesystem::remove(path); }
+
+    template <typename T>
+    void record(ReplayRecorder& recorder, ReplayState& state, const T& packet)
+    {
+        const auto* bytes = reinterpret_cast<const uint8_t*>(&packet);
+        recorded.emplace_back(bytes, bytes + sizeof(packet));
+        state.apply(&packet, sizeof(packet));
+        recorder.recordPacket(&packet, sizeof(packet));
+    }
+
+    /**
+     * @brief Record entities moving for DURATION_MS on a simulated clock,
+     * with keyframes whenever the recorder asks for one
+     */
+    void recordMatch()
+    {
+        uint64_t now = 0;
+        ReplayState state;
+        ReplayRecorder recorder(path.string());
+        recorder.setClock([&now]() { return now; });
+        ASSERT_TRUE(recorder.startRecording());
+
+        LoginResponsePacket login{};
+        login.header.opCode = S2C_LOGIN_OK;
+        login.playerId = 1;
+        login.mapWidth = 1920;
+        login.mapHeight = 1080;
+        record(recorder, state, login);
+        for (uint32_t id = 1; id <= ENTITY_COUNT; ++id) {
+            EntitySpawnPacket spawn{};
+            spawn.header.opCode = S2C_ENTITY_NEW;
+            spawn.entityId = id;
+            spawn.type = static_cast<uint8_t>(id == 1 ? 1 : 3);
+            spawn.x = 100.0f * static_cast<float>(id);
+            spawn.y = 50.0f;
+            record(recorder, state, spawn);
+        }
+
+        for (now = FRAME_MS; now <= DURATION_MS; now += FRAME_MS) {
+            if (recorder.isKeyframeDue()) {
+                std::vector<uint8_t> keyframe;
+                state.appendKeyframe(keyframe);
+                recorder.recordKeyframe(keyframe);
+            }
+            for (uint32_t id = 1; id <= ENTITY_COUNT; ++id) {
+                EntityPositionPacket position{};
+                position.header.opCode = S2C_ENTITY_POS;
+                position.entityId = id;
+                position.x = 100.0f * static_cast<float>(id);
+                position.y = static_cast<float>(now % 1000) +
+                             static_cast<float>(id);
+                record(recorder, state, position);
+            }
+            if (now % 1000 == 0) {
+                stateAtSecond[now] = state;
+            }
+        }
+        recorder.stopRecording();
+        EXPECT_EQ(recorder.getDroppedRecordCount(), 0u);
+    }
+};
+
+TEST_F(ReplayRecorderTests, PlaysBackEveryRecordedPacket)
+{
+    recordMatch();
+
+    ReplayPlayer player(path.string());
+    ASSERT_TRUE(player.load());
+    EXPECT_EQ(player.getTotalDuration(), DURATION_MS);
+
+    std::vector<Packet> played;
+    player.startPlayback([&played](const void* data, size_t size) {
+        const auto* bytes = static_cast<const uint8_t*>(data);
+        played.emplace_back(bytes, bytes + size);
+    });
+    while (!player.isFinished()) {
+        player.update(0.1f);
+    }
+
+    ASSERT_EQ(played.size(), recorded.size());
+    for (size_t i = 0; i < played.size(); ++i) {
+        ASSERT_EQ(played[i], recorded[i]) << "packet " << i;
+    }
+}
+
+TEST_F(ReplayRecorderTests, SeekingBackwardRestoresTheEarlierState)
+{
+    recordMatch();
+
+    ReplayPlayer player(path.string());
+    ASSERT_TRUE(player.load());
+
+    // What a client rebuilds from the packets it is given
+    ReplayState received;
+    int resets = 0;
+    player.setResetCallback([&]() {
+        received.clear();
+        resets++;
+    });
+    player.startPlayback([&received](const void* data, size_t size) {
+        received.apply(data, size);
+    });
+    while (player.getCurrentTime() < 11000) {
+        player.update(0.1f);
+    }
+    ASSERT_EQ(player.getCurrentTime(), 11000u);
+    EXPECT_TRUE(sameState(stateAtSecond[11000], received));
+
+    // Lands between the keyframes at 5 s and 10 s
+    player.seek(-3.0f);
+    EXPECT_EQ(player.getCurrentTime(), 8000u);
+    EXPECT_EQ(resets, 1);
+    EXPECT_TRUE(sameState(stateAtSecond[8000], player.getState()));
+    EXPECT_TRUE(sameState(stateAtSecond[8000], received));
+
+    while (player.getCurrentTime() < 9000) {
+        player.update(0.1f);
+    }
+    EXPECT_TRUE(sameState(stateAtSecond[9000], received));
+}
+
+TEST_F(ReplayRecorderTests, SeekingFromACheckpointMatchesAPlainSeek)
+{
+    recordMatch();
+
+    ReplayPlayer player(path.string());
+    ASSERT_TRUE(player.load());
+    ReplayState received;
+    int resets = 0;
+    player.setResetCallback([&resets]() { resets++; });
+    player.startPlayback([&received](const void* data, size_t size) {
+        received.apply(data, size);
+    });
+
+    EXPECT_EQ(player.getSeekStartTime(4000), 0u);
+    EXPECT_EQ(player.getSeekStartTime(8000), 5000u);
+
+    while (player.getCurrentTime() < 6000) {
+        player.update(0.1f);
+    }
+    ReplayCheckpoint checkpoint;
+    player.saveCheckpoint(checkpoint);
+    ReplayState receivedAtCheckpoint = received;
+    EXPECT_TRUE(sameState(stateAtSecond[6000], checkpoint.state));
+
+    while (player.getCurrentTime() < 9000) {
+        player.update(0.1f);
+    }
+    received = receivedAtCheckpoint;
+    player.seekFromCheckpoint(checkpoint, 6500);
+    EXPECT_EQ(player.getCurrentTime(), 6500u);
+    EXPECT_EQ(resets, 0);
+
+    // The same target reached by seek(), from the keyframe at 5 s
+    ReplayPlayer reference(path.string());
+    ASSERT_TRUE(reference.load());
+    ReplayState referenceReceived;
+    reference.setResetCallback(
+        [&referenceReceived]() { referenceReceived.clear(); });
+    reference.startPlayback(
+        [&referenceReceived](const void* data, size_t size) {
+            referenceReceived.apply(data, size);
+        });
+    while (reference.getCurrentTime() < 9000) {
+        reference.update(0.1f);
+    }
+    reference.seek(-2.5f);
+    ASSERT_EQ(reference.getCurrentTime(), 6500u);
+
+    EXPECT_TRUE(sameState(reference.getState(), player.getState()));
+    EXPECT_TRUE(sameState(referenceReceived, received));
+    EXPECT_TRUE(sameState(player.getState(), received));
+
+    // Both keep playing the same packets
+    while (player.getCurrentTime() < 7000) {
+        player.update(0.1f);
+        reference.update(0.1f);
+    }
+    EXPECT_TRUE(sameState(stateAtSecond[7000], received));
+    EXPECT_TRUE(sameState(stateAtSecond[7000], referenceReceived));
+}
+
+TEST_F(ReplayRecorderTests, CheckpointsNewerThanTheTargetAreNotRewound)
+{
+    recordMatch();
+
+    ReplayPlayer player(path.string());
+    ASSERT_TRUE(player.load());
+    ReplayState received;
+    player.startPlayback([&received](const void* data, size_t size) {
+        received.apply(data, size);
+    });
+    while (player.getCurrentTime() < 6000) {
+        player.update(0.1f);
+    }
+    ReplayCheckpoint checkpoint;
+    player.saveCheckpoint(checkpoint);
+    ReplayState receivedAtCheckpoint = received;
+
+    while (player.getCurrentTime() < 8000) {
+        player.update(0.1f);
+    }
+    received = receivedAtCheckpoint;
+    player.seekFromCheckpoint(checkpoint, 5000);
+    EXPECT_EQ(player.getCurrentTime(), 6000u);
+    EXPECT_TRUE(sameState(stateAtSecond[6000], player.getState()));
+    EXPECT_TRUE(sameState(stateAtSecond[6000], received));
+
+    while (player.getCurrentTime() < 7000) {
+        player.update(0.1f);
+    }
+    EXPECT_TRUE(sameState(stateAtSecond[7000], received));
+}
+
+TEST_F(ReplayRecorderTests, DroppedRecordsAreCountedAndFollowedByAKeyframe)
+{
+    uint64_t now = 0;
+    ReplayState state;
+    ReplayRecorder recorder(path.string(), 256);
+    recorder.setClock([&now]() { return now; });
+    ASSERT_TRUE(recorder.startRecording());
+
+    // A burst far larger than the ring: the writer polls every 10 ms
+    constexpr uint32_t BURST = 200;
+    for (uint32_t id = 1; id <= BURST; ++id) {
+        EntitySpawnPacket spawn{};
+        spawn.header.opCode = S2C_ENTITY_NEW;
+        spawn.entityId = id;
+        spawn.type = 3;
+        record(recorder, state, spawn);
+    }
+    uint64_t dropped = recorder.getDroppedRecordCount();
+    EXPECT_GT(dropped, 0u);
+    EXPECT_FALSE(recorder.isKeyframeDue());
+
+    // Keyframes are asked for every 250 ms until one fits in the ring
+    ReplayState small;
+    small.apply(recorded.front().data(), recorded.front().size());
+    std::vector<uint8_t> keyframe;
+    small.appendKeyframe(keyframe);
+    uint64_t keyframeTime = 0;
+    for (now = 250; now <= 2500 && recorder.isKeyframeDue(); now += 250) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        keyframeTime = now;
+        recorder.recordKeyframe(keyframe);
+    }
+    EXPECT_FALSE(recorder.isKeyframeDue());
+
+    EntityPositionPacket position{};
+    position.header.opCode = S2C_ENTITY_POS;
+    position.entityId = 1;
+    record(recorder, state, position);
+    recorder.stopRecording();
+    EXPECT_EQ(recorder.getDroppedRecordCount(), dropped);
+
+    ReplayStream stream;
+    ASSERT_TRUE(stream.open(path.string()));
+    uint64_t packets = 0;
+    uint64_t packetsAfterKeyframe = 0;
+    bool sawKeyframe = false;
+    for (const ReplayRecord& replayRecord : stream) {
+        if (replayRecord.isKeyframe) {
+            EXPECT_EQ(replayRecord.timestamp, keyframeTime);
+            sawKeyframe = true;
+        } else {
+            packets++;
+            packetsAfterKeyframe += sawKeyframe ? 1 : 0;
+        }
+    }
+    EXPECT_TRUE(sawKeyframe);
+    EXPECT_EQ(packetsAfterKeyframe, 1u);
+    EXPECT_EQ(packets, BURST + 1 - dropped);
+    ASSERT_EQ(stream.getKeyframes().size(), 1u);
+    EXPECT_EQ(stream.getKeyframes().front().timestamp, keyframeTime);
+}
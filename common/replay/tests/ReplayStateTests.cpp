@@ -0,0 +1,73 @@
+/*
+** EPITECH PROJECT, 2025
+** r-type
+** File description:
+** ReplayStateTests
+*/
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+#include "common/network/Protocol.hpp"
+#include "common/replay/ReplayState.hpp"
+
+using namespace rtype;
+
+namespace {
+
+void login(ReplayState& state, uint32_t playerId)
+{
+    LoginResponsePacket packet{};
+    packet.header.opCode = S2C_LOGIN_OK;
+    packet.playerId = playerId;
+    packet.mapWidth = 1920;
+    packet.mapHeight = 1080;
+    state.apply(&packet, sizeof(packet));
+}
+
+void spawn(ReplayState& state, uint32_t entityId)
+{
+    EntitySpawnPacket packet{};
+    packet.header.opCode = S2C_ENTITY_NEW;
+    packet.entityId = entityId;
+    packet.type = 2;
+    state.apply(&packet, sizeof(packet));
+}
+
+}  // namespace
+
+TEST(ReplayStateTests, SpectatorSnapshotsDropEntitiesTheyMissed)
+{
+    ReplayState state;
+    login(state, 0);
+    spawn(state, 1);
+    spawn(state, 2);
+
+    // Snapshot confirming only entity 1: the death of 2 was lost
+    login(state, 0);
+    spawn(state, 1);
+    spawn(state, 3);
+    EXPECT_EQ(state.getEntities().size(), 3u);
+
+    state.beginChanges();
+    login(state, 0);
+    EXPECT_EQ(state.getEntities().size(), 2u);
+    EXPECT_EQ(state.getEntities().count(2), 0u);
+
+    int deaths = 0;
+    state.emitChanges([&deaths](const void* data, size_t) {
+        deaths += static_cast<const Header*>(data)->opCode == S2C_ENTITY_DEAD;
+    });
+    EXPECT_EQ(deaths, 1);
+}
+
+TEST(ReplayStateTests, PlayerLoginsKeepEntities)
+{
+    ReplayState state;
+    login(state, 4);
+    spawn(state, 1);
+    login(state, 4);
+    login(state, 4);
+    EXPECT_EQ(state.getEntities().size(), 1u);
+}
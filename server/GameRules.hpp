@@ -0,0 +1,68 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** GameRules
+*/
+
+#pragma once
+
+#include <cstdint>
+
+#include "../common/network/EntityType.hpp"
+
+namespace rtype::rules {
+
+/**
+ * @brief How far behind the server clients draw remote entities (seconds)
+ *
+ * Matches the client's default interpolation delay; added to the measured
+ * round trip to know where a player saw its targets when it fired.
+ */
+constexpr float CLIENT_VIEW_DELAY = 0.1f;
+
+/**
+ * @brief Check whether an entity type counts as an enemy for scoring
+ */
+inline bool isEnemy(uint8_t entityType)
+{
+    return entityType == EntityType::BOSS || entityType == EntityType::BASIC ||
+           entityType == EntityType::FAST || entityType == EntityType::TANK ||
+           entityType == EntityType::TURRET ||
+           entityType == EntityType::ORBITER ||
+           entityType == EntityType::LASER_SHIP ||
+           entityType == EntityType::GLANDUS ||
+           entityType == EntityType::GLANDUS_MINI;
+}
+
+/**
+ * @brief Get the points awarded for killing an enemy
+ * @return Score value, 0 if the type is not an enemy
+ */
+inline uint32_t getScoreForEnemy(uint8_t entityType)
+{
+    switch (entityType) {
+        case EntityType::BOSS:
+            return 5000;
+        case EntityType::BASIC:
+            return 100;
+        case EntityType::FAST:
+            return 150;
+        case EntityType::TANK:
+            return 200;
+        case EntityType::TURRET:
+            return 250;
+        case EntityType::ORBITER:
+            return 175;
+        case EntityType::LASER_SHIP:
+            return 300;
+        case EntityType::GLANDUS:
+            return 250;
+        case EntityType::GLANDUS_MINI:
+            return 75;
+        default:
+            return 0;
+    }
+}
+
+}  // namespace rtype::rules
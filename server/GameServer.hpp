@@ -7,57 +7,25 @@
 
 #pragma once
 
-#include <atomic>
-#include <memory>
-#include <mutex>
-#include <unordered_map>
-#include <vector>
+#include <cstdint>
 
-#include "ServerConfig.hpp"
-#include "engine/system/GameLoop.hpp"
-#include "network/NetworkServer.hpp"
+#include "RoomManager.hpp"
 
 namespace rtype {
 
+/**
+ * @brief Single-match server
+ *
+ * A RoomManager hosting one room that every client joins, whatever room its
+ * login asks for. The lobby, match, recording and reset logic is the
+ * room's, so single-match mode and rooms behave the same.
+ */
 class GameServer {
    private:
-    NetworkServer _networkServer;
-    engine::GameLoop _gameLoop;
+    RoomManager _rooms;
 
-    std::atomic<bool> _gameStarted;
-    std::atomic<bool> _needsReset;
-    std::atomic<int> _playerCount;
-    std::atomic<uint32_t> _nextPlayerId;
-    std::mutex _playerMutex;
-    std::unordered_map<uint32_t, bool> _playersReady;
-
-    std::atomic<uint32_t> _score;
-
-    int _maxPlayers;
-    bool _powerUpsEnabled;
-    bool _friendlyFireEnabled;
-
-    static constexpr int MIN_PLAYERS_TO_START = 1;
     static constexpr uint16_t DEFAULT_PORT = 8080;
 
-    void setupNetworkCallbacks();
-    void onClientConnected(uint32_t clientId, const std::string& ip,
-                           uint16_t port);
-    void onClientDisconnected(uint32_t clientId);
-    void onClientLogin(uint32_t clientId, const LoginPacket& packet);
-    void onClientInput(uint32_t clientId, const InputPacket& packet);
-    void onPlayerDeath(uint32_t clientId);
-
-    void waitForPlayers();
-    void processNetworkUpdates();
-    void sendHealthUpdates();
-    void sendShieldUpdates();
-    void resetGameState();
-    bool isEnemy(uint8_t entityType) const;
-    void resetPlayers();
-    void checkLevelProgression();
-    uint32_t getScoreForEnemy(uint8_t entityType) const;
-
    public:
     GameServer(float targetFPS = 60.0f, uint32_t timeoutSeconds = 30);
     ~GameServer();
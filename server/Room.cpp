@@ -0,0 +1,473 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Room
+*/
+
+#include "Room.hpp"
+
+#include <algorithm>
+#include <ctime>
+#include <filesystem>
+#include <random>
+#include <tuple>
+
+#include "../common/network/NetworkMessage.hpp"
+#include "../common/utils/Logger.hpp"
+#include "GameRules.hpp"
+#include "ServerConfig.hpp"
+#include "engine/wave/WaveManager.hpp"
+
+namespace rtype {
+
+Room::Room(uint16_t roomId, NetworkServer& networkServer, int maxPlayers,
+           bool powerUpsEnabled, bool friendlyFireEnabled, float targetFPS)
+    : _roomId(roomId),
+      _networkServer(networkServer),
+      _gameLoop(targetFPS),
+      _maxPlayers(maxPlayers)
+{
+    _gameLoop.addDefaultSystems(
+        powerUpsEnabled, friendlyFireEnabled,
+        ServerConfig::getInstance().getLagCompensationWindow());
+    _gameLoop.setOnPlayerDeath(
+        [this](uint32_t clientId) { onPlayerDeath(clientId); });
+
+    // Spectators see the room as player 0, which owns no ship
+    publish(NetworkMessage::createLoginResponsePacket(0, 1920, 1080, 0));
+}
+
+Room::~Room() { _gameLoop.stop(); }
+
+void Room::queueLogin(uint32_t clientId, const std::string& username)
+{
+    _events.push({RoomEvent::Type::Login, clientId, username});
+}
+
+void Room::queueDisconnect(uint32_t clientId)
+{
+    _events.push({RoomEvent::Type::Disconnect, clientId, {}});
+}
+
+void Room::queueInput(uint32_t clientId, uint8_t inputMask,
+                      uint32_t sequenceId)
+{
+    engine::NetworkInputCommand cmd;
+    cmd.clientId = clientId;
+    cmd.inputMask = inputMask;
+    cmd.timestamp = 0.0f;
+    cmd.sequenceId = sequenceId;
+    cmd.viewLatency =
+        _networkServer.getClientRtt(clientId) + rules::CLIENT_VIEW_DELAY;
+    _gameLoop.queueInput(cmd);
+}
+
+bool Room::isIdle(float timeoutSeconds) const
+{
+    return !_gameStarted && _members.empty() && _idleTime >= timeoutSeconds;
+}
+
+void Room::tick(float deltaTime)
+{
+    processEvents();
+
+    if (_needsReset) {
+        resetMatch();
+    }
+
+    if (!_gameStarted) {
+        if (static_cast<int>(_playersReady.size()) < MIN_PLAYERS_TO_START) {
+            if (_members.empty()) {
+                _idleTime += deltaTime;
+            }
+            return;
+        }
+        startMatch();
+    }
+    _idleTime = 0.0f;
+
+    _gameLoop.tick(deltaTime);
+    sendEntityUpdates();
+    sendInputAcks();
+
+    _frameCounter++;
+    if (_frameCounter % 10 == 0) {
+        sendHealthUpdates();
+        sendShieldUpdates();
+    }
+
+    updateLevelTransition(deltaTime);
+}
+
+void Room::processEvents()
+{
+    while (auto event = _events.tryPop()) {
+        if (event->type == RoomEvent::Type::Login) {
+            onClientLogin(event->clientId, event->username);
+        } else {
+            onClientDisconnected(event->clientId);
+        }
+    }
+    _memberCount.store(static_cast<int>(_members.size()));
+}
+
+void Room::onClientLogin(uint32_t clientId, const std::string& username)
+{
+    if (std::find(_members.begin(), _members.end(), clientId) !=
+        _members.end()) {
+        return;
+    }
+
+    if (static_cast<int>(_playersReady.size()) >= _maxPlayers) {
+        Logger::getInstance().log(
+            "Room " + std::to_string(_roomId) + " is full! Rejecting client " +
+                std::to_string(clientId),
+            LogLevel::WARNING_L, "Lobby");
+        _networkServer.sendLoginRejected(
+            clientId, static_cast<uint8_t>(RejectReason::SERVER_FULL));
+        return;
+    }
+
+    _members.push_back(clientId);
+    _playersReady[clientId] = true;
+
+    Logger::getInstance().log(
+        "Client " + std::to_string(clientId) + " ('" + username +
+            "') joined room " + std::to_string(_roomId) + " (" +
+            std::to_string(_playersReady.size()) + "/" +
+            std::to_string(_maxPlayers) + ")",
+        LogLevel::INFO_L, "Lobby");
+
+    uint32_t newPlayerId = _nextPlayerId++;
+    if (!_networkServer.sendLoginResponse(clientId, newPlayerId, 1920, 1080)) {
+        return;
+    }
+
+    float startX = 100.0f;
+    float startY = 200.0f + (newPlayerId - 1) * 200.0f;
+    uint32_t playerEntityId =
+        _gameLoop.spawnPlayer(clientId, newPlayerId, startX, startY);
+
+    if (playerEntityId > 0) {
+        _networkServer.sendEntitySpawn(clientId, playerEntityId,
+                                       EntityType::PLAYER, startX, startY);
+        publish(NetworkMessage::createEntitySpawnPacket(
+            playerEntityId, EntityType::PLAYER, startX, startY, 0));
+    }
+
+    std::vector<engine::EntityStateUpdate> existingEntities;
+    _gameLoop.getAllEntities(existingEntities);
+    for (const auto& entityUpdate : existingEntities) {
+        if (entityUpdate.entityId == playerEntityId) {
+            continue;
+        }
+        _networkServer.sendEntitySpawn(clientId, entityUpdate.entityId,
+                                       entityUpdate.entityType, entityUpdate.x,
+                                       entityUpdate.y);
+    }
+}
+
+void Room::onClientDisconnected(uint32_t clientId)
+{
+    auto it = std::find(_members.begin(), _members.end(), clientId);
+    if (it == _members.end()) {
+        return;
+    }
+    _members.erase(it);
+    _playersReady.erase(clientId);
+    _gameLoop.removePlayer(clientId);
+
+    Logger::getInstance().log("Client " + std::to_string(clientId) +
+                                  " left room " + std::to_string(_roomId),
+                              LogLevel::INFO_L, "Lobby");
+
+    if (_playersReady.empty() && _gameStarted) {
+        _needsReset = true;
+    }
+}
+
+void Room::onPlayerDeath(uint32_t clientId)
+{
+    if (_playersReady.erase(clientId) == 0) {
+        return;
+    }
+
+    Logger::getInstance().log(
+        "Player " + std::to_string(clientId) + " died in room " +
+            std::to_string(_roomId) + ", " +
+            std::to_string(_playersReady.size()) + " remaining",
+        LogLevel::INFO_L, "Game");
+
+    if (_playersReady.empty() && _gameStarted) {
+        _needsReset = true;
+    }
+}
+
+void Room::startMatch()
+{
+    startMatchRecording();
+    _gameLoop.start(false);
+    _gameStarted = true;
+
+    auto* waveManager = _gameLoop.getSystem<engine::WaveManager>();
+    if (!waveManager) {
+        Logger::getInstance().log("WaveManager not found - room " +
+                                      std::to_string(_roomId) +
+                                      " cannot start!",
+                                  LogLevel::CRITICAL_L, "Game");
+        return;
+    }
+
+    waveManager->setOnWaveStartCallback(
+        [this](int waveNumber, int totalWaves, int levelId) {
+            sendGameEvent(GameEventType::GAME_EVENT_WAVE_START,
+                          static_cast<uint8_t>(waveNumber),
+                          static_cast<uint8_t>(totalWaves),
+                          static_cast<uint8_t>(levelId));
+        });
+    waveManager->setOnLevelCompleteCallback([this](int levelId) {
+        sendGameEvent(GameEventType::GAME_EVENT_LEVEL_COMPLETE, 0, 0,
+                      static_cast<uint8_t>(levelId));
+        _levelTransitionTimer = LEVEL_TRANSITION_DELAY;
+    });
+
+    if (!_gameLoop.startLevel(1, static_cast<int>(_playersReady.size()))) {
+        Logger::getInstance().log("Failed to load level 1", LogLevel::ERROR_L,
+                                  "Game");
+    }
+
+    Logger::getInstance().log("Room " + std::to_string(_roomId) +
+                                  " started with " +
+                                  std::to_string(_playersReady.size()) +
+                                  " player(s)",
+                              LogLevel::INFO_L, "Game");
+}
+
+void Room::startMatchRecording()
+{
+    // One seed per match, saved with the recording to replay it
+    _gameLoop.setRandomSeed(std::random_device{}());
+
+    const auto& config = ServerConfig::getInstance();
+    if (!config.isMatchRecordingEnabled()) {
+        return;
+    }
+
+    std::error_code error;
+    std::filesystem::create_directories(config.getMatchDirectory(), error);
+
+    // Rooms start on pool workers: Unix time, not the non-reentrant
+    // localtime()
+    std::string fileName = "match_" + std::to_string(std::time(nullptr)) +
+                           "_room" + std::to_string(_roomId) + ".rtm";
+    std::string path =
+        (std::filesystem::path(config.getMatchDirectory()) / fileName)
+            .string();
+
+    if (!_gameLoop.startRecording(path)) {
+        Logger::getInstance().log("Failed to record room " +
+                                      std::to_string(_roomId) + " to " + path,
+                                  LogLevel::WARNING_L, "Game");
+    }
+}
+
+void Room::resetMatch()
+{
+    Logger::getInstance().log("Resetting room " + std::to_string(_roomId),
+                              LogLevel::INFO_L, "Game");
+
+    _gameLoop.stop();
+    publishMatchEnd();
+    _gameLoop.clearAllEntities();
+
+    // Clients go back to their menu and must log in again
+    _members.clear();
+    _playersReady.clear();
+    _memberCount.store(0);
+    _gameStarted = false;
+    _needsReset = false;
+    _nextPlayerId = 1;
+    _score = 0;
+    _frameCounter = 0;
+    _levelTransitionTimer = 0.0f;
+}
+
+void Room::resetPlayers()
+{
+    _gameLoop.resetPlayers();
+    auto& entityManager = _gameLoop.getEntityManager();
+    auto players =
+        entityManager.getEntitiesWith<engine::Position, engine::Player,
+                                      engine::NetworkEntity, engine::Health>();
+
+    for (const auto& playerEntity : players) {
+        auto* position =
+            entityManager.getComponent<engine::Position>(playerEntity);
+        auto* health = entityManager.getComponent<engine::Health>(playerEntity);
+        auto* netEntity =
+            entityManager.getComponent<engine::NetworkEntity>(playerEntity);
+        if (!position || !health || !netEntity) {
+            continue;
+        }
+
+        for (uint32_t clientId : _members) {
+            _networkServer.sendEntityPosition(clientId, netEntity->entityId,
+                                              position->x, position->y);
+            _networkServer.sendHealthUpdate(clientId, netEntity->entityId,
+                                            health->current, health->max);
+            _networkServer.sendShieldStatus(clientId, netEntity->entityId,
+                                            false);
+        }
+        publish(NetworkMessage::createEntityPositionPacket(
+            netEntity->entityId, position->x, position->y, 0));
+        publish(NetworkMessage::createHealthUpdatePacket(
+            netEntity->entityId, health->current, health->max, 0));
+        publish(NetworkMessage::createShieldStatusPacket(netEntity->entityId,
+                                                         false, 0));
+    }
+}
+
+void Room::updateLevelTransition(float deltaTime)
+{
+    if (_levelTransitionTimer <= 0.0f) {
+        return;
+    }
+    _levelTransitionTimer -= deltaTime;
+    if (_levelTransitionTimer > 0.0f) {
+        return;
+    }
+
+    auto* waveManager = _gameLoop.getSystem<engine::WaveManager>();
+    if (waveManager &&
+        _gameLoop.startLevel(0, static_cast<int>(_playersReady.size()))) {
+        resetPlayers();
+        Logger::getInstance().log(
+            "Room " + std::to_string(_roomId) + " started level " +
+                std::to_string(waveManager->getCurrentLevelId()),
+            LogLevel::INFO_L, "Game");
+    } else {
+        Logger::getInstance().log("Room " + std::to_string(_roomId) +
+                                      ": no more levels. Game complete!",
+                                  LogLevel::INFO_L, "Game");
+    }
+}
+
+void Room::sendEntityUpdates()
+{
+    _entityUpdates.clear();
+    _gameLoop.popEntityUpdates(_entityUpdates);
+
+    for (const auto& update : _entityUpdates) {
+        if (update.destroyed && rules::isEnemy(update.entityType) &&
+            update.killedByPlayer) {
+            _score += rules::getScoreForEnemy(update.entityType);
+        }
+
+        for (uint32_t clientId : _members) {
+            if (update.spawned) {
+                _networkServer.sendEntitySpawn(clientId, update.entityId,
+                                               update.entityType, update.x,
+                                               update.y);
+            } else if (update.destroyed) {
+                _networkServer.sendEntityDead(clientId, update.entityId);
+                if (rules::isEnemy(update.entityType) &&
+                    update.killedByPlayer) {
+                    _networkServer.sendScoreUpdate(clientId, _score);
+                }
+            } else {
+                _networkServer.sendEntityPosition(clientId, update.entityId,
+                                                  update.x, update.y);
+            }
+        }
+        publishEntityUpdate(update);
+    }
+}
+
+void Room::sendInputAcks()
+{
+    _inputAcks.clear();
+    _gameLoop.popInputAcks(_inputAcks);
+    for (const auto& ack : _inputAcks) {
+        _networkServer.sendInputAck(ack.clientId, ack.sequenceId, ack.x, ack.y);
+    }
+}
+
+void Room::sendHealthUpdates()
+{
+    std::vector<std::tuple<uint32_t, float, float>> healthUpdates;
+    _gameLoop.getAllHealthUpdates(healthUpdates);
+
+    for (const auto& [entityId, currentHP, maxHP] : healthUpdates) {
+        for (uint32_t clientId : _members) {
+            _networkServer.sendHealthUpdate(clientId, entityId, currentHP,
+                                            maxHP);
+        }
+        publish(NetworkMessage::createHealthUpdatePacket(entityId, currentHP,
+                                                         maxHP, 0));
+    }
+}
+
+void Room::sendShieldUpdates()
+{
+    auto& entityManager = _gameLoop.getEntityManager();
+    auto players =
+        entityManager.getEntitiesWith<engine::Position, engine::Player,
+                                      engine::NetworkEntity>();
+
+    for (const auto& playerEntity : players) {
+        auto* netEntity =
+            entityManager.getComponent<engine::NetworkEntity>(playerEntity);
+        if (!netEntity) {
+            continue;
+        }
+        auto* shield = entityManager.getComponent<engine::Shield>(playerEntity);
+        bool hasShield = (shield != nullptr && shield->active);
+        for (uint32_t clientId : _members) {
+            _networkServer.sendShieldStatus(clientId, netEntity->entityId,
+                                            hasShield);
+        }
+        publish(NetworkMessage::createShieldStatusPacket(netEntity->entityId,
+                                                         hasShield, 0));
+    }
+}
+
+void Room::sendGameEvent(uint8_t eventType, uint8_t waveNumber,
+                         uint8_t totalWaves, uint8_t levelId)
+{
+    for (uint32_t clientId : _members) {
+        _networkServer.sendGameEvent(clientId, eventType, waveNumber,
+                                     totalWaves, levelId);
+    }
+    publish(NetworkMessage::createGameEventPacket(eventType, waveNumber,
+                                                  totalWaves, levelId, 0));
+}
+
+void Room::publishEntityUpdate(const engine::EntityStateUpdate& update)
+{
+    if (update.spawned) {
+        publish(NetworkMessage::createEntitySpawnPacket(
+            update.entityId, update.entityType, update.x, update.y, 0));
+    } else if (update.destroyed) {
+        publish(NetworkMessage::createEntityDeadPacket(update.entityId, 0));
+        if (rules::isEnemy(update.entityType) && update.killedByPlayer) {
+            publish(NetworkMessage::createScoreUpdatePacket(_score, 0));
+        }
+    } else {
+        publish(NetworkMessage::createEntityPositionPacket(
+            update.entityId, update.x, update.y, 0));
+    }
+}
+
+void Room::publishMatchEnd()
+{
+    // Spectators stay across matches: clear the field they are watching
+    std::vector<engine::EntityStateUpdate> entities;
+    _gameLoop.getAllEntities(entities);
+    for (const auto& entity : entities) {
+        publish(NetworkMessage::createEntityDeadPacket(entity.entityId, 0));
+    }
+    publish(NetworkMessage::createScoreUpdatePacket(0, 0));
+}
+
+}  // namespace rtype
@@ -0,0 +1,152 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Room
+*/
+
+#pragma once
+
+#include <atomic>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "engine/system/GameLoop.hpp"
+#include "engine/threading/ThreadSafeQueue.hpp"
+#include "network/NetworkServer.hpp"
+
+namespace rtype {
+
+/**
+ * @brief One independent match hosted by a RoomManager
+ *
+ * A room owns its own GameLoop world and lobby, and only talks to the
+ * clients that logged into it. It has no thread of its own: the RoomManager
+ * calls tick() once per frame from one of its pool workers.
+ *
+ * Network callbacks run on the manager thread and only enqueue events;
+ * all room state is otherwise touched from tick() alone.
+ */
+class Room {
+   private:
+    struct RoomEvent {
+        enum class Type { Login, Disconnect };
+
+        Type type;
+        uint32_t clientId;
+        std::string username;
+    };
+
+    uint16_t _roomId;
+    NetworkServer& _networkServer;
+    engine::GameLoop _gameLoop;
+    engine::ThreadSafeQueue<RoomEvent> _events;
+
+    std::vector<uint32_t> _members;  ///< Logged-in clients receiving updates
+    std::unordered_map<uint32_t, bool> _playersReady;  ///< Members alive
+    std::atomic<int> _memberCount{0};
+
+    bool _gameStarted = false;
+    bool _needsReset = false;
+    uint32_t _nextPlayerId = 1;
+    uint32_t _score = 0;
+    uint32_t _frameCounter = 0;
+    float _levelTransitionTimer = 0.0f;
+    float _idleTime = 0.0f;
+    std::vector<engine::EntityStateUpdate> _entityUpdates;
+    std::vector<engine::InputAck> _inputAcks;
+
+    int _maxPlayers;
+
+    static constexpr int MIN_PLAYERS_TO_START = 1;
+    static constexpr float LEVEL_TRANSITION_DELAY = 3.0f;
+
+    void processEvents();
+    void onClientLogin(uint32_t clientId, const std::string& username);
+    void onClientDisconnected(uint32_t clientId);
+    void onPlayerDeath(uint32_t clientId);
+
+    void startMatch();
+    void startMatchRecording();
+    void resetMatch();
+    void resetPlayers();
+    void updateLevelTransition(float deltaTime);
+    void sendEntityUpdates();
+    void sendInputAcks();
+    void sendHealthUpdates();
+    void sendShieldUpdates();
+    void sendGameEvent(uint8_t eventType, uint8_t waveNumber,
+                       uint8_t totalWaves, uint8_t levelId);
+    void publishEntityUpdate(const engine::EntityStateUpdate& update);
+    void publishMatchEnd();
+
+    /**
+     * @brief Queue a packet for the room's spectators
+     */
+    template <typename Packet>
+    void publish(const Packet& packet)
+    {
+        _networkServer.publishToSpectators(_roomId, packet);
+    }
+
+   public:
+    /**
+     * @brief Create an empty room
+     * @param roomId Room identifier sent by clients in their LoginPacket
+     * @param networkServer Shared server used to reach the room's members
+     * @param maxPlayers Maximum players in this room
+     * @param powerUpsEnabled Whether enemies may drop power-ups
+     * @param friendlyFireEnabled Whether players can hurt each other
+     * @param targetFPS Simulation rate the room is ticked at
+     */
+    Room(uint16_t roomId, NetworkServer& networkServer, int maxPlayers,
+         bool powerUpsEnabled, bool friendlyFireEnabled,
+         float targetFPS = 60.0f);
+    ~Room();
+
+    Room(const Room&) = delete;
+    Room& operator=(const Room&) = delete;
+
+    /**
+     * @brief Get the room identifier
+     */
+    uint16_t getId() const { return _roomId; }
+
+    /**
+     * @brief Queue a login for the next tick (thread-safe)
+     */
+    void queueLogin(uint32_t clientId, const std::string& username);
+
+    /**
+     * @brief Queue a disconnect for the next tick (thread-safe)
+     */
+    void queueDisconnect(uint32_t clientId);
+
+    /**
+     * @brief Forward a client input to the room's game loop (thread-safe)
+     */
+    void queueInput(uint32_t clientId, uint8_t inputMask,
+                    uint32_t sequenceId = 0);
+
+    /**
+     * @brief Advance the room by one frame
+     * @param deltaTime Elapsed time since the previous tick (seconds)
+     * @note Never called concurrently for the same room
+     */
+    void tick(float deltaTime);
+
+    /**
+     * @brief Get the number of clients currently in the room (thread-safe)
+     */
+    int getMemberCount() const { return _memberCount.load(); }
+
+    /**
+     * @brief Check whether the room has been empty for a while
+     * @param timeoutSeconds How long the lobby must have stayed empty
+     * @note Only call between ticks
+     */
+    bool isIdle(float timeoutSeconds) const;
+};
+
+}  // namespace rtype
@@ -0,0 +1,250 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** RoomManager
+*/
+
+#include "RoomManager.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <thread>
+
+#include "../common/utils/Logger.hpp"
+#include "ServerConfig.hpp"
+
+namespace rtype {
+
+namespace {
+
+size_t resolveWorkerCount(size_t workerThreads)
+{
+    if (workerThreads > 0) {
+        return workerThreads;
+    }
+    unsigned int hardware = std::thread::hardware_concurrency();
+    return hardware > 1 ? hardware - 1 : 0;
+}
+
+}  // namespace
+
+RoomManager::RoomManager(size_t maxRooms, size_t workerThreads,
+                         float targetFPS, uint32_t timeoutSeconds)
+    : _networkServer(timeoutSeconds),
+      _workers(resolveWorkerCount(workerThreads)),
+      _maxRooms(maxRooms > 0 ? maxRooms : 1),
+      _targetFPS(targetFPS),
+      _maxPlayers(ServerConfig::getInstance().getMaxPlayers()),
+      _powerUpsEnabled(ServerConfig::getInstance().isPowerUpsEnabled()),
+      _friendlyFireEnabled(ServerConfig::getInstance().isFriendlyFireEnabled())
+{
+    Logger::getInstance().log(
+        "Room config: maxRooms=" + std::to_string(_maxRooms) +
+            ", workers=" + std::to_string(_workers.getThreadCount() + 1) +
+            ", maxPlayers=" + std::to_string(_maxPlayers),
+        LogLevel::INFO_L, "Config");
+
+    _networkServer.setReceiveThreads(static_cast<size_t>(
+        ServerConfig::getInstance().getReceiveThreads()));
+    _networkServer.setBatchedSend(
+        ServerConfig::getInstance().isBatchedSendEnabled());
+    _networkServer.setSpectators(
+        static_cast<size_t>(ServerConfig::getInstance().getMaxSpectators()),
+        ServerConfig::getInstance().getSpectatorDelay());
+
+    setupNetworkCallbacks();
+}
+
+RoomManager::~RoomManager()
+{
+    stop();
+    _rooms.clear();
+}
+
+void RoomManager::setupNetworkCallbacks()
+{
+    _networkServer.setOnClientDisconnectedCallback(
+        [this](uint32_t clientId) { onClientDisconnected(clientId); });
+
+    _networkServer.setOnClientLoginCallback(
+        [this](uint32_t clientId, const LoginPacket& packet) {
+            onClientLogin(clientId, packet);
+        });
+
+    _networkServer.setOnClientInputCallback(
+        [this](uint32_t clientId, const InputPacket& packet) {
+            onClientInput(clientId, packet);
+        });
+}
+
+void RoomManager::onClientLogin(uint32_t clientId, const LoginPacket& packet)
+{
+    uint16_t roomId = _singleRoom ? 0 : packet.roomId;
+
+    auto previous = _clientRooms.find(clientId);
+    if (previous != _clientRooms.end() && previous->second != roomId) {
+        auto oldRoom = _rooms.find(previous->second);
+        if (oldRoom != _rooms.end()) {
+            oldRoom->second->queueDisconnect(clientId);
+        }
+        _clientRooms.erase(previous);
+    }
+
+    Room* room = getOrCreateRoom(roomId);
+    if (!room) {
+        Logger::getInstance().log(
+            "Room limit reached! Rejecting client " + std::to_string(clientId),
+            LogLevel::WARNING_L, "Lobby");
+        _networkServer.sendLoginRejected(
+            clientId, static_cast<uint8_t>(RejectReason::SERVER_FULL));
+        return;
+    }
+
+    _clientRooms[clientId] = roomId;
+    room->queueLogin(clientId,
+                     std::string(packet.username,
+                                 strnlen(packet.username,
+                                         sizeof(packet.username))));
+}
+
+void RoomManager::onClientInput(uint32_t clientId, const InputPacket& packet)
+{
+    auto it = _clientRooms.find(clientId);
+    if (it == _clientRooms.end()) {
+        return;
+    }
+    auto room = _rooms.find(it->second);
+    if (room != _rooms.end()) {
+        room->second->queueInput(clientId, packet.inputMask,
+                                 packet.header.sequenceId);
+    }
+}
+
+void RoomManager::onClientDisconnected(uint32_t clientId)
+{
+    auto it = _clientRooms.find(clientId);
+    if (it == _clientRooms.end()) {
+        return;
+    }
+    auto room = _rooms.find(it->second);
+    if (room != _rooms.end()) {
+        room->second->queueDisconnect(clientId);
+    }
+    _clientRooms.erase(it);
+}
+
+Room* RoomManager::getOrCreateRoom(uint16_t roomId)
+{
+    auto it = _rooms.find(roomId);
+    if (it != _rooms.end()) {
+        return it->second.get();
+    }
+    if (_rooms.size() >= _maxRooms) {
+        return nullptr;
+    }
+
+    auto room =
+        std::make_unique<Room>(roomId, _networkServer, _maxPlayers,
+                               _powerUpsEnabled, _friendlyFireEnabled,
+                               _targetFPS);
+    Room* roomPtr = room.get();
+    _rooms.emplace(roomId, std::move(room));
+    _roomCount.store(_rooms.size());
+
+    Logger::getInstance().log("Created room " + std::to_string(roomId) + " (" +
+                                  std::to_string(_rooms.size()) + "/" +
+                                  std::to_string(_maxRooms) + ")",
+                              LogLevel::INFO_L, "Rooms");
+    return roomPtr;
+}
+
+void RoomManager::reapIdleRooms()
+{
+    for (auto it = _rooms.begin(); it != _rooms.end();) {
+        if (!it->second->isIdle(ROOM_IDLE_TIMEOUT)) {
+            ++it;
+            continue;
+        }
+
+        uint16_t roomId = it->first;
+        for (auto client = _clientRooms.begin();
+             client != _clientRooms.end();) {
+            client = client->second == roomId ? _clientRooms.erase(client)
+                                              : std::next(client);
+        }
+        it = _rooms.erase(it);
+
+        Logger::getInstance().log("Closed idle room " + std::to_string(roomId),
+                                  LogLevel::INFO_L, "Rooms");
+    }
+    _roomCount.store(_rooms.size());
+}
+
+bool RoomManager::start(uint16_t port)
+{
+    if (!_networkServer.start(port)) {
+        Logger::getInstance().log(
+            "Failed to start server on port " + std::to_string(port),
+            LogLevel::ERROR_L, "Error");
+        return false;
+    }
+    _running = true;
+
+    Logger::getInstance().log("Room server started on port " +
+                                  std::to_string(port) + " (up to " +
+                                  std::to_string(_maxRooms) + " rooms)",
+                              LogLevel::INFO_L, "Network");
+    return true;
+}
+
+void RoomManager::run()
+{
+    const auto targetFrameTime =
+        std::chrono::duration<float>(1.0f / _targetFPS);
+    auto lastFrame = std::chrono::steady_clock::now();
+
+    while (_running && _networkServer.isRunning()) {
+        auto frameStart = std::chrono::steady_clock::now();
+        float deltaTime =
+            std::chrono::duration<float>(frameStart - lastFrame).count();
+        lastFrame = frameStart;
+
+        try {
+            _networkServer.update();
+
+            _tickList.clear();
+            for (auto& [roomId, room] : _rooms) {
+                _tickList.push_back(room.get());
+            }
+            _workers.parallelFor(_tickList.size(), [this, deltaTime](size_t i) {
+                _tickList[i]->tick(deltaTime);
+            });
+
+            reapIdleRooms();
+            _networkServer.flush();
+        } catch (const std::exception& e) {
+            Logger::getInstance().log(
+                "Error in room loop: " + std::string(e.what()),
+                LogLevel::ERROR_L, "RoomManager");
+        }
+
+        auto frameTime = std::chrono::steady_clock::now() - frameStart;
+        if (frameTime < targetFrameTime) {
+            std::this_thread::sleep_for(targetFrameTime - frameTime);
+        }
+    }
+}
+
+void RoomManager::stop()
+{
+    _running = false;
+    _networkServer.stop();
+}
+
+bool RoomManager::isRunning() const
+{
+    return _running && _networkServer.isRunning();
+}
+
+}  // namespace rtype
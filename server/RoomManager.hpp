@@ -0,0 +1,91 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** RoomManager
+*/
+
+#pragma once
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "Room.hpp"
+#include "engine/threading/WorkerPool.hpp"
+#include "network/NetworkServer.hpp"
+
+namespace rtype {
+
+/**
+ * @brief Hosts many independent matches behind a single UDP port
+ *
+ * Clients pick a room with LoginPacket::roomId. Rooms are created on first
+ * login (up to maxRooms) and dropped after staying empty for a while. Every
+ * frame the manager pumps the network, ticks all rooms across a fixed worker
+ * pool, then flushes batched egress once for all rooms.
+ */
+class RoomManager {
+   private:
+    NetworkServer _networkServer;
+    engine::WorkerPool _workers;
+
+    std::map<uint16_t, std::unique_ptr<Room>> _rooms;
+    std::vector<Room*> _tickList;
+    std::unordered_map<uint32_t, uint16_t> _clientRooms;
+    std::atomic<size_t> _roomCount{0};
+    std::atomic<bool> _running{false};
+
+    size_t _maxRooms;
+    bool _singleRoom = false;
+    float _targetFPS;
+    int _maxPlayers;
+    bool _powerUpsEnabled;
+    bool _friendlyFireEnabled;
+
+    static constexpr float ROOM_IDLE_TIMEOUT = 10.0f;
+    static constexpr uint16_t DEFAULT_PORT = 8080;
+
+    void setupNetworkCallbacks();
+    void onClientLogin(uint32_t clientId, const LoginPacket& packet);
+    void onClientInput(uint32_t clientId, const InputPacket& packet);
+    void onClientDisconnected(uint32_t clientId);
+
+    Room* getOrCreateRoom(uint16_t roomId);
+    void reapIdleRooms();
+
+   public:
+    /**
+     * @brief Create the manager
+     * @param maxRooms Maximum number of concurrent rooms
+     * @param workerThreads Room worker threads (0 = hardware concurrency - 1)
+     * @param targetFPS Simulation rate of every room
+     * @param timeoutSeconds Client inactivity timeout
+     */
+    RoomManager(size_t maxRooms, size_t workerThreads, float targetFPS = 60.0f,
+                uint32_t timeoutSeconds = 30);
+    ~RoomManager();
+
+    bool start(uint16_t port = DEFAULT_PORT);
+    void run();
+    void stop();
+
+    bool isRunning() const;
+
+    /**
+     * @brief Send every login to room 0, whatever room it asks for
+     *
+     * Single-match mode (GameServer): all clients share one match.
+     * @note Call before start()
+     */
+    void setSingleRoom(bool singleRoom) { _singleRoom = singleRoom; }
+
+    /**
+     * @brief Get the number of live rooms (thread-safe)
+     */
+    size_t getRoomCount() const { return _roomCount.load(); }
+};
+
+}  // namespace rtype
@@ -62,6 +62,50 @@ bool ServerConfig::load(const std::string& filepath)
                 _settings.maxPlayers = std::stoi(value);
                 if (_settings.maxPlayers < 1) _settings.maxPlayers = 1;
                 if (_settings.maxPlayers > 4) _settings.maxPlayers = 4;
+            } else if (key == "receiveThreads") {
+                _settings.receiveThreads = std::stoi(value);
+                if (_settings.receiveThreads < 1) _settings.receiveThreads = 1;
+                if (_settings.receiveThreads > 16)
+                    _settings.receiveThreads = 16;
+            } else if (key == "batchedSend") {
+                _settings.batchedSend = std::stoi(value);
+            } else if (key == "maxRooms") {
+                _settings.maxRooms = std::stoi(value);
+                if (_settings.maxRooms < 0) _settings.maxRooms = 0;
+                if (_settings.maxRooms > 1024) _settings.maxRooms = 1024;
+            } else if (key == "roomWorkers") {
+                _settings.roomWorkers = std::stoi(value);
+                if (_settings.roomWorkers < 0) _settings.roomWorkers = 0;
+                if (_settings.roomWorkers > 64) _settings.roomWorkers = 64;
+            } else if (key == "lagCompensationMs") {
+                _settings.lagCompensationMs = std::stoi(value);
+                if (_settings.lagCompensationMs < 0)
+                    _settings.lagCompensationMs = 0;
+                if (_settings.lagCompensationMs > 500)
+                    _settings.lagCompensationMs = 500;
+            } else if (key == "recordMatches") {
+                _settings.recordMatches = std::stoi(value);
+            } else if (key == "matchDirectory") {
+                _settings.matchDirectory = value;
+            } else if (key == "maxSpectators") {
+                _settings.maxSpectators = std::stoi(value);
+                if (_settings.maxSpectators < 0) _settings.maxSpectators = 0;
+                if (_settings.maxSpectators > 4096)
+                    _settings.maxSpectators = 4096;
+            } else if (key == "spectatorDelayMs") {
+                _settings.spectatorDelayMs = std::stoi(value);
+                if (_settings.spectatorDelayMs < 0)
+                    _settings.spectatorDelayMs = 0;
+                if (_settings.spectatorDelayMs > 60000)
+                    _settings.spectatorDelayMs = 60000;
+            } else if (key == "relayHost") {
+                _settings.relayHost = value;
+            } else if (key == "relayPort") {
+                _settings.relayPort = static_cast<uint16_t>(std::stoi(value));
+            } else if (key == "relayRoom") {
+                _settings.relayRoom = std::stoi(value);
+                if (_settings.relayRoom < 0) _settings.relayRoom = 0;
+                if (_settings.relayRoom > 65535) _settings.relayRoom = 65535;
             }
         } catch (const std::exception& e) {
             Logger::getInstance().log("Error parsing " + key + ": " + e.what(),
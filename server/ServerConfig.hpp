@@ -22,6 +22,18 @@ struct ServerSettings {
     int powerUps = 1;
     int friendlyFire = 0;
     int maxPlayers = 4;
+    int receiveThreads = 1;
+    int batchedSend = 0;
+    int maxRooms = 0;
+    int roomWorkers = 0;
+    int lagCompensationMs = 150;
+    int recordMatches = 0;
+    std::string matchDirectory = "matches";
+    int maxSpectators = 0;
+    int spectatorDelayMs = 2000;
+    std::string relayHost;
+    uint16_t relayPort = 8080;
+    int relayRoom = 0;
 };
 
 class ServerConfig {
@@ -63,6 +75,86 @@ class ServerConfig {
      */
     int getMaxPlayers() const { return _settings.maxPlayers; }
 
+    /**
+     * @brief Get number of network receive threads
+     */
+    int getReceiveThreads() const { return _settings.receiveThreads; }
+
+    /**
+     * @brief Get batched (sendmmsg) egress status
+     */
+    bool isBatchedSendEnabled() const { return _settings.batchedSend != 0; }
+
+    /**
+     * @brief Get maximum concurrent rooms (0 = single-match server)
+     */
+    int getMaxRooms() const { return _settings.maxRooms; }
+
+    /**
+     * @brief Get number of room worker threads (0 = auto)
+     */
+    int getRoomWorkers() const { return _settings.roomWorkers; }
+
+    /**
+     * @brief Get the longest hit detection rewind in seconds (0 = disabled)
+     */
+    float getLagCompensationWindow() const
+    {
+        return static_cast<float>(_settings.lagCompensationMs) / 1000.0f;
+    }
+
+    /**
+     * @brief Get whether matches are recorded for r-type_resim
+     */
+    bool isMatchRecordingEnabled() const
+    {
+        return _settings.recordMatches != 0;
+    }
+
+    /**
+     * @brief Get the directory match recordings are written to
+     */
+    const std::string& getMatchDirectory() const
+    {
+        return _settings.matchDirectory;
+    }
+
+    /**
+     * @brief Get the spectators accepted across all rooms (0 = disabled)
+     */
+    int getMaxSpectators() const { return _settings.maxSpectators; }
+
+    /**
+     * @brief Get how far behind the match spectators are, in seconds
+     */
+    float getSpectatorDelay() const
+    {
+        return static_cast<float>(_settings.spectatorDelayMs) / 1000.0f;
+    }
+
+    /**
+     * @brief Get whether the server relays another server's spectators
+     */
+    bool isRelayEnabled() const { return !_settings.relayHost.empty(); }
+
+    /**
+     * @brief Get the server whose spectator stream is relayed
+     */
+    const std::string& getRelayHost() const { return _settings.relayHost; }
+
+    /**
+     * @brief Get the port of the relayed server
+     */
+    uint16_t getRelayPort() const { return _settings.relayPort; }
+
+    /**
+     * @brief Get the room watched on the relayed server
+     */
+    uint16_t getRelayRoom() const
+    {
+        return static_cast<uint16_t>(_settings.relayRoom);
+    }
+
    private:
     ServerConfig() = default;
     ~ServerConfig() = default;
@@ -0,0 +1,216 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** SpectatorRelay
+*/
+
+#include "SpectatorRelay.hpp"
+
+#include <cstring>
+#include <thread>
+
+#include "../common/network/NetworkMessage.hpp"
+#include "../common/utils/Logger.hpp"
+#include "common/replay/ReplayFormat.hpp"
+
+namespace rtype {
+
+SpectatorRelay::SpectatorRelay(const std::string& upstreamHost,
+                               uint16_t upstreamPort, uint16_t upstreamRoom,
+                               size_t maxSpectators, uint32_t timeoutSeconds)
+    : _networkServer(timeoutSeconds),
+      _upstream(_ioContext),
+      _upstreamHost(upstreamHost),
+      _upstreamPort(upstreamPort),
+      _upstreamRoom(upstreamRoom),
+      _maxSpectators(maxSpectators)
+{
+    // The upstream server already delayed the stream
+    _networkServer.setSpectators(_maxSpectators, 0.0f);
+
+    _networkServer.setOnClientLoginCallback(
+        [this](uint32_t clientId, const LoginPacket&) {
+            _networkServer.sendLoginRejected(
+                clientId, static_cast<uint8_t>(RejectReason::SERVER_FULL));
+        });
+}
+
+SpectatorRelay::~SpectatorRelay()
+{
+    stop();
+    boost::system::error_code error;
+    _upstream.close(error);
+}
+
+bool SpectatorRelay::start(uint16_t port)
+{
+    if (_maxSpectators == 0) {
+        Logger::getInstance().log(
+            "Relay mode needs maxSpectators > 0 in settings.json",
+            LogLevel::ERROR_L, "Relay");
+        return false;
+    }
+
+    try {
+        boost::asio::ip::udp::resolver resolver(_ioContext);
+        _upstreamEndpoint = *resolver
+                                 .resolve(boost::asio::ip::udp::v4(),
+                                          _upstreamHost,
+                                          std::to_string(_upstreamPort))
+                                 .begin();
+        _upstream.open(boost::asio::ip::udp::v4());
+        _upstream.non_blocking(true);
+    } catch (const std::exception& e) {
+        Logger::getInstance().log("Cannot reach " + _upstreamHost + ":" +
+                                      std::to_string(_upstreamPort) + ": " +
+                                      e.what(),
+                                  LogLevel::ERROR_L, "Relay");
+        return false;
+    }
+
+    if (!_networkServer.start(port)) {
+        Logger::getInstance().log(
+            "Failed to start relay on port " + std::to_string(port),
+            LogLevel::ERROR_L, "Error");
+        _upstream.close();
+        return false;
+    }
+    _running = true;
+
+    Logger::getInstance().log(
+        "Relaying room " + std::to_string(_upstreamRoom) + " of " +
+            _upstreamEndpoint.address().to_string() + ":" +
+            std::to_string(_upstreamPort) + " on port " +
+            std::to_string(port) + " (up to " +
+            std::to_string(_maxSpectators) + " spectators)",
+        LogLevel::INFO_L, "Relay");
+
+    requestStream();
+    _lastReceived = std::chrono::steady_clock::now();
+    return true;
+}
+
+void SpectatorRelay::run()
+{
+    const auto frameTime = std::chrono::milliseconds(16);
+
+    while (_running && _networkServer.isRunning()) {
+        auto frameStart = std::chrono::steady_clock::now();
+
+        try {
+            receiveUpstream();
+
+            if (frameStart - _lastRequest >= REQUEST_INTERVAL) {
+                requestStream();
+            }
+            if (_upstreamLive &&
+                frameStart - _lastReceived >= UPSTREAM_SILENCE) {
+                _upstreamLive = false;
+                Logger::getInstance().log(
+                    "Upstream server went silent, still asking for its "
+                    "stream",
+                    LogLevel::WARNING_L, "Relay");
+            }
+
+            _networkServer.update();
+        } catch (const std::exception& e) {
+            Logger::getInstance().log(
+                "Error in relay loop: " + std::string(e.what()),
+                LogLevel::ERROR_L, "Relay");
+        }
+
+        auto elapsed = std::chrono::steady_clock::now() - frameStart;
+        if (elapsed < frameTime) {
+            std::this_thread::sleep_for(frameTime - elapsed);
+        }
+    }
+
+    // Free our spectator slot upstream instead of waiting for the timeout
+    boost::system::error_code error;
+    Header disconnect = NetworkMessage::createDisconnectPacket(0);
+    _upstream.send_to(boost::asio::buffer(&disconnect, sizeof(disconnect)),
+                      _upstreamEndpoint, 0, error);
+}
+
+void SpectatorRelay::stop()
+{
+    _running = false;
+    _networkServer.stop();
+}
+
+bool SpectatorRelay::isRunning() const
+{
+    return _running && _networkServer.isRunning();
+}
+
+void SpectatorRelay::requestStream()
+{
+    // Also keeps the upstream session alive: spectators send nothing else
+    SpectatePacket request =
+        NetworkMessage::createSpectatePacket(_upstreamRoom, 0);
+    boost::system::error_code error;
+    _upstream.send_to(boost::asio::buffer(&request, sizeof(request)),
+                      _upstreamEndpoint, 0, error);
+    _lastRequest = std::chrono::steady_clock::now();
+}
+
+void SpectatorRelay::receiveUpstream()
+{
+    boost::asio::ip::udp::endpoint sender;
+    boost::system::error_code error;
+
+    while (true) {
+        size_t size = _upstream.receive_from(
+            boost::asio::buffer(_receiveBuffer), sender, 0, error);
+        if (error == boost::asio::error::would_block) {
+            return;
+        }
+        if (error) {
+            // ICMP port unreachable while upstream is down: retry later
+            return;
+        }
+        if (sender == _upstreamEndpoint) {
+            handleUpstreamPacket(_receiveBuffer.data(), size);
+        }
+    }
+}
+
+void SpectatorRelay::handleUpstreamPacket(const uint8_t* data, size_t size)
+{
+    if (size < sizeof(Header)) {
+        return;
+    }
+    Header header;
+    std::memcpy(&header, data, sizeof(header));
+
+    if (header.opCode == S2C_LOGIN_REJECTED) {
+        Logger::getInstance().log(
+            "Upstream server refused the relay (spectators disabled or "
+            "full)",
+            LogLevel::WARNING_L, "Relay");
+        return;
+    }
+    if (header.opCode != S2C_SPECTATE_BATCH ||
+        header.packetSize < sizeof(SpectateBatchPacket) ||
+        header.packetSize > size) {
+        return;
+    }
+
+    if (!_upstreamLive) {
+        _upstreamLive = true;
+        Logger::getInstance().log("Receiving the upstream stream",
+                                  LogLevel::INFO_L, "Relay");
+    }
+    _lastReceived = std::chrono::steady_clock::now();
+
+    replay::forEachKeyframePacket(
+        data + sizeof(SpectateBatchPacket),
+        header.packetSize - sizeof(SpectateBatchPacket),
+        [this](const uint8_t* packet, size_t packetSize) {
+            _networkServer.publishToSpectators(0, packet, packetSize);
+            _relayedPackets++;
+        });
+}
+
+}  // namespace rtype
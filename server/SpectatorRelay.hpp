@@ -0,0 +1,103 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** SpectatorRelay
+*/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <boost/asio.hpp>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+#include "network/NetworkServer.hpp"
+
+namespace rtype {
+
+/**
+ * @brief Re-broadcasts another server's spectator stream
+ *
+ * The relay watches one room of an upstream server as a single spectator
+ * and publishes everything it receives to its own spectators, as room 0.
+ * One match can then be watched by many viewers spread over several relays
+ * while the game host only ever sends its stream once per relay. Relays can
+ * be chained. The upstream stream is already delayed, so a relay only adds
+ * its batching interval.
+ *
+ * A relay hosts no match: player logins are rejected.
+ */
+class SpectatorRelay {
+   private:
+    NetworkServer _networkServer;
+
+    boost::asio::io_context _ioContext;
+    boost::asio::ip::udp::socket _upstream;
+    boost::asio::ip::udp::endpoint _upstreamEndpoint;
+    std::array<uint8_t, PacketBufferPool::BUFFER_SIZE> _receiveBuffer;
+
+    std::string _upstreamHost;
+    uint16_t _upstreamPort;
+    uint16_t _upstreamRoom;
+    size_t _maxSpectators;
+
+    std::atomic<bool> _running{false};
+    std::atomic<uint64_t> _relayedPackets{0};
+    bool _upstreamLive = false;
+    std::chrono::steady_clock::time_point _lastRequest;
+    std::chrono::steady_clock::time_point _lastReceived;
+
+    /// Well under the upstream inactivity timeout
+    static constexpr std::chrono::seconds REQUEST_INTERVAL{2};
+    static constexpr std::chrono::seconds UPSTREAM_SILENCE{10};
+    static constexpr uint16_t DEFAULT_PORT = 8080;
+
+    void requestStream();
+    void receiveUpstream();
+    void handleUpstreamPacket(const uint8_t* data, size_t size);
+
+   public:
+    /**
+     * @brief Create the relay
+     * @param upstreamHost Address or host name of the watched server
+     * @param upstreamPort Port of the watched server
+     * @param upstreamRoom Room to watch on that server
+     * @param maxSpectators Spectators accepted by this relay
+     * @param timeoutSeconds Spectator inactivity timeout
+     */
+    SpectatorRelay(const std::string& upstreamHost, uint16_t upstreamPort,
+                   uint16_t upstreamRoom, size_t maxSpectators,
+                   uint32_t timeoutSeconds = 30);
+    ~SpectatorRelay();
+
+    SpectatorRelay(const SpectatorRelay&) = delete;
+    SpectatorRelay& operator=(const SpectatorRelay&) = delete;
+
+    /**
+     * @brief Resolve the upstream server and start accepting spectators
+     * @return false if the host cannot be resolved or the port is taken
+     */
+    bool start(uint16_t port = DEFAULT_PORT);
+    void run();
+    void stop();
+
+    bool isRunning() const;
+
+    /**
+     * @brief Get the number of upstream packets published so far
+     */
+    uint64_t getRelayedPacketCount() const { return _relayedPackets.load(); }
+
+    /**
+     * @brief Get the number of spectators watching through this relay
+     */
+    size_t getSpectatorCount() const
+    {
+        return _networkServer.getSpectatorCount();
+    }
+};
+
+}  // namespace rtype
@@ -10,6 +10,7 @@
 #include <cstdint>
 #include <vector>
 
+#include "../../../common/network/PlayerMovement.hpp"
 #include "Component.hpp"
 #include "EntityType.hpp"
 
@@ -43,6 +44,8 @@ struct Player : public ComponentBase<Player> {
     uint32_t playerId;               // Game player ID
     float shootCooldown;             // Time until next shot
     const float shootDelay = 0.25f;  // Minimum time between shots
+    float viewLatency = 0.0f;  // How far behind the server the client sees (s)
+    float inputCredit = 0.0f;  // Inputs the client may still apply this tick
 
     Player(uint32_t clientId_ = 0, uint32_t playerId_ = 0);
 };
@@ -163,8 +166,10 @@ struct SpeedBoost : public ComponentBase<SpeedBoost> {
     float duration;
     float boostedSpeed;
 
-    SpeedBoost(float dur = 5.0f, float speedMultiplier = 1.5f)
-        : duration(dur), boostedSpeed(300.0f * speedMultiplier)
+    SpeedBoost(float dur = 5.0f,
+               float speedMultiplier = PlayerMovement::SPEED_BOOST_MULTIPLIER)
+        : duration(dur),
+          boostedSpeed(PlayerMovement::BASE_SPEED * speedMultiplier)
     {
     }
 };
@@ -20,6 +20,12 @@ GameEntityFactory::GameEntityFactory(EntityManager& entityManager)
 {
 }
 
+void GameEntityFactory::resetIds()
+{
+    _nextEnemyId = 50000;
+    _nextBulletId = 10000;
+}
+
 Entity GameEntityFactory::createPlayer(uint32_t clientId, uint32_t playerId,
                                        float x, float y)
 {
@@ -480,6 +486,8 @@ Entity GameEntityFactory::createExplosion(EntityId ownerId, const Position& pos)
 
     _entityManager.addComponent(explosion, Position(pos.x, pos.y));
     _entityManager.addComponent(explosion, Velocity(0.0f, 0.0f));
+    // Clients only play an effect for it; the spawn is all they need
+    _entityManager.addComponent(explosion, Lifetime(0.5f));
     _entityManager.addComponent(explosion, NetworkEntity(_nextBulletId++, 7));
 
     auto* netEntity = _entityManager.getComponent<NetworkEntity>(explosion);
@@ -92,6 +92,11 @@ class GameEntityFactory {
      */
     uint32_t getNextEnemyId() { return _nextEnemyId++; }
 
+    /**
+     * @brief Restart network IDs from their first values (between matches)
+     */
+    void resetIds();
+
     /**
      * @brief Create a boss entity with multiple parts
      * @param bossType Boss variant/type
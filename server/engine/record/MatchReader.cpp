@@ -0,0 +1,165 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** MatchReader
+*/
+
+#include "MatchReader.hpp"
+
+#include "../../../common/replay/Lz4Codec.hpp"
+
+namespace engine {
+
+bool MatchReader::open(const std::string& filePath)
+{
+    _file.close();
+    _file.clear();
+    _block.clear();
+    _offset = 0;
+    _lastInputs.clear();
+    _deltaTime = 0.0f;
+
+    _file.open(filePath, std::ios::binary);
+    match::MatchHeader header;
+    if (!_file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+        std::memcmp(header.magic, match::MAGIC, sizeof(header.magic)) != 0 ||
+        header.version != match::VERSION) {
+        _file.close();
+        return false;
+    }
+
+    _config.seed = header.seed;
+    _config.lagCompensationWindow = header.lagCompensationWindow;
+    _config.powerUpsEnabled = header.powerUpsEnabled != 0;
+    _config.friendlyFireEnabled = header.friendlyFireEnabled != 0;
+    _recordedAt = header.recordedAt;
+    return true;
+}
+
+bool MatchReader::loadBlock()
+{
+    match::MatchBlockHeader header;
+    if (!_file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+        header.rawSize == 0 || header.rawSize > match::MAX_BLOCK_SIZE ||
+        header.compressedSize > rtype::lz4::compressBound(header.rawSize)) {
+        return false;
+    }
+
+    _compressed.resize(header.compressedSize);
+    _block.resize(header.rawSize);
+    if (!_file.read(reinterpret_cast<char*>(_compressed.data()),
+                    header.compressedSize) ||
+        !rtype::lz4::decompress(_compressed.data(), header.compressedSize,
+                                _block.data(), _block.size())) {
+        _block.clear();
+        return false;
+    }
+    _offset = 0;
+    return true;
+}
+
+bool MatchReader::readVarint(uint32_t& value)
+{
+    value = 0;
+    for (int shift = 0; shift < 35; shift += 7) {
+        if (_offset >= _block.size()) {
+            return false;
+        }
+        uint8_t byte = _block[_offset++];
+        value |= static_cast<uint32_t>(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool MatchReader::readFloat(float& value)
+{
+    if (_block.size() - _offset < sizeof(value)) {
+        return false;
+    }
+    std::memcpy(&value, _block.data() + _offset, sizeof(value));
+    _offset += sizeof(value);
+    return true;
+}
+
+bool MatchReader::next(MatchEvent& event)
+{
+    if (!_file.is_open()) {
+        return false;
+    }
+    if (_offset >= _block.size() && !loadBlock()) {
+        _file.close();
+        return false;
+    }
+
+    uint8_t op = _block[_offset++];
+    event = MatchEvent{};
+    event.type = static_cast<match::Op>(op & match::OP_MASK);
+
+    bool valid = true;
+    uint32_t value = 0;
+    switch (event.type) {
+        case match::OP_TICK:
+            if (op & match::TICK_NEW_DELTA) {
+                valid = readFloat(_deltaTime);
+            }
+            event.deltaTime = _deltaTime;
+            break;
+        case match::OP_INPUT: {
+            valid = readVarint(event.clientId);
+            auto it = _lastInputs.find(event.clientId);
+            bool known = it != _lastInputs.end();
+            if (known) {
+                event.inputMask = it->second.inputMask;
+                event.viewLatency = it->second.viewLatency;
+                event.sequenceId = it->second.sequenceId + 1;
+            }
+            if (valid && (op & match::INPUT_NEW_MASK)) {
+                valid = readVarint(event.inputMask);
+            }
+            if (valid && (op & match::INPUT_NEW_LATENCY)) {
+                valid = readFloat(event.viewLatency);
+            }
+            if (valid && (op & match::INPUT_NEW_SEQUENCE)) {
+                valid = readVarint(event.sequenceId);
+            }
+            // A client's first input carries every field
+            constexpr uint8_t allFields = match::INPUT_NEW_MASK |
+                                          match::INPUT_NEW_LATENCY |
+                                          match::INPUT_NEW_SEQUENCE;
+            valid = valid && (known || (op & allFields) == allFields);
+            _lastInputs[event.clientId] = {event.inputMask, event.viewLatency,
+                                           event.sequenceId};
+            break;
+        }
+        case match::OP_LEAVE:
+            valid = readVarint(event.clientId);
+            break;
+        case match::OP_JOIN:
+            valid = readVarint(event.clientId) &&
+                    readVarint(event.playerId) && readFloat(event.x) &&
+                    readFloat(event.y);
+            break;
+        case match::OP_LEVEL:
+            valid = readVarint(value);
+            event.levelId = static_cast<int>(value);
+            valid = valid && readVarint(value);
+            event.playerCount = static_cast<int>(value);
+            break;
+        case match::OP_RESET_PLAYERS:
+            break;
+        default:
+            valid = false;
+            break;
+    }
+
+    if (!valid) {
+        _file.close();
+    }
+    return valid;
+}
+
+}  // namespace engine
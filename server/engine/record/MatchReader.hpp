@@ -0,0 +1,89 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** MatchReader
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "MatchRecording.hpp"
+
+namespace engine {
+
+/**
+ * @brief One decoded operation of a match recording
+ *
+ * Only the fields of its type are set; inputs come back with every field
+ * filled in, not as deltas.
+ */
+struct MatchEvent {
+    match::Op type = match::OP_TICK;
+    float deltaTime = 0.0f;  ///< TICK
+    uint32_t clientId = 0;   ///< INPUT, LEAVE, JOIN
+    uint32_t inputMask = 0;  ///< INPUT
+    float viewLatency = 0.0f;
+    uint32_t sequenceId = 0;
+    uint32_t playerId = 0;  ///< JOIN
+    float x = 0.0f;
+    float y = 0.0f;
+    int levelId = 0;  ///< LEVEL
+    int playerCount = 0;
+};
+
+/**
+ * @brief Reads a match recording one operation at a time
+ *
+ * Blocks are read and decompressed as they are reached, so memory stays
+ * bounded by one block however long the match was.
+ */
+class MatchReader {
+   public:
+    /**
+     * @brief Open a recording and read its header
+     * @return false if the file is missing or not a match recording
+     */
+    bool open(const std::string& filePath);
+
+    const MatchConfig& getConfig() const { return _config; }
+
+    /**
+     * @brief Unix time in seconds when the match was recorded
+     */
+    int64_t getRecordedAt() const { return _recordedAt; }
+
+    /**
+     * @brief Decode the next operation
+     * @return false at the end of the recording, or on the first corrupt
+     * or truncated block
+     */
+    bool next(MatchEvent& event);
+
+   private:
+    struct InputState {
+        uint32_t inputMask;
+        float viewLatency;
+        uint32_t sequenceId;
+    };
+
+    std::ifstream _file;
+    MatchConfig _config;
+    int64_t _recordedAt = 0;
+    std::vector<uint8_t> _block;
+    std::vector<uint8_t> _compressed;
+    size_t _offset = 0;
+    std::unordered_map<uint32_t, InputState> _lastInputs;
+    float _deltaTime = 0.0f;
+
+    bool loadBlock();
+    bool readVarint(uint32_t& value);
+    bool readFloat(float& value);
+};
+
+}  // namespace engine
@@ -0,0 +1,167 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** MatchRecorder
+*/
+
+#include "MatchRecorder.hpp"
+
+#include <bit>
+#include <chrono>
+
+#include "../../../common/replay/Lz4Codec.hpp"
+#include "../../../common/utils/Logger.hpp"
+
+namespace engine {
+
+MatchRecorder::~MatchRecorder() { close(); }
+
+bool MatchRecorder::open(const std::string& filePath,
+                         const MatchConfig& config)
+{
+    close();
+
+    _file.open(filePath, std::ios::binary | std::ios::trunc);
+    if (!_file.is_open()) {
+        Logger::getInstance().log(
+            "Failed to create match recording " + filePath, LogLevel::ERROR_L,
+            "MatchRecorder");
+        return false;
+    }
+
+    match::MatchHeader header{};
+    std::memcpy(header.magic, match::MAGIC, sizeof(header.magic));
+    header.version = match::VERSION;
+    header.recordedAt = static_cast<int64_t>(
+        std::chrono::system_clock::to_time_t(std::chrono::system_clock::now()));
+    header.seed = config.seed;
+    header.lagCompensationWindow = config.lagCompensationWindow;
+    header.powerUpsEnabled = config.powerUpsEnabled ? 1 : 0;
+    header.friendlyFireEnabled = config.friendlyFireEnabled ? 1 : 0;
+    _file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    _buffer.clear();
+    _buffer.reserve(match::BLOCK_SIZE + 64);
+    _lastInputs.clear();
+    _hasDeltaTime = false;
+    _tickCount = 0;
+    _bytesWritten = sizeof(header);
+    return true;
+}
+
+void MatchRecorder::close()
+{
+    if (!_file.is_open()) {
+        return;
+    }
+    flushBlock();
+    _file.close();
+}
+
+void MatchRecorder::recordTick(float deltaTime)
+{
+    uint32_t bits = std::bit_cast<uint32_t>(deltaTime);
+    if (_hasDeltaTime && bits == _deltaTimeBits) {
+        _buffer.push_back(match::OP_TICK);
+    } else {
+        _buffer.push_back(match::OP_TICK | match::TICK_NEW_DELTA);
+        match::appendFloat(_buffer, deltaTime);
+        _deltaTimeBits = bits;
+        _hasDeltaTime = true;
+    }
+    _tickCount++;
+
+    // Blocks end on a frame so a truncated file stops on a frame boundary
+    if (_buffer.size() >= match::BLOCK_SIZE) {
+        flushBlock();
+    }
+}
+
+void MatchRecorder::recordInput(uint32_t clientId, uint32_t inputMask,
+                                float viewLatency, uint32_t sequenceId)
+{
+    uint32_t latencyBits = std::bit_cast<uint32_t>(viewLatency);
+    uint8_t op = match::OP_INPUT;
+
+    auto it = _lastInputs.find(clientId);
+    if (it == _lastInputs.end()) {
+        op |= match::INPUT_NEW_MASK | match::INPUT_NEW_LATENCY |
+              match::INPUT_NEW_SEQUENCE;
+    } else {
+        const InputState& last = it->second;
+        if (inputMask != last.inputMask) {
+            op |= match::INPUT_NEW_MASK;
+        }
+        if (latencyBits != last.viewLatencyBits) {
+            op |= match::INPUT_NEW_LATENCY;
+        }
+        if (sequenceId != last.sequenceId + 1) {
+            op |= match::INPUT_NEW_SEQUENCE;
+        }
+    }
+
+    _buffer.push_back(op);
+    match::appendVarint(_buffer, clientId);
+    if (op & match::INPUT_NEW_MASK) {
+        match::appendVarint(_buffer, inputMask);
+    }
+    if (op & match::INPUT_NEW_LATENCY) {
+        match::appendFloat(_buffer, viewLatency);
+    }
+    if (op & match::INPUT_NEW_SEQUENCE) {
+        match::appendVarint(_buffer, sequenceId);
+    }
+    _lastInputs[clientId] = {inputMask, latencyBits, sequenceId};
+}
+
+void MatchRecorder::recordLeave(uint32_t clientId)
+{
+    _buffer.push_back(match::OP_LEAVE);
+    match::appendVarint(_buffer, clientId);
+}
+
+void MatchRecorder::recordJoin(uint32_t clientId, uint32_t playerId, float x,
+                               float y)
+{
+    _buffer.push_back(match::OP_JOIN);
+    match::appendVarint(_buffer, clientId);
+    match::appendVarint(_buffer, playerId);
+    match::appendFloat(_buffer, x);
+    match::appendFloat(_buffer, y);
+}
+
+void MatchRecorder::recordLevel(int levelId, int playerCount)
+{
+    _buffer.push_back(match::OP_LEVEL);
+    match::appendVarint(_buffer, static_cast<uint32_t>(levelId));
+    match::appendVarint(_buffer, static_cast<uint32_t>(playerCount));
+}
+
+void MatchRecorder::recordResetPlayers()
+{
+    _buffer.push_back(match::OP_RESET_PLAYERS);
+}
+
+void MatchRecorder::flushBlock()
+{
+    if (_buffer.empty() || !_file.is_open()) {
+        return;
+    }
+
+    _compressed.resize(rtype::lz4::compressBound(_buffer.size()));
+    match::MatchBlockHeader header;
+    header.rawSize = static_cast<uint32_t>(_buffer.size());
+    header.compressedSize = static_cast<uint32_t>(
+        rtype::lz4::compress(_buffer.data(), _buffer.size(),
+                             _compressed.data()));
+
+    _file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    _file.write(reinterpret_cast<const char*>(_compressed.data()),
+                header.compressedSize);
+    _file.flush();
+    _bytesWritten += sizeof(header) + header.compressedSize;
+    _buffer.clear();
+}
+
+}  // namespace engine
@@ -0,0 +1,86 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** MatchRecorder
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "MatchRecording.hpp"
+
+namespace engine {
+
+/**
+ * @brief Writes a match recording (see MatchRecording.hpp)
+ *
+ * Called by the GameLoop under its state lock, in the order things happen
+ * to the simulation. Operations are delta-encoded against the previous
+ * frame and the sender's previous input, so an idle frame is one byte and
+ * a held input two or three. They are buffered and written as compressed
+ * blocks of match::BLOCK_SIZE bytes, every two minutes or so with four
+ * players, so the file is only touched on the game thread when a block
+ * fills up.
+ */
+class MatchRecorder {
+   public:
+    MatchRecorder() = default;
+    ~MatchRecorder();
+
+    MatchRecorder(const MatchRecorder&) = delete;
+    MatchRecorder& operator=(const MatchRecorder&) = delete;
+
+    /**
+     * @brief Create the file and write its header
+     * @return false if the file cannot be created
+     */
+    bool open(const std::string& filePath, const MatchConfig& config);
+
+    /**
+     * @brief Write the buffered operations and close the file
+     */
+    void close();
+
+    bool isOpen() const { return _file.is_open(); }
+
+    void recordTick(float deltaTime);
+    void recordInput(uint32_t clientId, uint32_t inputMask, float viewLatency,
+                     uint32_t sequenceId);
+    void recordLeave(uint32_t clientId);
+    void recordJoin(uint32_t clientId, uint32_t playerId, float x, float y);
+    void recordLevel(int levelId, int playerCount);
+    void recordResetPlayers();
+
+    uint64_t getTickCount() const { return _tickCount; }
+
+    /**
+     * @brief Bytes written to the file so far, header included
+     */
+    uint64_t getBytesWritten() const { return _bytesWritten; }
+
+   private:
+    struct InputState {
+        uint32_t inputMask;
+        uint32_t viewLatencyBits;
+        uint32_t sequenceId;
+    };
+
+    std::ofstream _file;
+    std::vector<uint8_t> _buffer;
+    std::vector<uint8_t> _compressed;
+    std::unordered_map<uint32_t, InputState> _lastInputs;
+    uint32_t _deltaTimeBits = 0;
+    bool _hasDeltaTime = false;
+    uint64_t _tickCount = 0;
+    uint64_t _bytesWritten = 0;
+
+    void flushBlock();
+};
+
+}  // namespace engine
@@ -0,0 +1,118 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** MatchRecording
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace engine {
+
+/**
+ * @brief Layout of .rtm match recordings
+ *
+ * A match recording holds what the GameLoop received, not what it produced:
+ * replaying it through a fresh GameLoop rebuilds every tick of the match.
+ *
+ * - Header: MatchHeader (magic, version, seed and rules of the match)
+ * - Blocks until the end of the file: MatchBlockHeader + LZ4-compressed
+ *   operations. Each block decodes on its own. A truncated last block
+ *   (interrupted recording) is dropped.
+ *
+ * Operations are one byte (Op in the low nibble, flags in the high nibble)
+ * followed by varints and raw floats:
+ * - TICK [float deltaTime if TICK_NEW_DELTA]: the simulation ran one frame.
+ *   Inputs and leaves before it were consumed by that frame
+ * - INPUT varint clientId [varint mask if INPUT_NEW_MASK] [float viewLatency
+ *   if INPUT_NEW_LATENCY] [varint sequenceId if INPUT_NEW_SEQUENCE]: omitted
+ *   fields repeat the client's previous input, with sequenceId + 1
+ * - LEAVE varint clientId
+ * - JOIN varint clientId, varint playerId, float x, float y
+ * - LEVEL varint levelId (0 = next level), varint playerCount
+ * - RESET_PLAYERS
+ *
+ * JOIN, LEVEL and RESET_PLAYERS happen between two frames and are replayed
+ * as soon as they are read.
+ */
+namespace match {
+
+inline constexpr char MAGIC[] = "RTYPE_MATCH";
+inline constexpr uint32_t VERSION = 1;
+inline constexpr const char* FILE_EXTENSION = ".rtm";
+
+enum Op : uint8_t {
+    OP_TICK = 1,
+    OP_INPUT = 2,
+    OP_LEAVE = 3,
+    OP_JOIN = 4,
+    OP_LEVEL = 5,
+    OP_RESET_PLAYERS = 6,
+};
+
+inline constexpr uint8_t OP_MASK = 0x0F;
+
+/// Flags in the high nibble of the operation byte
+inline constexpr uint8_t TICK_NEW_DELTA = 0x10;
+inline constexpr uint8_t INPUT_NEW_MASK = 0x10;
+inline constexpr uint8_t INPUT_NEW_LATENCY = 0x20;
+inline constexpr uint8_t INPUT_NEW_SEQUENCE = 0x40;
+
+#pragma pack(push, 1)
+
+struct MatchHeader {
+    char magic[sizeof(MAGIC)];
+    uint32_t version;
+    int64_t recordedAt;  ///< Unix time in seconds
+    uint32_t seed;       ///< Passed to GameLoop::setRandomSeed
+    float lagCompensationWindow;
+    uint8_t powerUpsEnabled;
+    uint8_t friendlyFireEnabled;
+    uint8_t reserved[18];
+};
+
+struct MatchBlockHeader {
+    uint32_t rawSize;
+    uint32_t compressedSize;
+};
+
+#pragma pack(pop)
+
+/// Raw operation bytes buffered before a block is compressed
+inline constexpr size_t BLOCK_SIZE = 64 * 1024;
+/// Largest raw block a reader accepts
+inline constexpr size_t MAX_BLOCK_SIZE = 4 * 1024 * 1024;
+
+inline void appendVarint(std::vector<uint8_t>& out, uint32_t value)
+{
+    while (value >= 0x80) {
+        out.push_back(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(value));
+}
+
+inline void appendFloat(std::vector<uint8_t>& out, float value)
+{
+    size_t offset = out.size();
+    out.resize(offset + sizeof(value));
+    std::memcpy(out.data() + offset, &value, sizeof(value));
+}
+
+}  // namespace match
+
+/**
+ * @brief Rules a match was played with, stored in its recording
+ */
+struct MatchConfig {
+    uint32_t seed = 0;
+    bool powerUpsEnabled = true;
+    bool friendlyFireEnabled = false;
+    float lagCompensationWindow = 0.0f;
+};
+
+}  // namespace engine
@@ -0,0 +1,71 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** MatchReplayer
+*/
+
+#include "MatchReplayer.hpp"
+
+namespace engine {
+
+MatchReplayer::MatchReplayer(GameLoop& gameLoop) : _gameLoop(gameLoop) {}
+
+bool MatchReplayer::open(const std::string& filePath)
+{
+    if (!_reader.open(filePath)) {
+        return false;
+    }
+
+    const MatchConfig& config = _reader.getConfig();
+    _gameLoop.addDefaultSystems(config.powerUpsEnabled,
+                                config.friendlyFireEnabled,
+                                config.lagCompensationWindow);
+    _gameLoop.setRandomSeed(config.seed);
+    // The server drops dead players from the loop through this callback
+    _gameLoop.setOnPlayerDeath([](uint32_t) {});
+    _gameLoop.start(false);
+    _tickCount = 0;
+    _simulatedTime = 0.0;
+    return true;
+}
+
+bool MatchReplayer::step()
+{
+    MatchEvent event;
+    while (_reader.next(event)) {
+        switch (event.type) {
+            case match::OP_TICK:
+                _gameLoop.tick(event.deltaTime);
+                _tickCount++;
+                _simulatedTime += event.deltaTime;
+                return true;
+            case match::OP_INPUT: {
+                NetworkInputCommand command;
+                command.clientId = event.clientId;
+                command.inputMask = event.inputMask;
+                command.timestamp = 0.0f;
+                command.sequenceId = event.sequenceId;
+                command.viewLatency = event.viewLatency;
+                _gameLoop.queueInput(command);
+                break;
+            }
+            case match::OP_LEAVE:
+                _gameLoop.removePlayer(event.clientId);
+                break;
+            case match::OP_JOIN:
+                _gameLoop.spawnPlayer(event.clientId, event.playerId, event.x,
+                                      event.y);
+                break;
+            case match::OP_LEVEL:
+                _gameLoop.startLevel(event.levelId, event.playerCount);
+                break;
+            case match::OP_RESET_PLAYERS:
+                _gameLoop.resetPlayers();
+                break;
+        }
+    }
+    return false;
+}
+
+}  // namespace engine
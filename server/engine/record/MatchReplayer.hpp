@@ -0,0 +1,62 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** MatchReplayer
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "../system/GameLoop.hpp"
+#include "MatchReader.hpp"
+
+namespace engine {
+
+/**
+ * @brief Re-simulates a recorded match through a GameLoop
+ *
+ * Each step() feeds one recorded frame to the loop exactly as the server
+ * did: players joining and level changes first, then the frame's inputs
+ * and leaves, then tick() with the recorded delta time. Nothing waits on a
+ * clock, so a match replays as fast as the simulation runs.
+ */
+class MatchReplayer {
+   public:
+    /**
+     * @param gameLoop Loop with no systems yet, configured by open()
+     */
+    explicit MatchReplayer(GameLoop& gameLoop);
+
+    /**
+     * @brief Open a recording and set the loop up with its seed and rules
+     * @return false if the file is not a match recording
+     */
+    bool open(const std::string& filePath);
+
+    /**
+     * @brief Run the next recorded frame
+     * @return false once the recording is exhausted
+     */
+    bool step();
+
+    const MatchConfig& getConfig() const { return _reader.getConfig(); }
+    int64_t getRecordedAt() const { return _reader.getRecordedAt(); }
+
+    uint64_t getTickCount() const { return _tickCount; }
+
+    /**
+     * @brief Sum of the delta times replayed so far, in seconds
+     */
+    double getSimulatedTime() const { return _simulatedTime; }
+
+   private:
+    GameLoop& _gameLoop;
+    MatchReader _reader;
+    uint64_t _tickCount = 0;
+    double _simulatedTime = 0.0;
+};
+
+}  // namespace engine
@@ -21,6 +21,15 @@ std::string BossSystem::getName() const { return "BossSystem"; }
 
 int BossSystem::getPriority() const { return 15; }
 
+void BossSystem::cleanup([[maybe_unused]] EntityManager& entityManager)
+{
+    _entitiesToDestroy.clear();
+    _turretShootTimer = 0.0f;
+    _frameCounter = 0;
+}
+
+void BossSystem::setRandomSeed(uint32_t seed) { _rng.seed(seed); }
+
 void BossSystem::markForDestruction(EntityId entityId, uint32_t networkId,
                                     uint8_t type)
 {
@@ -49,8 +58,7 @@ void BossSystem::processEntity(float deltaTime, Entity& entity, Boss* boss,
     if (!_entityManager) {
     }
 
-    static int frameCounter = 0;
-    if (frameCounter++ % 120 == 0) {
+    if (_frameCounter++ % 120 == 0) {
         Logger::getInstance().log(
             "Boss update: phase=" +
                 std::to_string(static_cast<int>(boss->currentPhase)) +
@@ -733,14 +741,19 @@ std::string BossPartSystem::getName() const { return "BossPartSystem"; }
 
 int BossPartSystem::getPriority() const { return 14; }
 
+void BossPartSystem::cleanup([[maybe_unused]] EntityManager& entityManager)
+{
+    _updateCounter = 0;
+    _debugCounter = 0;
+}
+
 void BossPartSystem::update(float deltaTime, EntityManager& entityManager)
 {
     System<BossPart, Position>::update(deltaTime, entityManager);
 
     auto bosses = entityManager.getEntitiesWith<Boss, Position>();
 
-    static int updateCounter = 0;
-    if (updateCounter++ % 120 == 0) {
+    if (_updateCounter++ % 120 == 0) {
         auto parts = entityManager.getEntitiesWith<BossPart, Position>();
         Logger::getInstance().log(
             "BossPartSystem: " + std::to_string(bosses.size()) + " bosses, " +
@@ -856,8 +869,7 @@ void BossPartSystem::updateBossParts(float deltaTime,
             float newX = bossPosition.x + part->relativeX + dynamicOffsetX;
             float newY = bossPosition.y + part->relativeY + dynamicOffsetY;
 
-            static int debugCounter = 0;
-            if (debugCounter++ % 60 == 0) {
+            if (_debugCounter++ % 60 == 0) {
                 Logger::getInstance().log(
                     "TURRET UPDATE: bossPos=(" +
                         std::to_string(bossPosition.x) + ", " +
@@ -938,6 +950,11 @@ std::string BossDamageSystem::getName() const { return "BossDamageSystem"; }
 
 int BossDamageSystem::getPriority() const { return 16; }
 
+void BossDamageSystem::cleanup([[maybe_unused]] EntityManager& entityManager)
+{
+    _previousHealth.clear();
+}
+
 void BossDamageSystem::processEntity(float deltaTime, Entity& entity,
                                      Boss* boss, Health* health)
 {
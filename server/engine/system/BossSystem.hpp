@@ -48,6 +48,7 @@ class BossSystem : public System<Boss, Health, Position> {
     std::uniform_int_distribution<int> _explosionOffsetDist;
     std::uniform_int_distribution<int> _explosionTypeDist;
     float _turretShootTimer;
+    int _frameCounter;  ///< Throttles the status log
 
     void markForDestruction(EntityId entityId, uint32_t networkId,
                             uint8_t type);
@@ -97,12 +98,15 @@ class BossSystem : public System<Boss, Health, Position> {
           _angleDistribution(0.0f, TWO_PI),
           _explosionOffsetDist(-100, 100),
           _explosionTypeDist(1, 2),
-          _turretShootTimer(0.0f)
+          _turretShootTimer(0.0f),
+          _frameCounter(0)
     {
     }
 
     std::string getName() const override;
     int getPriority() const override;
+    void cleanup(EntityManager& entityManager) override;
+    void setRandomSeed(uint32_t seed) override;
 
     const std::vector<DestroyInfo>& getDestroyedEntities() const;
     void clearDestroyedEntities();
@@ -115,13 +119,20 @@ class BossSystem : public System<Boss, Health, Position> {
  * and handles independent animations/rotations.
  */
 class BossPartSystem : public System<BossPart, Position> {
+   private:
+    int _updateCounter;  ///< Throttles the part count log
+    int _debugCounter;   ///< Throttles the turret position log
+
    protected:
     void processEntity(float deltaTime, Entity& entity, BossPart* part,
                        Position* pos) override;
 
    public:
+    BossPartSystem() : _updateCounter(0), _debugCounter(0) {}
+
     std::string getName() const override;
     int getPriority() const override;
+    void cleanup(EntityManager& entityManager) override;
 
     void update(float deltaTime, EntityManager& entityManager) override;
 
@@ -171,6 +182,7 @@ class BossDamageSystem : public System<Boss, Health> {
    public:
     std::string getName() const override;
     int getPriority() const override;
+    void cleanup(EntityManager& entityManager) override;
 };
 
 }  // namespace engine
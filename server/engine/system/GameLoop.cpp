@@ -11,7 +11,9 @@
 #include <iostream>
 
 #include "../../../common/network/EntityType.hpp"
+#include "../../../common/network/PlayerMovement.hpp"
 #include "../../../common/utils/Logger.hpp"
+#include "../record/MatchRecorder.hpp"
 #include "../wave/WaveManager.hpp"
 #include "BossSystem.hpp"
 #include "GameSystems.hpp"
@@ -115,7 +117,7 @@ void GameLoop::processDestroyedEntities<CollisionSystem>(
                 waveManager->onEnemyDestroyed();
             }
 
-            if (_powerUpsEnabled && rand() % 2 == 0) {
+            if (_powerUpsEnabled && _rng() % 2 == 0) {
                 Entity powerUpItem;
                 float spawnX = info.x;
                 switch (_nextPowerUpIndex) {
@@ -176,7 +178,8 @@ void GameLoop::processDestroyedEntities<CollisionSystem>(
 GameLoop::GameLoop(float targetFPS)
     : _entityFactory(_entityManager),
       _running(false),
-      _targetFrameTime(static_cast<int>(1000.0f / targetFPS))
+      _targetFrameTime(static_cast<int>(1000.0f / targetFPS)),
+      _rng(std::random_device{}())
 {
 }
 
@@ -192,7 +195,44 @@ void GameLoop::addSystem(std::unique_ptr<ISystem> system)
               });
 }
 
-void GameLoop::start()
+void GameLoop::addDefaultSystems(bool powerUpsEnabled,
+                                 bool friendlyFireEnabled,
+                                 float lagCompensationWindow)
+{
+    setPowerUpsEnabled(powerUpsEnabled);
+    _matchConfig.powerUpsEnabled = powerUpsEnabled;
+    _matchConfig.friendlyFireEnabled = friendlyFireEnabled;
+    _matchConfig.lagCompensationWindow = lagCompensationWindow;
+
+    addSystem(std::make_unique<AnimationSystem>());
+    addSystem(std::make_unique<MovementSystem>());
+    addSystem(std::make_unique<WaveMovementSystem>());
+    addSystem(std::make_unique<ZigzagMovementSystem>());
+    addSystem(std::make_unique<BossPartSystem>());
+    addSystem(std::make_unique<BossSystem>(_spawnEvents));
+    addSystem(std::make_unique<BossDamageSystem>());
+    addSystem(std::make_unique<FollowingSystem>());
+    addSystem(std::make_unique<PlayerCooldownSystem>());
+    addSystem(std::make_unique<SpeedBoostSystem>());
+    addSystem(std::make_unique<WaveManager>(_spawnEvents, "levels"));
+    addSystem(std::make_unique<EnemyShootingSystem>(_spawnEvents));
+    addSystem(
+        std::make_unique<TurretShootingSystem>(_spawnEvents, _entityManager));
+    addSystem(std::make_unique<OrbiterSystem>(_spawnEvents));
+    addSystem(std::make_unique<LaserShipSystem>(_spawnEvents));
+    addSystem(std::make_unique<GuidedMissileSystem>());
+
+    auto collisionSystem = std::make_unique<CollisionSystem>(_spawnEvents);
+    collisionSystem->setPowerUpsEnabled(powerUpsEnabled);
+    collisionSystem->setFriendlyFireEnabled(friendlyFireEnabled);
+    collisionSystem->setLagCompensationWindow(lagCompensationWindow);
+    addSystem(std::move(collisionSystem));
+    addSystem(std::make_unique<BulletCleanupSystem>());
+    addSystem(std::make_unique<EnemyCleanupSystem>());
+    addSystem(std::make_unique<LifetimeSystem>());
+}
+
+void GameLoop::start(bool ownThread)
 {
     if (_running.load()) {
         return;
@@ -203,7 +243,10 @@ void GameLoop::start()
     }
 
     _running.store(true);
-    _gameThread = std::thread(&GameLoop::gameThreadLoop, this);
+    _ownsThread = ownThread;
+    if (_ownsThread) {
+        _gameThread = std::thread(&GameLoop::gameThreadLoop, this);
+    }
 }
 
 void GameLoop::stop()
@@ -219,6 +262,7 @@ void GameLoop::stop()
     if (_gameThread.joinable()) {
         _gameThread.join();
     }
+    stopRecording();
 
     for (auto& system : _systems) {
         system->cleanup(_entityManager);
@@ -235,31 +279,42 @@ void GameLoop::gameThreadLoop()
             std::chrono::duration<float>(currentTime - lastUpdateTime).count();
         lastUpdateTime = currentTime;
 
-        if (deltaTime > 0.1f) {
-            deltaTime = 0.1f;
+        tick(deltaTime);
+
+        auto frameTime = std::chrono::steady_clock::now() - currentTime;
+        if (frameTime < _targetFrameTime) {
+            std::this_thread::sleep_for(_targetFrameTime - frameTime);
         }
+    }
+}
 
-        processInputCommands(deltaTime);
+void GameLoop::tick(float deltaTime)
+{
+    if (deltaTime > 0.1f) {
+        deltaTime = 0.1f;
+    }
+
+    std::lock_guard<std::mutex> lock(_stateMutex);
 
-        processDeathTimers(deltaTime);
+    processInputCommands(deltaTime);
 
-        processSpawnEvents();
+    processDeathTimers(deltaTime);
 
-        for (auto& system : _systems) {
-            system->update(deltaTime, _entityManager);
-        }
+    processSpawnEvents();
+
+    for (auto& system : _systems) {
+        system->update(deltaTime, _entityManager);
+    }
 
-        processDestroyedEntitiesFromSystems();
+    processDestroyedEntitiesFromSystems();
 
-        generateNetworkUpdates();
+    generateNetworkUpdates();
 
-        processPendingRemovals();
-        processPendingDestructions();
+    processPendingRemovals();
+    processPendingDestructions();
 
-        auto frameTime = std::chrono::steady_clock::now() - currentTime;
-        if (frameTime < _targetFrameTime) {
-            std::this_thread::sleep_for(_targetFrameTime - frameTime);
-        }
+    if (_recorder) {
+        _recorder->recordTick(deltaTime);
     }
 }
 
@@ -298,6 +353,31 @@ void GameLoop::processInputCommands(float deltaTime)
     std::vector<NetworkInputCommand> commands;
     _inputQueue.popAll(commands);
 
+    if (_recorder) {
+        for (const auto& cmd : commands) {
+            _recorder->recordInput(cmd.clientId, cmd.inputMask,
+                                   cmd.viewLatency, cmd.sequenceId);
+        }
+    }
+
+    // Each input moves the ship by one INPUT_STEP, as the client predicts it.
+    // Clients earn one input per step of simulated time: more would be a
+    // speed hack, so the extra ones are dropped
+    for (const auto& [clientId, entityId] : _clientToEntity) {
+        Entity* entity = _entityManager.getEntity(entityId);
+        auto* player =
+            entity ? _entityManager.getComponent<Player>(*entity) : nullptr;
+        if (player) {
+            player->inputCredit =
+                std::min(player->inputCredit +
+                             deltaTime / PlayerMovement::INPUT_STEP,
+                         INPUT_BURST);
+        }
+    }
+
+    // Last applied input per client, acknowledged with the resulting position
+    std::unordered_map<uint32_t, InputAck> acks;
+
     for (const auto& cmd : commands) {
         auto it = _clientToEntity.find(cmd.clientId);
         if (it == _clientToEntity.end()) {
@@ -322,36 +402,27 @@ void GameLoop::processInputCommands(float deltaTime)
             continue;
         }
 
-        const float BASE_SPEED = 300.0f;
-        float moveSpeed = BASE_SPEED;
+        if (player->inputCredit < 1.0f) {
+            continue;
+        }
+        player->inputCredit -= 1.0f;
+
+        player->viewLatency = cmd.viewLatency;
+
+        float moveSpeed = PlayerMovement::BASE_SPEED;
 
         auto* speedBoost = _entityManager.getComponent<SpeedBoost>(*entity);
         if (speedBoost) {
             moveSpeed = speedBoost->boostedSpeed;
         }
 
-        const float MIN_X = 0.0f;
-        const float MAX_X = 1800.0f;
-        const float MIN_Y = 0.0f;
-        const float MAX_Y = 1000.0f;
-
-        float moveX = 0.0f;
-        float moveY = 0.0f;
-
-        if (cmd.inputMask & 1) moveY -= moveSpeed * deltaTime;  // Up
-        if (cmd.inputMask & 2) moveY += moveSpeed * deltaTime;  // Down
-        if (cmd.inputMask & 4) moveX -= moveSpeed * deltaTime;  // Left
-        if (cmd.inputMask & 8) moveX += moveSpeed * deltaTime;  // Right
-
-        bool positionChanged = (moveX != 0.0f || moveY != 0.0f);
-
-        pos->x += moveX;
-        pos->y += moveY;
-
-        if (pos->x < MIN_X) pos->x = MIN_X;
-        if (pos->x > MAX_X) pos->x = MAX_X;
-        if (pos->y < MIN_Y) pos->y = MIN_Y;
-        if (pos->y > MAX_Y) pos->y = MAX_Y;
+        bool positionChanged = PlayerMovement::apply(
+            pos->x, pos->y, static_cast<uint8_t>(cmd.inputMask), moveSpeed,
+            PlayerMovement::INPUT_STEP);
+        if (cmd.sequenceId != 0) {
+            acks[cmd.clientId] = {cmd.clientId, cmd.sequenceId, pos->x,
+                                  pos->y};
+        }
 
         if (positionChanged) {
             auto* netEntity =
@@ -368,6 +439,10 @@ void GameLoop::processInputCommands(float deltaTime)
             }
         }
     }
+
+    for (const auto& [clientId, ack] : acks) {
+        _inputAckQueue.push(ack);
+    }
 }
 
 void GameLoop::processPendingRemovals()
@@ -376,6 +451,9 @@ void GameLoop::processPendingRemovals()
     _pendingRemovals.popAll(clientsToRemove);
 
     for (uint32_t clientId : clientsToRemove) {
+        if (_recorder) {
+            _recorder->recordLeave(clientId);
+        }
         auto it = _clientToEntity.find(clientId);
         if (it == _clientToEntity.end()) {
             continue;
@@ -513,6 +591,11 @@ size_t GameLoop::popEntityUpdates(std::vector<EntityStateUpdate>& updates)
     return _outputQueue.popAll(updates);
 }
 
+size_t GameLoop::popInputAcks(std::vector<InputAck>& acks)
+{
+    return _inputAckQueue.popAll(acks);
+}
+
 void GameLoop::getAllHealthUpdates(
     std::vector<std::tuple<uint32_t, float, float>>& healthUpdates)
 {
@@ -555,6 +638,9 @@ uint32_t GameLoop::spawnPlayer(uint32_t clientId, uint32_t playerId, float x,
     Entity player = _entityFactory.createPlayer(clientId, playerId, x, y);
     uint32_t entityId = player.getId();
     _clientToEntity[clientId] = entityId;
+    if (_recorder) {
+        _recorder->recordJoin(clientId, playerId, x, y);
+    }
     return playerId;
 }
 
@@ -563,6 +649,133 @@ void GameLoop::removePlayer(uint32_t clientId)
     _pendingRemovals.push(clientId);
 }
 
+bool GameLoop::startLevel(int levelId, int playerCount)
+{
+    std::lock_guard<std::mutex> lock(_stateMutex);
+
+    auto* waveManager = getSystem<WaveManager>();
+    if (!waveManager) {
+        return false;
+    }
+    if (_recorder) {
+        _recorder->recordLevel(levelId, playerCount);
+    }
+
+    bool loaded = levelId > 0 ? waveManager->loadLevel(levelId)
+                              : waveManager->loadNextLevel();
+    if (!loaded) {
+        return false;
+    }
+    waveManager->setPlayerCount(playerCount);
+    waveManager->startLevel();
+    return true;
+}
+
+void GameLoop::resetPlayers()
+{
+    std::lock_guard<std::mutex> lock(_stateMutex);
+    if (_recorder) {
+        _recorder->recordResetPlayers();
+    }
+
+    auto players =
+        _entityManager.getEntitiesWith<Position, Player, NetworkEntity,
+                                       Health>();
+
+    int playerIndex = 0;
+    for (const auto& playerEntity : players) {
+        auto* position = _entityManager.getComponent<Position>(playerEntity);
+        auto* health = _entityManager.getComponent<Health>(playerEntity);
+        if (!position || !health) {
+            continue;
+        }
+
+        position->x = 100.0f;
+        position->y = 200.0f + (playerIndex * 200.0f);
+        health->heal(health->max);
+
+        if (_entityManager.hasComponent<Shield>(playerEntity)) {
+            Entity* mutablePlayer =
+                _entityManager.getEntity(playerEntity.getId());
+            if (mutablePlayer) {
+                _entityManager.removeComponent<Shield>(*mutablePlayer);
+            }
+        }
+        playerIndex++;
+    }
+}
+
+void GameLoop::setRandomSeed(uint32_t seed)
+{
+    std::lock_guard<std::mutex> lock(_stateMutex);
+    _matchConfig.seed = seed;
+
+    // Each system draws its own seed so adding one does not shift the others
+    std::seed_seq sequence{seed};
+    std::vector<uint32_t> seeds(_systems.size() + 1);
+    sequence.generate(seeds.begin(), seeds.end());
+    _rng.seed(seeds[0]);
+    for (size_t i = 0; i < _systems.size(); ++i) {
+        _systems[i]->setRandomSeed(seeds[i + 1]);
+    }
+}
+
+bool GameLoop::startRecording(const std::string& filePath)
+{
+    std::lock_guard<std::mutex> lock(_stateMutex);
+
+    auto recorder = std::make_unique<MatchRecorder>();
+    if (!recorder->open(filePath, _matchConfig)) {
+        return false;
+    }
+
+    // Players spawned in the lobby, in creation order
+    std::vector<std::pair<EntityId, uint32_t>> players;
+    for (const auto& [clientId, entityId] : _clientToEntity) {
+        players.emplace_back(entityId, clientId);
+    }
+    std::sort(players.begin(), players.end());
+    for (const auto& [entityId, clientId] : players) {
+        Entity* entity = _entityManager.getEntity(entityId);
+        if (!entity) {
+            continue;
+        }
+        auto* pos = _entityManager.getComponent<Position>(*entity);
+        auto* player = _entityManager.getComponent<Player>(*entity);
+        if (pos && player) {
+            recorder->recordJoin(clientId, player->playerId, pos->x, pos->y);
+        }
+    }
+
+    if (_recorder) {
+        _recorder->close();
+    }
+    _recorder = std::move(recorder);
+    return true;
+}
+
+void GameLoop::stopRecording()
+{
+    std::lock_guard<std::mutex> lock(_stateMutex);
+    if (!_recorder) {
+        return;
+    }
+
+    Logger::getInstance().log(
+        "Match recording closed: " + std::to_string(_recorder->getTickCount()) +
+            " ticks, " + std::to_string(_recorder->getBytesWritten()) +
+            " bytes",
+        LogLevel::INFO_L, "GameLoop");
+    _recorder->close();
+    _recorder.reset();
+}
+
+bool GameLoop::isRecording()
+{
+    std::lock_guard<std::mutex> lock(_stateMutex);
+    return _recorder != nullptr;
+}
+
 void GameLoop::getAllPlayers(std::vector<EntityStateUpdate>& updates)
 {
     auto players =
@@ -617,8 +830,10 @@ void GameLoop::clearAllEntities()
 {
     std::lock_guard<std::mutex> lock(_stateMutex);
     _entityManager.clear();
+    _entityFactory.resetIds();
     _clientToEntity.clear();
     _spawnEvents.clear();
+    _nextPowerUpIndex = 0;
 
     Logger::getInstance().log("All entities cleared from game state",
                               LogLevel::INFO_L, "GameLoop");
@@ -11,6 +11,8 @@
 #include <chrono>
 #include <memory>
 #include <mutex>
+#include <random>
+#include <string>
 #include <thread>
 #include <unordered_map>
 #include <variant>
@@ -21,6 +23,7 @@
 #include "../entity/EntityManager.hpp"
 #include "../entity/GameEntityFactory.hpp"
 #include "../events/SpawnEvents.hpp"
+#include "../record/MatchRecording.hpp"
 #include "../threading/ThreadSafeQueue.hpp"
 #include "System.hpp"
 
@@ -28,6 +31,8 @@ namespace engine {
 
 using ::SpawnEvent;
 
+class MatchRecorder;
+
 /**
  * @brief Network input command from clients
  */
@@ -35,6 +40,18 @@ struct NetworkInputCommand {
     uint32_t clientId;
     uint32_t inputMask;  // Bitfield: 1=up, 2=down, 4=left, 8=right, 16=shoot
     float timestamp;
+    uint32_t sequenceId = 0;  // Client packet sequence, 0 = not acknowledged
+    float viewLatency = 0.0f;  // Client round trip + interpolation delay (s)
+};
+
+/**
+ * @brief Last input applied for a client and the position it produced
+ */
+struct InputAck {
+    uint32_t clientId;
+    uint32_t sequenceId;
+    float x;
+    float y;
 };
 
 /**
@@ -66,12 +83,15 @@ class GameLoop {
     // Threading
     std::thread _gameThread;
     std::atomic<bool> _running;
-    std::mutex
-        _stateMutex;  // Protects _entityManager, _clientToEntity, _spawnEvents
+    bool _ownsThread = true;  // false when ticked by an external scheduler
+    // Held for a whole tick(): what locks it runs between two frames.
+    // Protects _entityManager, _clientToEntity, _spawnEvents, _recorder
+    std::mutex _stateMutex;
 
     // Input/Output queues for inter-thread communication
     ThreadSafeQueue<NetworkInputCommand> _inputQueue;
     ThreadSafeQueue<EntityStateUpdate> _outputQueue;
+    ThreadSafeQueue<InputAck> _inputAckQueue;
 
     // Unified spawn event queue (systems write, GameLoop reads)
     std::vector<SpawnEvent> _spawnEvents;
@@ -82,6 +102,10 @@ class GameLoop {
     // Player tracking
     std::unordered_map<uint32_t, EntityId> _clientToEntity;
 
+    // Inputs a client may apply ahead of one per PlayerMovement::INPUT_STEP,
+    // to absorb network jitter
+    static constexpr float INPUT_BURST = 4.0f;
+
     ThreadSafeQueue<uint32_t> _pendingRemovals;
 
     std::vector<EntityId> _pendingDestructions;
@@ -94,6 +118,11 @@ class GameLoop {
     // Configuration flags
     bool _powerUpsEnabled = true;
 
+    // Rules and seed of the match, saved in recordings
+    MatchConfig _matchConfig;
+    std::mt19937 _rng;
+    std::unique_ptr<MatchRecorder> _recorder;
+
     /**
      * @brief Main game loop (runs in separate thread)
      */
@@ -168,9 +197,29 @@ class GameLoop {
     void addSystem(std::unique_ptr<ISystem> system);
 
     /**
-     * @brief Initialize systems and start the game thread
+     * @brief Register the standard R-Type gameplay systems
+     * @param powerUpsEnabled Whether destroyed enemies may drop power-ups
+     * @param friendlyFireEnabled Whether player bullets hurt other players
+     * @param lagCompensationWindow Longest rewind applied to player shots in
+     * seconds, 0 to disable lag compensation
      */
-    void start();
+    void addDefaultSystems(bool powerUpsEnabled, bool friendlyFireEnabled,
+                           float lagCompensationWindow = 0.0f);
+
+    /**
+     * @brief Initialize systems and start the game
+     * @param ownThread If true, run frames on a dedicated thread. If false,
+     *        the caller drives the simulation by calling tick()
+     */
+    void start(bool ownThread = true);
+
+    /**
+     * @brief Run a single simulation frame
+     * @param deltaTime Elapsed time since the previous frame (seconds)
+     * @note Only for loops started with start(false); must not be called
+     *       concurrently for the same GameLoop
+     */
+    void tick(float deltaTime);
 
     /**
      * @brief Stop the game thread
@@ -195,6 +244,13 @@ class GameLoop {
      */
     size_t popEntityUpdates(std::vector<EntityStateUpdate>& updates);
 
+    /**
+     * @brief Pop input acknowledgements produced since the last call
+     * @param acks Vector to receive one ack per client that sent input
+     * @return Number of acks retrieved
+     */
+    size_t popInputAcks(std::vector<InputAck>& acks);
+
     /**
      * @brief Get all entities with their health info (players and bosses)
      * @param updates Vector to receive health info (entityId, currentHP, maxHP)
@@ -225,6 +281,51 @@ class GameLoop {
      */
     void removePlayer(uint32_t clientId);
 
+    /**
+     * @brief Load a level and start its first wave, between two frames
+     * @param levelId Level to load, 0 for the one after the current level
+     * @param playerCount Players the bosses are scaled for
+     * @return false if the level could not be loaded
+     */
+    bool startLevel(int levelId, int playerCount);
+
+    /**
+     * @brief Move every player back to its spawn point with full health and
+     * no shield, between two frames
+     */
+    void resetPlayers();
+
+    /**
+     * @brief Seed every random number generator of the simulation
+     *
+     * With the same seed, the same systems and the same calls between
+     * frames, the loop produces the same match. Call it after the systems
+     * are added and before the first tick.
+     */
+    void setRandomSeed(uint32_t seed);
+
+    /**
+     * @brief Record the match from the next frame on (see MatchRecorder)
+     *
+     * The players already spawned are written first, so a recording
+     * started before the first tick replays the whole match. Recording
+     * stops with stop() or stopRecording().
+     *
+     * @param filePath Path of the .rtm file to create
+     * @return false if the file cannot be created
+     */
+    bool startRecording(const std::string& filePath);
+
+    /**
+     * @brief Finish the current recording, if any
+     */
+    void stopRecording();
+
+    /**
+     * @brief Check whether a recording is in progress
+     */
+    bool isRecording();
+
     /**
      * @brief Get all existing player entity states
      * @param updates Vector to receive the player states
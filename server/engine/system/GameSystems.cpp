@@ -7,6 +7,7 @@
 
 #include "GameSystems.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 #include <limits>
@@ -24,6 +25,11 @@ std::string MovementSystem::getName() const { return "MovementSystem"; }
 
 int MovementSystem::getPriority() const { return 10; }
 
+void MovementSystem::cleanup([[maybe_unused]] EntityManager& entityManager)
+{
+    _frameCounter = 0;
+}
+
 void MovementSystem::update(float deltaTime, EntityManager& entityManager)
 {
     _frameCounter++;
@@ -212,6 +218,16 @@ SystemType CollisionSystem::getType() const { return SystemType::COLLISION; }
 
 int CollisionSystem::getPriority() const { return 50; }
 
+void CollisionSystem::cleanup([[maybe_unused]] EntityManager& entityManager)
+{
+    // Network IDs start over with the next match, old frames would alias
+    _history.clear();
+    _time = 0.0f;
+    _entitiesToDestroy.clear();
+    _markedForDestruction.clear();
+    _nextPowerUpIndex = 0;
+}
+
 const std::vector<CollisionSystem::DestroyInfo>&
 CollisionSystem::getDestroyedEntities() const
 {
@@ -239,6 +255,43 @@ bool CollisionSystem::checkCollision(const Position& pos1,
              top1 > bottom2);
 }
 
+float CollisionSystem::getRewind(EntityManager& entityManager,
+                                 const Bullet& bullet) const
+{
+    if (_lagCompensationWindow <= 0.0f) {
+        return 0.0f;
+    }
+
+    Entity* owner = entityManager.getEntity(bullet.ownerId);
+    if (!owner) {
+        return 0.0f;
+    }
+    auto* player = entityManager.getComponent<Player>(*owner);
+    if (!player) {
+        return 0.0f;
+    }
+    return std::min(player->viewLatency, _lagCompensationWindow);
+}
+
+bool CollisionSystem::collidesAsSeen(EntityManager& entityManager,
+                                     float rewind, const Position& bulletPos,
+                                     const BoundingBox& bulletBox,
+                                     const Entity& target,
+                                     const Position& targetPos,
+                                     const BoundingBox& targetBox)
+{
+    if (rewind > 0.0f) {
+        auto* targetNet = entityManager.getComponent<NetworkEntity>(target);
+        Position pastPos;
+        BoundingBox pastBox;
+        if (targetNet && _history.find(targetNet->entityId, _time - rewind,
+                                       pastPos, pastBox)) {
+            return checkCollision(bulletPos, bulletBox, pastPos, pastBox);
+        }
+    }
+    return checkCollision(bulletPos, bulletBox, targetPos, targetBox);
+}
+
 bool CollisionSystem::isMarkedForDestruction(EntityId id) const
 {
     return _markedForDestruction.find(id) != _markedForDestruction.end();
@@ -283,6 +336,8 @@ void CollisionSystem::handlePlayerBulletVsEnemy(
         auto* bulletBox = entityManager.getComponent<BoundingBox>(bulletEntity);
         if (!bulletPos || !bulletBox) continue;
 
+        float rewind = getRewind(entityManager, *bullet);
+
         for (auto& enemyEntity : enemies) {
             if (isMarkedForDestruction(enemyEntity.getId())) continue;
 
@@ -292,7 +347,8 @@ void CollisionSystem::handlePlayerBulletVsEnemy(
                 entityManager.getComponent<BoundingBox>(enemyEntity);
             if (!enemyPos || !enemyHealth || !enemyBox) continue;
 
-            if (checkCollision(*bulletPos, *bulletBox, *enemyPos, *enemyBox)) {
+            if (collidesAsSeen(entityManager, rewind, *bulletPos, *bulletBox,
+                               enemyEntity, *enemyPos, *enemyBox)) {
                 enemyHealth->takeDamage(bullet->damage);
 
                 auto* bulletNet =
@@ -336,6 +392,8 @@ void CollisionSystem::handlePlayerBulletVsBoss(
         auto* bulletBox = entityManager.getComponent<BoundingBox>(bulletEntity);
         if (!bulletPos || !bulletBox) continue;
 
+        float rewind = getRewind(entityManager, *bullet);
+
         for (auto& bossEntity : bosses) {
             if (isMarkedForDestruction(bossEntity.getId())) continue;
 
@@ -344,7 +402,8 @@ void CollisionSystem::handlePlayerBulletVsBoss(
             auto* bossBox = entityManager.getComponent<BoundingBox>(bossEntity);
             if (!bossPos || !bossHealth || !bossBox) continue;
 
-            if (checkCollision(*bulletPos, *bulletBox, *bossPos, *bossBox)) {
+            if (collidesAsSeen(entityManager, rewind, *bulletPos, *bulletBox,
+                               bossEntity, *bossPos, *bossBox)) {
                 auto* boss = entityManager.getComponent<Boss>(bossEntity);
                 if (boss && boss->currentPhase == Boss::DEATH) continue;
 
@@ -404,7 +463,8 @@ void CollisionSystem::handlePlayerBulletVsBoss(
             auto* partBox = entityManager.getComponent<BoundingBox>(partEntity);
             if (!part || !partPos || !partBox) continue;
 
-            if (checkCollision(*bulletPos, *bulletBox, *partPos, *partBox)) {
+            if (collidesAsSeen(entityManager, rewind, *bulletPos, *bulletBox,
+                               partEntity, *partPos, *partBox)) {
                 Entity* bossEntity =
                     entityManager.getEntity(part->bossEntityId);
                 if (bossEntity) {
@@ -634,12 +694,16 @@ void CollisionSystem::handleBulletVsBullet(EntityManager& entityManager,
     }
 }
 
-void CollisionSystem::update([[maybe_unused]] float deltaTime,
-                             EntityManager& entityManager)
+void CollisionSystem::update(float deltaTime, EntityManager& entityManager)
 {
     _entitiesToDestroy.clear();
     _markedForDestruction.clear();
 
+    _time += deltaTime;
+    if (_lagCompensationWindow > 0.0f) {
+        _history.record(_time, entityManager);
+    }
+
     auto bullets =
         entityManager.getEntitiesWith<Position, Bullet, BoundingBox>();
     auto missiles =
@@ -1116,6 +1180,8 @@ std::string ItemSpawnerSystem::getName() const { return "ItemSpawnerSystem"; }
 
 int ItemSpawnerSystem::getPriority() const { return 6; }
 
+void ItemSpawnerSystem::setRandomSeed(uint32_t seed) { _rng.seed(seed); }
+
 void ItemSpawnerSystem::update(float deltaTime,
                                [[maybe_unused]] EntityManager& entityManager)
 {
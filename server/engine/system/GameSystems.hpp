@@ -15,6 +15,7 @@
 #include "../component/GameComponents.hpp"
 #include "../entity/Entity.hpp"
 #include "../events/SpawnEvents.hpp"
+#include "HitboxHistory.hpp"
 #include "System.hpp"
 
 namespace engine {
@@ -33,6 +34,7 @@ class MovementSystem : public ISystem {
 
     std::string getName() const override;
     int getPriority() const override;
+    void cleanup(EntityManager& entityManager) override;
 
     void update(float deltaTime, EntityManager& entityManager) override;
 };
@@ -148,10 +150,22 @@ class CollisionSystem : public ISystem {
     std::vector<SpawnEvent>& _spawnQueue;
     int _nextPowerUpIndex = 0;  // 0=Shield, 1=Missile, 2=Speed
 
+    // Lag compensation: player shots are tested against targets where the
+    // shooter saw them, at most _lagCompensationWindow seconds ago
+    HitboxHistory _history;
+    float _time = 0.0f;
+    float _lagCompensationWindow = 0.0f;
+
     // Helper methods for collision checking
     bool checkCollision(const Position& pos1, const BoundingBox& box1,
                         const Position& pos2, const BoundingBox& box2);
 
+    float getRewind(EntityManager& entityManager, const Bullet& bullet) const;
+    bool collidesAsSeen(EntityManager& entityManager, float rewind,
+                        const Position& bulletPos, const BoundingBox& bulletBox,
+                        const Entity& target, const Position& targetPos,
+                        const BoundingBox& targetBox);
+
     bool isMarkedForDestruction(EntityId id) const;
     void markForDestruction(EntityId entityId, uint32_t networkId, uint8_t type,
                             float x = 0.0f, float y = 0.0f,
@@ -205,10 +219,15 @@ class CollisionSystem : public ISystem {
     {
         _friendlyFireEnabled = enabled;
     }
+    void setLagCompensationWindow(float seconds)
+    {
+        _lagCompensationWindow = seconds;
+    }
 
     std::string getName() const override;
     SystemType getType() const override;
     int getPriority() const override;
+    void cleanup(EntityManager& entityManager) override;
 
     const std::vector<DestroyInfo>& getDestroyedEntities() const;
     void clearDestroyedEntities();
@@ -296,6 +315,7 @@ class ItemSpawnerSystem : public ISystem {
 
     std::string getName() const override;
     int getPriority() const override;
+    void setRandomSeed(uint32_t seed) override;
 
     void update(float deltaTime, EntityManager& entityManager) override;
     void spawnItem();
@@ -0,0 +1,107 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** HitboxHistory
+*/
+
+#include "HitboxHistory.hpp"
+
+#include <algorithm>
+
+namespace engine {
+
+template <typename Tag>
+void HitboxHistory::recordAll(EntityManager& entityManager, Frame& frame)
+{
+    entityManager.forEach<Position, Tag, BoundingBox, NetworkEntity>(
+        [&frame](Entity&, Position* pos, Tag*, BoundingBox* box,
+                 NetworkEntity* net) {
+            frame.hitboxes.push_back({net->entityId, pos->x, pos->y,
+                                      box->width, box->height, box->offsetX,
+                                      box->offsetY});
+        });
+}
+
+void HitboxHistory::record(float time, EntityManager& entityManager)
+{
+    _newest = _frameCount == 0 ? 0 : (_newest + 1) % MAX_FRAMES;
+    if (_frameCount < MAX_FRAMES) {
+        _frameCount++;
+    }
+
+    Frame& frame = _frames[_newest];
+    frame.time = time;
+    frame.hitboxes.clear();
+
+    recordAll<Enemy>(entityManager, frame);
+    recordAll<Boss>(entityManager, frame);
+    recordAll<BossPart>(entityManager, frame);
+
+    std::sort(frame.hitboxes.begin(), frame.hitboxes.end(),
+              [](const Hitbox& a, const Hitbox& b) {
+                  return a.networkId < b.networkId;
+              });
+}
+
+const HitboxHistory::Frame& HitboxHistory::frameAt(size_t age) const
+{
+    return _frames[(_newest + MAX_FRAMES - age) % MAX_FRAMES];
+}
+
+const HitboxHistory::Hitbox* HitboxHistory::lookup(const Frame& frame,
+                                                   uint32_t networkId)
+{
+    auto it = std::lower_bound(frame.hitboxes.begin(), frame.hitboxes.end(),
+                               networkId,
+                               [](const Hitbox& hitbox, uint32_t id) {
+                                   return hitbox.networkId < id;
+                               });
+    if (it == frame.hitboxes.end() || it->networkId != networkId) {
+        return nullptr;
+    }
+    return &*it;
+}
+
+bool HitboxHistory::find(uint32_t networkId, float time, Position& position,
+                         BoundingBox& box) const
+{
+    if (_frameCount == 0) {
+        return false;
+    }
+
+    // Newest frame recorded at or before time (oldest one if none)
+    size_t age = 0;
+    while (age + 1 < _frameCount && frameAt(age).time > time) {
+        age++;
+    }
+
+    const Frame& before = frameAt(age);
+    const Hitbox* past = lookup(before, networkId);
+    if (!past) {
+        return false;
+    }
+
+    position.x = past->x;
+    position.y = past->y;
+    box.width = past->width;
+    box.height = past->height;
+    box.offsetX = past->offsetX;
+    box.offsetY = past->offsetY;
+
+    if (age == 0 || before.time >= time) {
+        return true;
+    }
+
+    const Frame& after = frameAt(age - 1);
+    const Hitbox* next = lookup(after, networkId);
+    float span = after.time - before.time;
+    if (next && span > 0.0f) {
+        float t = (time - before.time) / span;
+        position.x += (next->x - past->x) * t;
+        position.y += (next->y - past->y) * t;
+    }
+    return true;
+}
+
+}  // namespace engine
@@ -0,0 +1,90 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** HitboxHistory
+*/
+
+#pragma once
+
+#include <array>
+#include <vector>
+
+#include "../component/GameComponents.hpp"
+#include "../entity/EntityManager.hpp"
+
+namespace engine {
+
+/**
+ * @brief Short history of hittable entity hitboxes for lag compensation
+ *
+ * Once per tick the positions and bounding boxes of every Enemy, Boss and
+ * BossPart are copied into a fixed ring of frames. Hit detection can then ask
+ * where a target was at an earlier server time, i.e. where a lagging player
+ * saw it. Frames reuse their storage, so recording a few hundred entities
+ * per tick is a sorted copy with no allocation once warmed up.
+ *
+ * Entries are keyed by NetworkEntity ID: unlike EntityIds, those are never
+ * recycled while a match runs, so a stale frame cannot alias a new entity.
+ */
+class HitboxHistory {
+   public:
+    static constexpr size_t MAX_FRAMES = 64;  ///< ~1 s at 60 ticks per second
+
+    /**
+     * @brief Snapshot all hittable entities at the given time
+     * @param time Monotonic server time in seconds
+     * @param entityManager World to copy from
+     */
+    void record(float time, EntityManager& entityManager);
+
+    /**
+     * @brief Get an entity's hitbox at a past time
+     *
+     * Positions are interpolated between the two recorded frames around
+     * time. Times older than the history clamp to the oldest frame.
+     *
+     * @param networkId NetworkEntity ID of the entity
+     * @param time Server time to rewind to
+     * @param position Receives the past position
+     * @param box Receives the past bounding box
+     * @return false if the entity is not in the history
+     */
+    bool find(uint32_t networkId, float time, Position& position,
+              BoundingBox& box) const;
+
+    /**
+     * @brief Drop all recorded frames
+     */
+    void clear() { _frameCount = 0; }
+
+    size_t getFrameCount() const { return _frameCount; }
+
+   private:
+    struct Hitbox {
+        uint32_t networkId;
+        float x;
+        float y;
+        float width;
+        float height;
+        float offsetX;
+        float offsetY;
+    };
+
+    struct Frame {
+        float time = 0.0f;
+        std::vector<Hitbox> hitboxes;  ///< Sorted by networkId
+    };
+
+    template <typename Tag>
+    void recordAll(EntityManager& entityManager, Frame& frame);
+
+    const Frame& frameAt(size_t age) const;
+    static const Hitbox* lookup(const Frame& frame, uint32_t networkId);
+
+    std::array<Frame, MAX_FRAMES> _frames;
+    size_t _newest = 0;
+    size_t _frameCount = 0;
+};
+
+}  // namespace engine
@@ -17,4 +17,6 @@ void ISystem::initialize([[maybe_unused]] EntityManager& entityManager) {}
 
 void ISystem::cleanup([[maybe_unused]] EntityManager& entityManager) {}
 
+void ISystem::setRandomSeed([[maybe_unused]] uint32_t seed) {}
+
 }  // namespace engine
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <string>
@@ -82,6 +83,12 @@ class ISystem {
      * @param entityManager Reference to the entity manager
      */
     virtual void cleanup(EntityManager& entityManager);
+
+    /**
+     * @brief Reseed the system's random number generator, if it has one
+     * @param seed Seed drawn by GameLoop::setRandomSeed
+     */
+    virtual void setRandomSeed(uint32_t seed);
 };
 
 /**
@@ -0,0 +1,119 @@
+/*
+** EPITECH PROJECT, 2025
+** R-TYPE
+** File description:
+** WorkerPool
+*/
+
+#include "WorkerPool.hpp"
+
+#include <exception>
+#include <string>
+
+#include "../../../common/utils/Logger.hpp"
+
+namespace engine {
+
+WorkerPool::WorkerPool(size_t threadCount)
+{
+    _threads.reserve(threadCount);
+    for (size_t i = 0; i < threadCount; ++i) {
+        _threads.emplace_back(&WorkerPool::workerLoop, this);
+    }
+}
+
+WorkerPool::~WorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stopping = true;
+    }
+    _wakeCondition.notify_all();
+
+    for (auto& thread : _threads) {
+        if (thread.joinable()) {
+            thread.join();
+        }
+    }
+}
+
+void WorkerPool::parallelFor(size_t count,
+                             const std::function<void(size_t)>& job)
+{
+    if (count == 0) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> submitLock(_submitMutex);
+
+    if (_threads.empty() || count == 1) {
+        _nextIndex.store(0);
+        drain(job, count);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _job = &job;
+        _jobCount = count;
+        _nextIndex.store(0);
+        _activeWorkers = _threads.size();
+        _generation++;
+    }
+    _wakeCondition.notify_all();
+
+    drain(job, count);
+
+    std::unique_lock<std::mutex> lock(_mutex);
+    _doneCondition.wait(lock, [this] { return _activeWorkers == 0; });
+    _job = nullptr;
+    _jobCount = 0;
+}
+
+void WorkerPool::workerLoop()
+{
+    uint64_t seenGeneration = 0;
+
+    while (true) {
+        const std::function<void(size_t)>* job = nullptr;
+        size_t count = 0;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _wakeCondition.wait(lock, [this, seenGeneration] {
+                return _stopping || _generation != seenGeneration;
+            });
+            if (_stopping) {
+                return;
+            }
+            seenGeneration = _generation;
+            job = _job;
+            count = _jobCount;
+        }
+
+        drain(*job, count);
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (--_activeWorkers == 0) {
+                _doneCondition.notify_all();
+            }
+        }
+    }
+}
+
+void WorkerPool::drain(const std::function<void(size_t)>& job, size_t count)
+{
+    size_t index;
+    while ((index = _nextIndex.fetch_add(1)) < count) {
+        try {
+            job(index);
+        } catch (const std::exception& e) {
+            Logger::getInstance().log(
+                "Work item " + std::to_string(index) +
+                    " threw: " + std::string(e.what()),
+                LogLevel::ERROR_L, "WorkerPool");
+        }
+    }
+}
+
+}  // namespace engine
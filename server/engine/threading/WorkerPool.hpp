@@ -0,0 +1,74 @@
+/*
+** EPITECH PROJECT, 2025
+** R-TYPE
+** File description:
+** WorkerPool
+*/
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace engine {
+
+/**
+ * @brief Fixed-size pool of worker threads for fork/join work
+ *
+ * Used to schedule many independent simulations (e.g. one GameLoop per room)
+ * on a bounded number of threads instead of one thread per simulation.
+ * Work items are claimed dynamically, so a slow item does not hold back the
+ * items queued behind it.
+ */
+class WorkerPool {
+   private:
+    std::vector<std::thread> _threads;
+    std::mutex _mutex;
+    std::condition_variable _wakeCondition;
+    std::condition_variable _doneCondition;
+
+    const std::function<void(size_t)>* _job = nullptr;
+    size_t _jobCount = 0;
+    std::atomic<size_t> _nextIndex{0};
+    size_t _activeWorkers = 0;
+    uint64_t _generation = 0;
+    bool _stopping = false;
+
+    std::mutex _submitMutex;  ///< Serializes parallelFor() callers
+
+    void workerLoop();
+    void drain(const std::function<void(size_t)>& job, size_t count);
+
+   public:
+    /**
+     * @brief Create the pool
+     * @param threadCount Number of worker threads. The thread calling
+     *        parallelFor() also runs work, so 0 means "caller only"
+     */
+    explicit WorkerPool(size_t threadCount);
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    /**
+     * @brief Get the number of worker threads (excluding the caller)
+     */
+    size_t getThreadCount() const { return _threads.size(); }
+
+    /**
+     * @brief Run job(i) for every i in [0, count) and wait for completion
+     * @param count Number of work items
+     * @param job Function called once per item, from any pool thread
+     * @note Exceptions thrown by job are logged and swallowed
+     */
+    void parallelFor(size_t count, const std::function<void(size_t)>& job);
+};
+
+}  // namespace engine
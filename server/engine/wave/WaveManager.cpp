@@ -477,6 +477,8 @@ std::string WaveManager::getName() const { return "WaveManager"; }
 
 int WaveManager::getPriority() const { return 5; }
 
+void WaveManager::setRandomSeed(uint32_t seed) { _rng.seed(seed); }
+
 void WaveManager::onEnemyDestroyed()
 {
     if (_enemiesAliveInWave > 0) {
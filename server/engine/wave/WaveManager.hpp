@@ -156,6 +156,7 @@ class WaveManager : public ISystem {
      */
     std::string getName() const override;
     int getPriority() const override;
+    void setRandomSeed(uint32_t seed) override;
 
     /**
      * @brief Notify that an enemy was destroyed
@@ -11,9 +11,13 @@
 
 #include "../common/utils/Logger.hpp"
 #include "GameServer.hpp"
+#include "RoomManager.hpp"
 #include "ServerConfig.hpp"
+#include "SpectatorRelay.hpp"
 
 static rtype::GameServer* g_serverInstance = nullptr;
+static rtype::RoomManager* g_roomManagerInstance = nullptr;
+static rtype::SpectatorRelay* g_relayInstance = nullptr;
 
 void signalHandler(int signal)
 {
@@ -24,6 +28,12 @@ void signalHandler(int signal)
         if (g_serverInstance) {
             g_serverInstance->stop();
         }
+        if (g_roomManagerInstance) {
+            g_roomManagerInstance->stop();
+        }
+        if (g_relayInstance) {
+            g_relayInstance->stop();
+        }
     }
 }
 
@@ -47,9 +57,75 @@ int main()
               << std::endl;
     std::cout << "  Friendly Fire: "
               << (settings.friendlyFire ? "Enabled" : "Disabled") << std::endl;
+    if (settings.maxRooms > 0) {
+        std::cout << "  Rooms: up to " << settings.maxRooms << std::endl;
+    }
+    if (settings.maxSpectators > 0) {
+        std::cout << "  Spectators: up to " << settings.maxSpectators << " ("
+                  << settings.spectatorDelayMs << " ms behind)" << std::endl;
+    }
+    if (config.isRelayEnabled()) {
+        std::cout << "  Relay of: " << settings.relayHost << ":"
+                  << settings.relayPort << " (room " << settings.relayRoom
+                  << ")" << std::endl;
+    }
     std::cout << "  Press Ctrl+C to stop the server" << std::endl;
     std::cout << "========================================" << std::endl;
 
+    if (config.isRelayEnabled()) {
+        try {
+            rtype::SpectatorRelay relay(
+                settings.relayHost, settings.relayPort, config.getRelayRoom(),
+                static_cast<size_t>(settings.maxSpectators), 30);
+            g_relayInstance = &relay;
+
+            if (!relay.start(settings.serverPort)) {
+                Logger::getInstance().log("Failed to start relay",
+                                          LogLevel::ERROR_L, "Error");
+                g_relayInstance = nullptr;
+                return 1;
+            }
+            relay.run();
+            g_relayInstance = nullptr;
+        } catch (const std::exception& e) {
+            Logger::getInstance().log(
+                "Unhandled exception: " + std::string(e.what()),
+                LogLevel::CRITICAL_L, "FATAL");
+            return 84;
+        }
+
+        Logger::getInstance().log("Shutdown complete", LogLevel::INFO_L,
+                                  "Server");
+        return 0;
+    }
+
+    if (settings.maxRooms > 0) {
+        try {
+            rtype::RoomManager rooms(
+                static_cast<size_t>(settings.maxRooms),
+                static_cast<size_t>(settings.roomWorkers), 60.0f, 30);
+            g_roomManagerInstance = &rooms;
+
+            if (!rooms.start(settings.serverPort)) {
+                Logger::getInstance().log("Failed to start server",
+                                          LogLevel::ERROR_L, "Error");
+                g_roomManagerInstance = nullptr;
+                return 1;
+            }
+            rooms.run();
+            g_roomManagerInstance = nullptr;
+        } catch (const std::exception& e) {
+            Logger::getInstance().log(
+                "Unhandled exception: " + std::string(e.what()),
+                LogLevel::CRITICAL_L, "FATAL");
+            return 84;
+        }
+
+        Logger::getInstance().log("Shutdown complete", LogLevel::INFO_L,
+                                  "Server");
+        return 0;
+    }
+
     try {
         rtype::GameServer server(60.0f, 30);
         g_serverInstance = &server;
@@ -7,17 +7,41 @@
 
 #include "NetworkServer.hpp"
 
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <string_view>
+
+#ifdef __linux__
+#include <netinet/udp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#endif
+
 #include "../../common/utils/Logger.hpp"
+#include "common/replay/ReplayFormat.hpp"
 
 namespace rtype {
 
+#ifdef __linux__
+using ReusePortOption =
+    boost::asio::detail::socket_option::boolean<SOL_SOCKET, SO_REUSEPORT>;
+#endif
+
 NetworkServer::NetworkServer(uint32_t timeoutSeconds)
     : _socket(_ioContext),
       _running(false),
       _state(NetworkState::Disconnected),
-      _nextClientId(1),
+      _receiveThreadCount(1),
+      _batchedSend(false),
+      _gsoSupported(false),
+      _maxSpectators(0),
+      _spectatorDelay(std::chrono::seconds(2)),
+      _spectatorCount(0),
       _timeoutDuration(timeoutSeconds)
 {
+    _shards.push_back(std::make_unique<SessionShard>());
 }
 
 NetworkServer::~NetworkServer() { stop(); }
@@ -26,27 +50,75 @@ bool NetworkServer::start(uint16_t port)
 {
     if (_running) return true;
 
+    const bool batched = isBatchedReceiveEnabled();
+
     try {
         _socket.open(boost::asio::ip::udp::v4());
+#ifdef __linux__
+        if (batched) _socket.set_option(ReusePortOption(true));
+#endif
         _socket.bind(
             boost::asio::ip::udp::endpoint(boost::asio::ip::udp::v4(), port));
+
+#ifdef __linux__
+        if (batched) {
+            const uint16_t boundPort = _socket.local_endpoint().port();
+            for (size_t i = 1; i < _receiveThreadCount; ++i) {
+                auto socket =
+                    std::make_unique<boost::asio::ip::udp::socket>(_ioContext);
+                socket->open(boost::asio::ip::udp::v4());
+                socket->set_option(ReusePortOption(true));
+                socket->bind(boost::asio::ip::udp::endpoint(
+                    boost::asio::ip::udp::v4(), boundPort));
+                _receiveSockets.push_back(std::move(socket));
+            }
+        }
+#endif
     } catch (const std::exception& e) {
         Logger::getInstance().log(
             "Failed to bind port " + std::to_string(port) + ": " + e.what(),
             LogLevel::ERROR_L, "NetworkServer");
 
+        _receiveSockets.clear();
         _state = NetworkState::Error;
         if (_onError) _onError(e.what());
         return false;
     }
 
+#ifdef __linux__
+    if (_batchedSend) {
+        int segmentSize = 0;
+        socklen_t optionLength = sizeof(segmentSize);
+        _gsoSupported = ::getsockopt(_socket.native_handle(), SOL_UDP,
+                                     UDP_SEGMENT, &segmentSize,
+                                     &optionLength) == 0;
+    }
+#endif
+
     _running = true;
     _state = NetworkState::Connected;
-    startReceive();
+
+    if (batched) {
+        _workGuard.emplace(boost::asio::make_work_guard(_ioContext));
+        _receiveThreads.emplace_back(&NetworkServer::runBatchedReceiveLoop,
+                                     this, _socket.native_handle());
+        for (auto& socket : _receiveSockets) {
+            _receiveThreads.emplace_back(&NetworkServer::runBatchedReceiveLoop,
+                                         this, socket->native_handle());
+        }
+    } else {
+        startReceive();
+    }
 
     _networkThread = std::thread(&NetworkServer::runNetworkLoop, this);
-    Logger::getInstance().log("Server started on port " + std::to_string(port),
-                              LogLevel::INFO_L, "NetworkServer");
+    Logger::getInstance().log(
+        "Server started on port " + std::to_string(port) + " (" +
+            std::to_string(batched ? _receiveThreadCount : 1) +
+            " receive thread(s), " +
+            (_batchedSend ? (_gsoSupported ? "sendmmsg+GSO" : "sendmmsg")
+                          : "async") +
+            " send)",
+        LogLevel::INFO_L, "NetworkServer");
     return true;
 }
 
@@ -56,16 +128,45 @@ void NetworkServer::stop()
 
     _running = false;
     _state = NetworkState::Disconnected;
+    _workGuard.reset();
     _ioContext.stop();
 
     if (_networkThread.joinable()) _networkThread.join();
 
+    for (auto& thread : _receiveThreads) {
+        if (thread.joinable()) thread.join();
+    }
+    _receiveThreads.clear();
+
+    for (auto& socket : _receiveSockets) {
+        if (socket->is_open()) socket->close();
+    }
+    _receiveSockets.clear();
+
     if (_socket.is_open()) _socket.close();
 
     {
-        std::lock_guard<std::mutex> lock(_clientsMutex);
-        _sessions.clear();
-        _endpointToId.clear();
+        std::lock_guard<std::mutex> lock(_egressMutex);
+        _egressQueue.clear();
+        _egressIndex.clear();
+    }
+
+    for (auto& shard : _shards) {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        shard->sessions.clear();
+        shard->endpointToId.clear();
+    }
+
+    // publishToSpectators() may be running: empty the feeds, keep them
+    {
+        std::lock_guard<std::mutex> lock(_spectatorMutex);
+        for (auto& [roomId, feed] : _spectatorFeeds) {
+            std::lock_guard<std::mutex> feedLock(feed->mutex);
+            feed->chunks.clear();
+            feed->spectators.clear();
+            feed->state.clear();
+        }
+        _spectatorCount = 0;
     }
 
     Logger::getInstance().log("Network stopped.", LogLevel::INFO_L,
@@ -111,6 +212,9 @@ void NetworkServer::update()
                 break;
         }
     }
+
+    releaseSpectatorPackets();
+    flush();
 }
 
 void NetworkServer::checkTimeouts()
@@ -118,9 +222,9 @@ void NetworkServer::checkTimeouts()
     auto now = std::chrono::steady_clock::now();
     std::vector<uint32_t> timedOutClients;
 
-    {
-        std::lock_guard<std::mutex> lock(_clientsMutex);
-        for (const auto& pair : _sessions) {
+    for (auto& shard : _shards) {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        for (const auto& pair : shard->sessions) {
             auto elapsed = std::chrono::duration_cast<std::chrono::seconds>(
                 now - pair.second.lastActivity);
 
@@ -144,10 +248,10 @@ void NetworkServer::resendPendingPackets()
     auto now = std::chrono::steady_clock::now();
     std::vector<uint32_t> clientsToDisconnect;
 
-    {
-        std::lock_guard<std::mutex> lock(_clientsMutex);
+    for (auto& shard : _shards) {
+        std::lock_guard<std::mutex> lock(shard->mutex);
 
-        for (auto& pair : _sessions) {
+        for (auto& pair : shard->sessions) {
             auto& session = pair.second;
             for (auto& packet : session.pendingPackets) {
                 auto elapsed =
@@ -156,8 +260,7 @@ void NetworkServer::resendPendingPackets()
 
                 if (elapsed.count() >= 1000) {
                     if (packet.retryCount < 5) {
-                        sendToEndpoint(session.endpoint, packet.data.data(),
-                                       packet.data.size(), false, nullptr);
+                        sendBuffer(session.endpoint, packet.data);
                         packet.lastSentTime = now;
                         packet.retryCount++;
                     } else {
@@ -177,11 +280,14 @@ void NetworkServer::resendPendingPackets()
 void NetworkServer::disconnectClient(uint32_t clientId,
                                      const std::string& reason)
 {
+    bool isSpectator = false;
+    uint16_t spectatedRoom = 0;
     {
-        std::lock_guard<std::mutex> lock(_clientsMutex);
+        SessionShard& shard = getShardForId(clientId);
+        std::lock_guard<std::mutex> lock(shard.mutex);
 
-        auto it = _sessions.find(clientId);
-        if (it == _sessions.end()) {
+        auto it = shard.sessions.find(clientId);
+        if (it == shard.sessions.end()) {
             return;
         }
 
@@ -190,14 +296,20 @@ void NetworkServer::disconnectClient(uint32_t clientId,
                                       " (reason: " + reason + ")",
                                   LogLevel::INFO_L, "NetworkServer");
 
-        _endpointToId.erase(it->second.endpoint);
-        _sessions.erase(it);
+        isSpectator = it->second.isSpectator;
+        spectatedRoom = it->second.spectatedRoom;
+        shard.endpointToId.erase(it->second.endpoint);
+        shard.sessions.erase(it);
 
         NetworkEvent event;
         event.type = EventType::Disconnect;
         event.clientId = clientId;
         pushEvent(event);
     }
+
+    if (isSpectator) {
+        removeSpectator(clientId, spectatedRoom);
+    }
 }
 
 void NetworkServer::setTimeoutDuration(uint32_t seconds)
@@ -208,6 +320,82 @@ void NetworkServer::setTimeoutDuration(uint32_t seconds)
         LogLevel::INFO_L, "NetworkServer");
 }
 
+void NetworkServer::setReceiveThreads(size_t count)
+{
+    if (_running) return;
+
+    _receiveThreadCount = std::clamp<size_t>(count, 1, MAX_RECEIVE_THREADS);
+#ifndef __linux__
+    if (_receiveThreadCount > 1) {
+        Logger::getInstance().log(
+            "Batched receive is only available on Linux, using a single "
+            "receive thread",
+            LogLevel::WARNING_L, "NetworkServer");
+    }
+#endif
+
+    const size_t shardCount =
+        isBatchedReceiveEnabled() ? _receiveThreadCount : 1;
+    _shards.clear();
+    for (size_t i = 0; i < shardCount; ++i) {
+        _shards.push_back(std::make_unique<SessionShard>());
+    }
+}
+
+size_t NetworkServer::getReceiveThreads() const { return _receiveThreadCount; }
+
+bool NetworkServer::isBatchedReceiveEnabled() const
+{
+#ifdef __linux__
+    return _receiveThreadCount > 1;
+#else
+    return false;
+#endif
+}
+
+void NetworkServer::setBatchedSend(bool enabled)
+{
+    if (_running) return;
+
+#ifdef __linux__
+    _batchedSend = enabled;
+#else
+    if (enabled) {
+        Logger::getInstance().log(
+            "Batched send is only available on Linux, using async sends",
+            LogLevel::WARNING_L, "NetworkServer");
+    }
+#endif
+}
+
+bool NetworkServer::isBatchedSendEnabled() const { return _batchedSend; }
+
+float NetworkServer::getClientRtt(uint32_t clientId)
+{
+    SessionShard& shard = getShardForId(clientId);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.sessions.find(clientId);
+    return it != shard.sessions.end() ? it->second.smoothedRtt : 0.0f;
+}
+
+void NetworkServer::updateRtt(ClientSession& session, const AckPacket& ack)
+{
+    for (const auto& packet : session.pendingPackets) {
+        if (packet.sequenceId != ack.ackedSequenceId) continue;
+
+        // A retransmitted packet's ACK cannot be matched to one send
+        if (packet.retryCount > 0) return;
+
+        auto elapsed = std::chrono::steady_clock::now() - packet.lastSentTime;
+        float sample = std::chrono::duration<float>(elapsed).count();
+        session.smoothedRtt = session.smoothedRtt == 0.0f
+                                  ? sample
+                                  : session.smoothedRtt * 0.875f +
+                                        sample * 0.125f;
+        return;
+    }
+}
+
 void NetworkServer::setOnErrorCallback(
     std::function<void(const std::string&)> callback)
 {
@@ -265,6 +453,65 @@ void NetworkServer::handleReceive(const boost::system::error_code& error,
     }
 }
 
+void NetworkServer::runBatchedReceiveLoop(
+    boost::asio::ip::udp::socket::native_handle_type socketHandle)
+{
+#ifdef __linux__
+    std::vector<std::array<uint8_t, RECEIVE_BUFFER_SIZE>> buffers(
+        RECEIVE_BATCH_SIZE);
+    std::array<mmsghdr, RECEIVE_BATCH_SIZE> messages{};
+    std::array<iovec, RECEIVE_BATCH_SIZE> iovecs{};
+    std::array<sockaddr_storage, RECEIVE_BATCH_SIZE> addresses{};
+
+    for (size_t i = 0; i < RECEIVE_BATCH_SIZE; ++i) {
+        iovecs[i].iov_base = buffers[i].data();
+        iovecs[i].iov_len = buffers[i].size();
+        messages[i].msg_hdr.msg_iov = &iovecs[i];
+        messages[i].msg_hdr.msg_iovlen = 1;
+        messages[i].msg_hdr.msg_name = &addresses[i];
+    }
+
+    const int pollTimeoutMs = 100;
+    while (_running) {
+        pollfd pfd{socketHandle, POLLIN, 0};
+        if (::poll(&pfd, 1, pollTimeoutMs) <= 0) continue;
+
+        for (auto& message : messages) {
+            message.msg_hdr.msg_namelen = sizeof(sockaddr_storage);
+        }
+
+        int received = ::recvmmsg(socketHandle, messages.data(),
+                                  RECEIVE_BATCH_SIZE, MSG_DONTWAIT, nullptr);
+        if (received < 0) {
+            if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR &&
+                _running) {
+                Logger::getInstance().log(
+                    "recvmmsg error: " + std::string(std::strerror(errno)),
+                    LogLevel::ERROR_L, "NetworkServer");
+            }
+            continue;
+        }
+
+        for (int i = 0; i < received; ++i) {
+            boost::asio::ip::udp::endpoint sender;
+            std::memcpy(sender.data(), &addresses[i],
+                        messages[i].msg_hdr.msg_namelen);
+            sender.resize(messages[i].msg_hdr.msg_namelen);
+
+            try {
+                processPacket(buffers[i].data(), messages[i].msg_len, sender);
+            } catch (const std::exception& e) {
+                Logger::getInstance().log(
+                    "Error processing packet: " + std::string(e.what()),
+                    LogLevel::ERROR_L, "NetworkServer");
+            }
+        }
+    }
+#else
+    (void)socketHandle;
+#endif
+}
+
 void NetworkServer::processPacket(const uint8_t* data, size_t size,
                                   const boost::asio::ip::udp::endpoint& sender)
 {
@@ -273,13 +520,15 @@ void NetworkServer::processPacket(const uint8_t* data, size_t size,
     const Header* header = reinterpret_cast<const Header*>(data);
     if (size < header->packetSize) return;
 
+    const size_t shardIndex = getShardIndexForEndpoint(sender);
+    SessionShard& shard = *_shards[shardIndex];
     ClientSession* session = nullptr;
     bool isNewClient = false;
     {
-        std::lock_guard<std::mutex> lock(_clientsMutex);
-        session = getSessionByEndpoint(sender);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        session = getSessionByEndpoint(shard, sender);
         if (!session) {
-            uint32_t newId = getNextClientId();
+            uint32_t newId = getNextClientId(shardIndex);
             ClientSession newSession;
             newSession.clientId = newId;
             newSession.endpoint = sender;
@@ -288,9 +537,9 @@ void NetworkServer::processPacket(const uint8_t* data, size_t size,
             newSession.lastActivity = std::chrono::steady_clock::now();
             newSession.nextSequenceId = 1;
 
-            _sessions[newId] = newSession;
-            _endpointToId[sender] = newId;
-            session = &_sessions[newId];
+            shard.sessions[newId] = newSession;
+            shard.endpointToId[sender] = newId;
+            session = &shard.sessions[newId];
             isNewClient = true;
         } else {
             session->lastActivity = std::chrono::steady_clock::now();
@@ -308,14 +557,18 @@ void NetworkServer::processPacket(const uint8_t* data, size_t size,
 
     switch (static_cast<OpCode>(header->opCode)) {
         case OpCode::C2S_LOGIN:
-            if (size >= sizeof(LoginPacket)) {
+            // Clients predating rooms send no roomId: they join room 0
+            if (size >= offsetof(LoginPacket, roomId) &&
+                !session->isSpectator) {
                 NetworkEvent event;
                 event.type = EventType::Login;
                 event.clientId = session->clientId;
-                event.loginPacket = *reinterpret_cast<const LoginPacket*>(data);
+                event.loginPacket = LoginPacket{};
+                std::memcpy(&event.loginPacket, data,
+                            std::min(size, sizeof(LoginPacket)));
 
                 {
-                    std::lock_guard<std::mutex> lock(_clientsMutex);
+                    std::lock_guard<std::mutex> lock(shard.mutex);
                     session->username =
                         std::string(event.loginPacket.username,
                                     strnlen(event.loginPacket.username, 8));
@@ -344,6 +597,14 @@ void NetworkServer::processPacket(const uint8_t* data, size_t size,
             }
             break;
 
+        case OpCode::C2S_SPECTATE:
+            if (size >= sizeof(SpectatePacket) && !session->isAuthenticated) {
+                SpectatePacket request;
+                std::memcpy(&request, data, sizeof(request));
+                addSpectator(shard, session->clientId, request.roomId);
+            }
+            break;
+
         case OpCode::C2S_DISCONNECT:
             disconnectClient(session->clientId, "client request");
             break;
@@ -351,10 +612,11 @@ void NetworkServer::processPacket(const uint8_t* data, size_t size,
         case OpCode::C2S_ACK:
             if (size >= sizeof(AckPacket)) {
                 const AckPacket* ack = reinterpret_cast<const AckPacket*>(data);
-                std::lock_guard<std::mutex> lock(_clientsMutex);
+                std::lock_guard<std::mutex> lock(shard.mutex);
                 auto& pending = session->pendingPackets;
 
                 auto beforeSize = pending.size();
+                updateRtt(*session, *ack);
                 pending.erase(std::remove_if(
                                   pending.begin(), pending.end(),
                                   [ack](const ClientSession::PendingPacket& p) {
@@ -382,9 +644,10 @@ void NetworkServer::processPacket(const uint8_t* data, size_t size,
 bool NetworkServer::sendLoginResponse(uint32_t clientId, uint32_t playerId,
                                       uint16_t mapWidth, uint16_t mapHeight)
 {
-    std::lock_guard<std::mutex> lock(_clientsMutex);
-    auto it = _sessions.find(clientId);
-    if (it == _sessions.end()) return false;
+    SessionShard& shard = getShardForId(clientId);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.sessions.find(clientId);
+    if (it == shard.sessions.end()) return false;
 
     it->second.playerId = playerId;
     it->second.isAuthenticated = true;
@@ -404,9 +667,10 @@ bool NetworkServer::sendLoginResponse(uint32_t clientId, uint32_t playerId,
 
 bool NetworkServer::sendLoginRejected(uint32_t clientId, uint8_t reason)
 {
-    std::lock_guard<std::mutex> lock(_clientsMutex);
-    auto it = _sessions.find(clientId);
-    if (it == _sessions.end()) return false;
+    SessionShard& shard = getShardForId(clientId);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.sessions.find(clientId);
+    if (it == shard.sessions.end()) return false;
 
     LoginRejectPacket packet;
     packet.header.opCode = OpCode::S2C_LOGIN_REJECTED;
@@ -548,33 +812,54 @@ bool NetworkServer::sendGameEvent(uint32_t clientId, uint8_t eventType,
     return true;
 }
 
+bool NetworkServer::sendInputAck(uint32_t clientId, uint32_t inputSequenceId,
+                                 float x, float y)
+{
+    InputAckPacket packet;
+    packet.header.opCode = OpCode::S2C_INPUT_ACK;
+    packet.header.packetSize = sizeof(InputAckPacket);
+    packet.header.sequenceId = 0;
+    packet.inputSequenceId = inputSequenceId;
+    packet.x = x;
+    packet.y = y;
+
+    sendToClient(&packet, sizeof(packet), clientId);
+    return true;
+}
+
 size_t NetworkServer::broadcast(const void* data, size_t size,
                                 uint32_t excludeClient, bool reliable)
 {
-    std::lock_guard<std::mutex> lock(_clientsMutex);
     size_t count = 0;
-    for (auto& session : _sessions) {
-        if (session.first != excludeClient && session.second.isAuthenticated) {
-            sendToEndpoint(session.second.endpoint, data, size, reliable,
-                           reliable ? &session.second : nullptr);
-            count++;
+    for (auto& shard : _shards) {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        for (auto& session : shard->sessions) {
+            if (session.first != excludeClient &&
+                session.second.isAuthenticated) {
+                sendToEndpoint(session.second.endpoint, data, size, reliable,
+                               reliable ? &session.second : nullptr);
+                count++;
+            }
         }
     }
+    publishToSpectators(0, data, size);
     return count;
 }
 
 std::vector<ClientInfo> NetworkServer::getConnectedClients() const
 {
-    std::lock_guard<std::mutex> lock(_clientsMutex);
     std::vector<ClientInfo> clients;
-    for (const auto& pair : _sessions) {
-        ClientInfo info;
-        info.clientId = pair.first;
-        info.address = pair.second.endpoint.address().to_string();
-        info.port = pair.second.endpoint.port();
-        info.username = pair.second.username;
-        info.playerId = pair.second.playerId;
-        clients.push_back(info);
+    for (const auto& shard : _shards) {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        for (const auto& pair : shard->sessions) {
+            ClientInfo info;
+            info.clientId = pair.first;
+            info.address = pair.second.endpoint.address().to_string();
+            info.port = pair.second.endpoint.port();
+            info.username = pair.second.username;
+            info.playerId = pair.second.playerId;
+            clients.push_back(info);
+        }
     }
     return clients;
 }
@@ -606,22 +891,45 @@ void NetworkServer::setOnClientStartGameCallback(
 
 // --- Helpers ---
 
-uint32_t NetworkServer::getNextClientId() { return _nextClientId++; }
+uint32_t NetworkServer::getNextClientId(size_t shardIndex)
+{
+    SessionShard& shard = *_shards[shardIndex];
+    uint32_t localId = shard.nextLocalId++;
+    return localId * static_cast<uint32_t>(_shards.size()) +
+           static_cast<uint32_t>(shardIndex) + 1;
+}
+
+size_t NetworkServer::getShardIndexForEndpoint(
+    const boost::asio::ip::udp::endpoint& endpoint) const
+{
+    if (_shards.size() == 1) return 0;
+
+    std::string_view raw(reinterpret_cast<const char*>(endpoint.data()),
+                         endpoint.size());
+    return std::hash<std::string_view>{}(raw) % _shards.size();
+}
+
+NetworkServer::SessionShard& NetworkServer::getShardForId(uint32_t clientId)
+{
+    if (clientId == 0) return *_shards.front();
+    return *_shards[(clientId - 1) % _shards.size()];
+}
 
 ClientSession* NetworkServer::getSessionByEndpoint(
-    const boost::asio::ip::udp::endpoint& endpoint)
+    SessionShard& shard, const boost::asio::ip::udp::endpoint& endpoint)
 {
-    auto it = _endpointToId.find(endpoint);
-    if (it != _endpointToId.end()) {
-        return &_sessions[it->second];
+    auto it = shard.endpointToId.find(endpoint);
+    if (it != shard.endpointToId.end()) {
+        return &shard.sessions[it->second];
     }
     return nullptr;
 }
 
 ClientSession* NetworkServer::getSessionById(uint32_t id)
 {
-    auto it = _sessions.find(id);
-    if (it != _sessions.end()) {
+    SessionShard& shard = getShardForId(id);
+    auto it = shard.sessions.find(id);
+    if (it != shard.sessions.end()) {
         return &it->second;
     }
     return nullptr;
@@ -631,11 +939,22 @@ void NetworkServer::sendToEndpoint(
     const boost::asio::ip::udp::endpoint& endpoint, const void* data,
     size_t size, bool reliable, ClientSession* session)
 {
+    if (!reliable && _batchedSend) {
+        queueDatagram(endpoint, data, size);
+        return;
+    }
+
+    PacketBuffer buffer = _packetPool.acquire(data, size);
+    if (!buffer) {
+        Logger::getInstance().log(
+            "Dropping oversized packet (" + std::to_string(size) + " bytes)",
+            LogLevel::WARNING_L, "NetworkServer");
+        return;
+    }
+
     if (reliable && session) {
         uint32_t seqId = session->nextSequenceId++;
 
-        std::vector<uint8_t> buffer(static_cast<const uint8_t*>(data),
-                                    static_cast<const uint8_t*>(data) + size);
         Header* header = reinterpret_cast<Header*>(buffer.data());
         header->sequenceId = seqId;
 
@@ -645,26 +964,426 @@ void NetworkServer::sendToEndpoint(
         pending.lastSentTime = std::chrono::steady_clock::now();
         pending.retryCount = 0;
 
-        session->pendingPackets.push_back(pending);
+        session->pendingPackets.push_back(std::move(pending));
+    }
 
-        _socket.async_send_to(boost::asio::buffer(buffer), endpoint,
-                              [](const boost::system::error_code&, size_t) {});
-    } else {
-        _socket.async_send_to(boost::asio::buffer(data, size), endpoint,
-                              [](const boost::system::error_code&, size_t) {});
+    sendBuffer(endpoint, buffer);
+}
+
+void NetworkServer::sendBuffer(const boost::asio::ip::udp::endpoint& endpoint,
+                               const PacketBuffer& buffer)
+{
+    if (_batchedSend) {
+        queueDatagram(endpoint, buffer.data(), buffer.size());
+        return;
     }
+
+    _socket.async_send_to(
+        boost::asio::buffer(buffer.data(), buffer.size()), endpoint,
+        [buffer](const boost::system::error_code&, size_t) {});
+}
+
+void NetworkServer::queueDatagram(
+    const boost::asio::ip::udp::endpoint& endpoint, const void* data,
+    size_t size)
+{
+    std::lock_guard<std::mutex> lock(_egressMutex);
+
+    auto [it, inserted] =
+        _egressIndex.try_emplace(endpoint, _egressQueue.size());
+    if (inserted) {
+        _egressQueue.push_back(EgressDestination{endpoint, {}, {}});
+    }
+    EgressDestination& destination = _egressQueue[it->second];
+
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    destination.bytes.insert(destination.bytes.end(), bytes, bytes + size);
+    destination.sizes.push_back(static_cast<uint16_t>(size));
+}
+
+size_t NetworkServer::EndpointHash::operator()(
+    const boost::asio::ip::udp::endpoint& endpoint) const
+{
+    std::string_view raw(reinterpret_cast<const char*>(endpoint.data()),
+                         endpoint.size());
+    return std::hash<std::string_view>{}(raw);
+}
+
+size_t NetworkServer::flush()
+{
+    if (!_batchedSend || !_running) return 0;
+
+#ifdef __linux__
+    std::lock_guard<std::mutex> flushLock(_flushMutex);
+    {
+        std::lock_guard<std::mutex> lock(_egressMutex);
+        std::swap(_egressQueue, _egressInFlight);
+        // The queue now holds the destinations kept from the previous flush
+        _egressIndex.clear();
+        for (size_t i = 0; i < _egressQueue.size(); ++i) {
+            _egressIndex.emplace(_egressQueue[i].endpoint, i);
+        }
+    }
+
+    struct OutgoingMessage {
+        iovec iov;
+        alignas(cmsghdr) char control[CMSG_SPACE(sizeof(uint16_t))];
+        const EgressDestination* destination;
+        uint16_t segmentSize;
+        size_t segmentCount;
+    };
+
+    std::vector<OutgoingMessage> outgoing;
+    size_t datagramCount = 0;
+    for (auto& destination : _egressInFlight) {
+        size_t offset = 0;
+        size_t index = 0;
+        while (index < destination.sizes.size()) {
+            const uint16_t segmentSize = destination.sizes[index];
+            size_t run = 1;
+            if (_gsoSupported) {
+                while (index + run < destination.sizes.size() &&
+                       destination.sizes[index + run] == segmentSize &&
+                       run < GSO_MAX_SEGMENTS &&
+                       (run + 1) * segmentSize <= GSO_MAX_BYTES) {
+                    run++;
+                }
+            }
+
+            OutgoingMessage message{};
+            message.iov.iov_base = destination.bytes.data() + offset;
+            message.iov.iov_len = run * segmentSize;
+            message.destination = &destination;
+            message.segmentSize = segmentSize;
+            message.segmentCount = run;
+            outgoing.push_back(message);
+
+            offset += run * segmentSize;
+            index += run;
+            datagramCount += run;
+        }
+    }
+
+    std::vector<mmsghdr> headers(outgoing.size());
+    for (size_t i = 0; i < outgoing.size(); ++i) {
+        auto& message = outgoing[i];
+        msghdr& header = headers[i].msg_hdr;
+        header.msg_name =
+            const_cast<sockaddr*>(message.destination->endpoint.data());
+        header.msg_namelen =
+            static_cast<socklen_t>(message.destination->endpoint.size());
+        header.msg_iov = &message.iov;
+        header.msg_iovlen = 1;
+
+        if (message.segmentCount > 1) {
+            header.msg_control = message.control;
+            header.msg_controllen = sizeof(message.control);
+            cmsghdr* cmsg = CMSG_FIRSTHDR(&header);
+            cmsg->cmsg_level = SOL_UDP;
+            cmsg->cmsg_type = UDP_SEGMENT;
+            cmsg->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+            std::memcpy(CMSG_DATA(cmsg), &message.segmentSize,
+                        sizeof(uint16_t));
+        }
+    }
+
+    const int socketHandle = _socket.native_handle();
+    size_t sent = 0;
+    while (sent < headers.size()) {
+        int result = ::sendmmsg(socketHandle, headers.data() + sent,
+                                static_cast<unsigned int>(
+                                    std::min<size_t>(headers.size() - sent,
+                                                     UIO_MAXIOV)),
+                                0);
+        if (result > 0) {
+            sent += static_cast<size_t>(result);
+            continue;
+        }
+
+        if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            pollfd pfd{socketHandle, POLLOUT, 0};
+            if (::poll(&pfd, 1, 5) > 0) continue;
+            Logger::getInstance().log(
+                "Send buffer full, dropping " +
+                    std::to_string(headers.size() - sent) + " message(s)",
+                LogLevel::WARNING_L, "NetworkServer");
+            break;
+        }
+
+        if (outgoing[sent].segmentCount > 1 && (errno == EIO ||
+                                                errno == EINVAL)) {
+            Logger::getInstance().log(
+                "UDP GSO rejected by the kernel, falling back to one "
+                "datagram per message",
+                LogLevel::WARNING_L, "NetworkServer");
+            _gsoSupported = false;
+
+            const auto& message = outgoing[sent];
+            const auto* bytes = static_cast<const uint8_t*>(
+                message.iov.iov_base);
+            for (size_t i = 0; i < message.segmentCount; ++i) {
+                ::sendto(socketHandle, bytes + i * message.segmentSize,
+                         message.segmentSize, 0,
+                         message.destination->endpoint.data(),
+                         static_cast<socklen_t>(
+                             message.destination->endpoint.size()));
+            }
+        } else {
+            Logger::getInstance().log(
+                "sendmmsg error: " + std::string(std::strerror(errno)),
+                LogLevel::ERROR_L, "NetworkServer");
+        }
+        sent++;
+    }
+
+    _egressInFlight.erase(
+        std::remove_if(_egressInFlight.begin(), _egressInFlight.end(),
+                       [](const EgressDestination& destination) {
+                           return destination.sizes.empty();
+                       }),
+        _egressInFlight.end());
+    for (auto& destination : _egressInFlight) {
+        destination.bytes.clear();
+        destination.sizes.clear();
+    }
+
+    return datagramCount;
+#else
+    return 0;
+#endif
 }
 
 void NetworkServer::sendToClient(const void* data, size_t size,
                                  uint32_t clientId)
 {
-    std::lock_guard<std::mutex> lock(_clientsMutex);
+    SessionShard& shard = getShardForId(clientId);
+    std::lock_guard<std::mutex> lock(shard.mutex);
     ClientSession* session = getSessionById(clientId);
     if (session) {
         sendToEndpoint(session->endpoint, data, size, false, nullptr);
     }
 }
 
+// --- Spectators ---
+
+void NetworkServer::setSpectators(size_t maxSpectators, float delaySeconds)
+{
+    if (_running) return;
+
+    _maxSpectators = maxSpectators;
+    _spectatorDelay = std::chrono::duration_cast<
+        std::chrono::steady_clock::duration>(
+        std::chrono::duration<float>(std::max(delaySeconds, 0.0f)));
+}
+
+size_t NetworkServer::getSpectatorCount() const { return _spectatorCount; }
+
+NetworkServer::SpectatorFeed& NetworkServer::getSpectatorFeed(uint16_t roomId)
+{
+    std::lock_guard<std::mutex> lock(_spectatorMutex);
+    auto& feed = _spectatorFeeds[roomId];
+    if (!feed) {
+        feed = std::make_unique<SpectatorFeed>();
+    }
+    return *feed;
+}
+
+void NetworkServer::publishToSpectators(uint16_t roomId, const void* data,
+                                        size_t size)
+{
+    // Every record must fit in one batch
+    const size_t maxSize = PacketBufferPool::BUFFER_SIZE -
+                           sizeof(SpectateBatchPacket) - sizeof(uint16_t);
+    if (_maxSpectators == 0 || size < sizeof(Header) || size > maxSize) {
+        return;
+    }
+
+    SpectatorFeed& feed = getSpectatorFeed(roomId);
+    auto now = std::chrono::steady_clock::now();
+
+    std::lock_guard<std::mutex> lock(feed.mutex);
+    if (feed.chunks.empty() ||
+        now - feed.chunks.back().publishedAt >= SPECTATOR_BATCH_INTERVAL) {
+        feed.chunks.push_back(SpectatorChunk{now, {}});
+    }
+
+    auto& records = feed.chunks.back().records;
+    uint16_t recordSize = static_cast<uint16_t>(size);
+    size_t offset = records.size();
+    records.resize(offset + sizeof(recordSize) + size);
+    std::memcpy(records.data() + offset, &recordSize, sizeof(recordSize));
+    std::memcpy(records.data() + offset + sizeof(recordSize), data, size);
+}
+
+void NetworkServer::addSpectator(SessionShard& shard, uint32_t clientId,
+                                 uint16_t roomId)
+{
+    boost::asio::ip::udp::endpoint endpoint;
+    bool wasSpectator = false;
+    uint16_t previousRoom = 0;
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.sessions.find(clientId);
+        if (it == shard.sessions.end()) return;
+
+        // Spectators repeat their request to stay connected
+        if (it->second.isSpectator && it->second.spectatedRoom == roomId) {
+            return;
+        }
+        endpoint = it->second.endpoint;
+        wasSpectator = it->second.isSpectator;
+        previousRoom = it->second.spectatedRoom;
+    }
+
+    if (wasSpectator) {
+        removeSpectator(clientId, previousRoom);
+    }
+    if (_spectatorCount.fetch_add(1) >= _maxSpectators) {
+        _spectatorCount--;
+        sendLoginRejected(clientId,
+                          static_cast<uint8_t>(RejectReason::NO_SPECTATORS));
+        return;
+    }
+
+    SpectatorFeed& feed = getSpectatorFeed(roomId);
+    {
+        std::lock_guard<std::mutex> lock(feed.mutex);
+        feed.spectators.push_back(Spectator{clientId, endpoint, true});
+    }
+
+    // The session may have timed out meanwhile: it is flagged only after
+    // joining the feed so that disconnectClient() always finds it there
+    bool connected = false;
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.sessions.find(clientId);
+        if (it != shard.sessions.end()) {
+            it->second.isSpectator = true;
+            it->second.spectatedRoom = roomId;
+            connected = true;
+        }
+    }
+    if (!connected) {
+        removeSpectator(clientId, roomId);
+        return;
+    }
+
+    Logger::getInstance().log("Client " + std::to_string(clientId) +
+                                  " is spectating room " +
+                                  std::to_string(roomId),
+                              LogLevel::INFO_L, "NetworkServer");
+}
+
+void NetworkServer::removeSpectator(uint32_t clientId, uint16_t roomId)
+{
+    SpectatorFeed& feed = getSpectatorFeed(roomId);
+    std::lock_guard<std::mutex> lock(feed.mutex);
+    auto it = std::find_if(feed.spectators.begin(), feed.spectators.end(),
+                           [clientId](const Spectator& spectator) {
+                               return spectator.clientId == clientId;
+                           });
+    if (it != feed.spectators.end()) {
+        feed.spectators.erase(it);
+        _spectatorCount--;
+    }
+}
+
+void NetworkServer::releaseSpectatorPackets()
+{
+    if (_maxSpectators == 0) return;
+
+    std::vector<SpectatorFeed*> feeds;
+    {
+        std::lock_guard<std::mutex> lock(_spectatorMutex);
+        for (auto& [roomId, feed] : _spectatorFeeds) {
+            feeds.push_back(feed.get());
+        }
+    }
+
+    // A packet published at the very end of a chunk still waits the delay
+    const auto wait = _spectatorDelay + SPECTATOR_BATCH_INTERVAL;
+    const auto now = std::chrono::steady_clock::now();
+
+    for (SpectatorFeed* feed : feeds) {
+        std::lock_guard<std::mutex> lock(feed->mutex);
+
+        // Periodic resync: a lost batch may hold a spawn or a death
+        if (now - feed->lastSnapshot >= SPECTATOR_SNAPSHOT_INTERVAL) {
+            feed->lastSnapshot = now;
+            for (auto& spectator : feed->spectators) {
+                spectator.needsSnapshot = true;
+            }
+        }
+
+        bool snapshotNeeded = false;
+        for (const auto& spectator : feed->spectators) {
+            snapshotNeeded = snapshotNeeded || spectator.needsSnapshot;
+        }
+        if (snapshotNeeded) {
+            std::vector<uint8_t> snapshot;
+            feed->state.appendKeyframe(snapshot);
+            sendSpectatorBatches(snapshot, feed->spectators, true);
+            for (auto& spectator : feed->spectators) {
+                spectator.needsSnapshot = false;
+            }
+        }
+
+        while (!feed->chunks.empty() &&
+               now - feed->chunks.front().publishedAt >= wait) {
+            const auto& records = feed->chunks.front().records;
+            replay::forEachKeyframePacket(
+                records.data(), records.size(),
+                [feed](const uint8_t* packet, size_t packetSize) {
+                    feed->state.apply(packet, packetSize);
+                });
+            sendSpectatorBatches(records, feed->spectators, false);
+            feed->chunks.pop_front();
+        }
+    }
+}
+
+void NetworkServer::sendSpectatorBatches(
+    const std::vector<uint8_t>& records,
+    const std::vector<Spectator>& spectators, bool snapshotOnly)
+{
+    if (spectators.empty()) return;
+
+    std::array<uint8_t, PacketBufferPool::BUFFER_SIZE> datagram;
+    size_t offset = 0;
+    while (offset < records.size()) {
+        // Whole records only: a batch is a valid keyframe payload
+        size_t end = offset;
+        while (end < records.size()) {
+            uint16_t recordSize;
+            std::memcpy(&recordSize, records.data() + end, sizeof(recordSize));
+            size_t next = end + sizeof(recordSize) + recordSize;
+            if (sizeof(SpectateBatchPacket) + next - offset > datagram.size()) {
+                break;
+            }
+            end = next;
+        }
+        if (end == offset) break;
+
+        SpectateBatchPacket batch;
+        batch.header.opCode = OpCode::S2C_SPECTATE_BATCH;
+        batch.header.packetSize =
+            static_cast<uint16_t>(sizeof(batch) + end - offset);
+        batch.header.sequenceId = 0;
+        std::memcpy(datagram.data(), &batch, sizeof(batch));
+        std::memcpy(datagram.data() + sizeof(batch), records.data() + offset,
+                    end - offset);
+
+        PacketBuffer buffer =
+            _packetPool.acquire(datagram.data(), batch.header.packetSize);
+        for (const auto& spectator : spectators) {
+            if (!snapshotOnly || spectator.needsSnapshot) {
+                sendBuffer(spectator.endpoint, buffer);
+            }
+        }
+        offset = end;
+    }
+}
+
 void NetworkServer::pushEvent(const NetworkEvent& event)
 {
     std::lock_guard<std::mutex> lock(_eventQueueMutex);
@@ -14,12 +14,17 @@
 #include <functional>
 #include <iostream>
 #include <map>
+#include <memory>
 #include <mutex>
+#include <optional>
 #include <thread>
+#include <unordered_map>
 #include <vector>
 
+#include "PacketBufferPool.hpp"
 #include "common/network/INetworkServer.hpp"
 #include "common/network/Protocol.hpp"
+#include "common/replay/ReplayState.hpp"
 #include "common/utils/Logger.hpp"
 
 namespace rtype {
@@ -46,8 +51,8 @@ struct ClientSession {
      * @brief Structure for tracking reliable packets that need acknowledgement.
      */
     struct PendingPacket {
-        uint32_t sequenceId;        ///< Sequence ID of the sent packet
-        std::vector<uint8_t> data;  ///< Raw packet data
+        uint32_t sequenceId;  ///< Sequence ID of the sent packet
+        PacketBuffer data;    ///< Raw packet data (shared with in-flight sends)
         std::chrono::steady_clock::time_point
             lastSentTime;  ///< Last transmission time
         int retryCount;    ///< Number of times this packet has been retried
@@ -56,6 +61,10 @@ struct ClientSession {
     std::vector<PendingPacket>
         pendingPackets;       ///< Queue of unacknowledged reliable packets
     uint32_t nextSequenceId;  ///< Next sequence ID to use for sending
+    float smoothedRtt = 0.0f;  ///< Round trip of reliable packets in seconds
+                               ///< (0 until the first ACK)
+    bool isSpectator = false;    ///< Watching a room, see C2S_SPECTATE
+    uint16_t spectatedRoom = 0;  ///< Room watched by a spectator
 };
 
 /**
@@ -70,6 +79,12 @@ struct ClientSession {
  * - Broadcasting to multiple clients
  * - Automatic timeout and disconnection of inactive clients
  * - Reliable packet delivery system (ACKs and retries)
+ * - Optional batched receive path (Linux only): several SO_REUSEPORT sockets
+ *   drained with recvmmsg() by dedicated worker threads
+ * - Optional batched egress path (Linux only): datagrams queued during a tick
+ *   are sent with sendmmsg(), coalesced with UDP GSO when available
+ * - Optional spectators: read-only clients fed a delayed, batched copy of a
+ *   room's packets
  *
  * @note All network operations run on a dedicated thread. The main game thread
  *       must call update() regularly to process queued network events.
@@ -275,6 +290,20 @@ class NetworkServer : public INetworkServer {
     bool sendGameEvent(uint32_t clientId, uint8_t eventType, uint8_t waveNumber,
                        uint8_t totalWaves, uint8_t levelId);
 
+    /**
+     * @brief Acknowledge the last input applied for a client
+     *
+     * Unreliable: a lost ack is superseded by the next frame's.
+     *
+     * @param clientId Client owning the inputs
+     * @param inputSequenceId Sequence ID of the last applied input packet
+     * @param x Player position after that input
+     * @param y Player position after that input
+     * @return true if sent successfully
+     */
+    bool sendInputAck(uint32_t clientId, uint32_t inputSequenceId, float x,
+                      float y);
+
     /**
      * @brief Broadcast raw data to all connected clients
      *
@@ -353,6 +382,118 @@ class NetworkServer : public INetworkServer {
      */
     void setTimeoutDuration(uint32_t seconds);
 
+    /**
+     * @brief Set the number of receive worker threads
+     *
+     * With more than one worker (Linux only), start() binds one SO_REUSEPORT
+     * socket per worker and each worker drains its socket in batches with
+     * recvmmsg(). Sessions are sharded by endpoint hash across as many shards
+     * as there are workers. On other platforms, or with a value of 1, the
+     * single asynchronous receive path is used.
+     *
+     * @param count Number of workers (clamped to 1..MAX_RECEIVE_THREADS)
+     * @note Ignored while the server is running.
+     */
+    void setReceiveThreads(size_t count);
+
+    /**
+     * @brief Get the number of receive worker threads
+     *
+     * @return size_t Configured worker count (1 = single async receive path)
+     */
+    size_t getReceiveThreads() const;
+
+    static constexpr size_t MAX_RECEIVE_THREADS = 16;
+
+    /**
+     * @brief Enable or disable the batched egress path
+     *
+     * When enabled (Linux only), outgoing datagrams are queued per destination
+     * instead of being sent one async_send_to() at a time. flush() then sends
+     * the whole queue with sendmmsg(); runs of equal-sized datagrams to the
+     * same client are coalesced into a single UDP GSO message when the kernel
+     * supports it. On other platforms the Asio path is always used.
+     *
+     * @param enabled true to queue datagrams until flush()
+     * @note Ignored while the server is running.
+     */
+    void setBatchedSend(bool enabled);
+
+    /**
+     * @brief Check whether the batched egress path is in use
+     *
+     * @return true if datagrams are queued until flush()
+     */
+    bool isBatchedSendEnabled() const;
+
+    /**
+     * @brief Get a client's smoothed round-trip time
+     *
+     * Measured from ACKs of reliable packets that were not retransmitted.
+     *
+     * @param clientId Client identifier
+     * @return float RTT in seconds, 0 if unknown
+     */
+    float getClientRtt(uint32_t clientId);
+
+    /**
+     * @brief Send all datagrams queued by the batched egress path
+     *
+     * Should be called once per server tick, after all packets for that tick
+     * have been produced. update() also flushes so that replies sent from
+     * event callbacks are not delayed. No-op when batched send is disabled.
+     *
+     * @return size_t Number of datagrams handed to the kernel
+     */
+    size_t flush();
+
+    /**
+     * @brief Let clients watch matches with C2S_SPECTATE
+     *
+     * Spectators are not players: they never reach the login callback, do
+     * not count against maxPlayers and cannot send inputs. They get what was
+     * published to their room (see publishToSpectators()) once delaySeconds
+     * have passed, packed into S2C_SPECTATE_BATCH datagrams about every
+     * SPECTATOR_BATCH_INTERVAL. Every spectator of a room shares the same
+     * datagrams. A spectator joining mid-match first gets the delayed state
+     * of the match, folded from the same packets by a ReplayState. Batches
+     * are unreliable, so that state is sent again to every spectator each
+     * SPECTATOR_SNAPSHOT_INTERVAL to repair lost spawns and deaths.
+     *
+     * @param maxSpectators Spectators accepted across all rooms (0 = off)
+     * @param delaySeconds How far behind the match spectators are
+     * @note Ignored while the server is running.
+     */
+    void setSpectators(size_t maxSpectators, float delaySeconds);
+
+    /**
+     * @brief Get the number of connected spectators (thread-safe)
+     */
+    size_t getSpectatorCount() const;
+
+    /**
+     * @brief Queue a packet for the spectators of a room (thread-safe)
+     *
+     * broadcast() already publishes to room 0, the single match of a
+     * GameServer; rooms publish their packets themselves. Does nothing when
+     * spectators are off.
+     *
+     * @param roomId Room the packet belongs to
+     * @param data Complete S2C packet, copied
+     * @param size Packet size in bytes
+     */
+    void publishToSpectators(uint16_t roomId, const void* data, size_t size);
+
+    template <typename Packet>
+    void publishToSpectators(uint16_t roomId, const Packet& packet)
+    {
+        publishToSpectators(roomId, &packet, sizeof(Packet));
+    }
+
+    static constexpr std::chrono::milliseconds SPECTATOR_BATCH_INTERVAL{100};
+    static constexpr std::chrono::milliseconds SPECTATOR_SNAPSHOT_INTERVAL{
+        2000};
+
    private:
     /**
      * @brief Main network thread loop
@@ -381,6 +522,25 @@ class NetworkServer : public INetworkServer {
     void handleReceive(const boost::system::error_code& error,
                        size_t bytesTransferred);
 
+    /**
+     * @brief Batched receive worker loop (Linux only)
+     *
+     * Polls the given socket and drains it with recvmmsg() into a per-worker
+     * pool of buffers, then dispatches each datagram to processPacket().
+     * Returns once _running is cleared.
+     *
+     * @param socketHandle Native handle of the socket to drain
+     */
+    void runBatchedReceiveLoop(
+        boost::asio::ip::udp::socket::native_handle_type socketHandle);
+
+    /**
+     * @brief Check whether the batched receive path is in use
+     *
+     * @return true on Linux with more than one receive worker
+     */
+    bool isBatchedReceiveEnabled() const;
+
     /**
      * @brief Parse and dispatch received packet
      *
@@ -402,6 +562,32 @@ class NetworkServer : public INetworkServer {
      */
     void checkTimeouts();
 
+    /**
+     * @brief Partition of the session table
+     *
+     * Sessions are spread across shards by endpoint hash so that concurrent
+     * receive workers only contend when they touch the same shard. Client IDs
+     * encode their shard: (clientId - 1) % shardCount.
+     */
+    struct SessionShard {
+        mutable std::mutex mutex;  ///< Protects this shard's sessions
+        std::map<uint32_t, ClientSession> sessions;  ///< ClientID -> Session
+        std::map<boost::asio::ip::udp::endpoint, uint32_t>
+            endpointToId;          ///< Endpoint -> ClientID
+        uint32_t nextLocalId = 0;  ///< Per-shard client counter
+    };
+
+    /**
+     * @brief Get the index of the shard owning a given endpoint
+     */
+    size_t getShardIndexForEndpoint(
+        const boost::asio::ip::udp::endpoint& endpoint) const;
+
+    /**
+     * @brief Get the shard owning a given client ID
+     */
+    SessionShard& getShardForId(uint32_t clientId);
+
     /**
      * @brief Resend reliable packets that haven't been ACKed
      */
@@ -418,29 +604,39 @@ class NetworkServer : public INetworkServer {
     void disconnectClient(uint32_t clientId, const std::string& reason);
 
     /**
-     * @brief Generate next unique client ID
+     * @brief Generate next unique client ID within a shard
      *
-     * @return uint32_t Monotonically increasing client identifier
+     * @param shardIndex Index of the shard the client belongs to
+     * @return uint32_t Unique client identifier (caller holds the shard lock)
      */
-    uint32_t getNextClientId();
+    uint32_t getNextClientId(size_t shardIndex);
 
     /**
      * @brief Find client session by UDP endpoint
      *
+     * @param shard Shard owning the endpoint (caller holds its lock)
      * @param endpoint Client's IP address and port
      * @return ClientSession* Pointer to session or nullptr if not found
      */
     ClientSession* getSessionByEndpoint(
-        const boost::asio::ip::udp::endpoint& endpoint);
+        SessionShard& shard, const boost::asio::ip::udp::endpoint& endpoint);
 
     /**
      * @brief Find client session by client ID
      *
-     * @param id Client identifier
+     * @param id Client identifier (caller holds the owning shard's lock)
      * @return ClientSession* Pointer to session or nullptr if not found
      */
     ClientSession* getSessionById(uint32_t id);
 
+    /**
+     * @brief Fold the round trip of an acknowledged packet into the RTT
+     *
+     * @param session Session that sent the ACK (caller holds its shard lock)
+     * @param ack The received ACK
+     */
+    void updateRtt(ClientSession& session, const AckPacket& ack);
+
     /**
      * @brief Send raw data to specific UDP endpoint
      *
@@ -454,6 +650,118 @@ class NetworkServer : public INetworkServer {
                         const void* data, size_t size, bool reliable = false,
                         ClientSession* session = nullptr);
 
+    /**
+     * @brief Send a pooled buffer to a UDP endpoint
+     *
+     * The completion handler holds a reference to the buffer, so the bytes
+     * stay valid until the asynchronous send has finished.
+     *
+     * @param endpoint Target address
+     * @param buffer Packet to send
+     */
+    void sendBuffer(const boost::asio::ip::udp::endpoint& endpoint,
+                    const PacketBuffer& buffer);
+
+    /**
+     * @brief Queue a datagram for the next flush()
+     *
+     * @param endpoint Target address
+     * @param data Data buffer (copied)
+     * @param size Data size in bytes
+     */
+    void queueDatagram(const boost::asio::ip::udp::endpoint& endpoint,
+                       const void* data, size_t size);
+
+    /**
+     * @brief Datagrams queued for a single destination
+     *
+     * Datagrams are stored back to back so that a run of equal-sized packets
+     * is one contiguous buffer, ready to be handed to UDP GSO.
+     */
+    struct EgressDestination {
+        boost::asio::ip::udp::endpoint endpoint;  ///< Target address
+        std::vector<uint8_t> bytes;               ///< Concatenated datagrams
+        std::vector<uint16_t> sizes;              ///< Size of each datagram
+    };
+
+    /**
+     * @brief Hash of an endpoint's raw socket address
+     */
+    struct EndpointHash {
+        size_t operator()(
+            const boost::asio::ip::udp::endpoint& endpoint) const;
+    };
+
+    /**
+     * @brief A spectator of a room
+     */
+    struct Spectator {
+        uint32_t clientId;                        ///< Session of the spectator
+        boost::asio::ip::udp::endpoint endpoint;  ///< Where batches go
+        bool needsSnapshot;  ///< Joined or due for a resync
+    };
+
+    /**
+     * @brief Packets published during one batch interval
+     */
+    struct SpectatorChunk {
+        std::chrono::steady_clock::time_point
+            publishedAt;               ///< When the first packet came in
+        std::vector<uint8_t> records;  ///< uint16_t size + packet, repeated
+    };
+
+    /**
+     * @brief Delayed copy of one room's packets
+     */
+    struct SpectatorFeed {
+        std::mutex mutex;  ///< Protects the whole feed
+        std::deque<SpectatorChunk> chunks;  ///< Published, not released yet
+        ReplayState state;  ///< The match as released to spectators
+        std::vector<Spectator> spectators;  ///< Who receives the releases
+        std::chrono::steady_clock::time_point
+            lastSnapshot;  ///< Last snapshot sent to every spectator
+    };
+
+    /**
+     * @brief Get a room's feed, creating it on first use
+     * @note Feeds are never destroyed before the server
+     */
+    SpectatorFeed& getSpectatorFeed(uint16_t roomId);
+
+    /**
+     * @brief Handle a C2S_SPECTATE from a session
+     *
+     * @param shard Shard owning the session (not locked by the caller)
+     * @param clientId Requesting client
+     * @param roomId Room to watch
+     */
+    void addSpectator(SessionShard& shard, uint32_t clientId,
+                      uint16_t roomId);
+
+    /**
+     * @brief Stop sending a room's batches to a client
+     */
+    void removeSpectator(uint32_t clientId, uint16_t roomId);
+
+    /**
+     * @brief Send the chunks whose delay has passed to their spectators
+     *
+     * Called by update(). Spectators that joined since the previous call get
+     * the state of their room first.
+     */
+    void releaseSpectatorPackets();
+
+    /**
+     * @brief Pack records into S2C_SPECTATE_BATCH datagrams and send them
+     *
+     * @param records uint16_t size + packet, repeated
+     * @param spectators Recipients
+     * @param snapshotOnly Only send to spectators waiting for a snapshot
+     */
+    void sendSpectatorBatches(const std::vector<uint8_t>& records,
+                              const std::vector<Spectator>& spectators,
+                              bool snapshotOnly);
+
     /**
      * @brief Event types for the thread-safe event queue
      */
@@ -496,6 +804,9 @@ class NetworkServer : public INetworkServer {
     void sendToClient(const void* data, size_t size, uint32_t clientId);
 
    private:
+    // --- Packet Buffers ---
+    PacketBufferPool _packetPool;  ///< Outgoing packets (outlives _ioContext)
+
     // --- Boost.Asio Components ---
     boost::asio::io_context _ioContext;    ///< Asio I/O context
     boost::asio::ip::udp::socket _socket;  ///< UDP socket
@@ -504,16 +815,48 @@ class NetworkServer : public INetworkServer {
     NetworkState _state;                   ///< Current network state
 
     // --- Receive State ---
-    std::array<uint8_t, 1024> _receiveBuffer;  ///< Buffer for incoming packets
+    static constexpr size_t RECEIVE_BUFFER_SIZE = 1024;
+    static constexpr size_t RECEIVE_BATCH_SIZE = 32;
+    std::array<uint8_t, RECEIVE_BUFFER_SIZE>
+        _receiveBuffer;  ///< Buffer for incoming packets
     boost::asio::ip::udp::endpoint
         _remoteEndpoint;  ///< Sender of current packet
 
+    // --- Batched Receive (Linux) ---
+    size_t _receiveThreadCount;  ///< Configured receive workers
+    std::vector<std::unique_ptr<boost::asio::ip::udp::socket>>
+        _receiveSockets;  ///< Extra SO_REUSEPORT sockets (worker 1..N-1)
+    std::vector<std::thread> _receiveThreads;  ///< Batched receive workers
+    std::optional<boost::asio::executor_work_guard<
+        boost::asio::io_context::executor_type>>
+        _workGuard;  ///< Keeps the send loop alive without a pending receive
+
+    // --- Batched Send (Linux) ---
+    static constexpr size_t GSO_MAX_SEGMENTS = 64;
+    static constexpr size_t GSO_MAX_BYTES = 65000;
+    bool _batchedSend;   ///< Queue datagrams until flush()
+    bool _gsoSupported;  ///< Kernel accepts UDP_SEGMENT on _socket
+    std::mutex _egressMutex;  ///< Protects _egressQueue and _egressIndex
+    std::mutex _flushMutex;   ///< Serializes flush()
+    std::vector<EgressDestination>
+        _egressQueue;  ///< Datagrams produced since the last flush
+    std::unordered_map<boost::asio::ip::udp::endpoint, size_t, EndpointHash>
+        _egressIndex;  ///< Endpoint -> index in _egressQueue
+    std::vector<EgressDestination>
+        _egressInFlight;  ///< Queue being sent by flush()
+
     // --- Client Management ---
-    mutable std::mutex _clientsMutex;  ///< Protects client data structures
-    std::map<uint32_t, ClientSession> _sessions;  ///< ClientID -> Session
-    std::map<boost::asio::ip::udp::endpoint, uint32_t>
-        _endpointToId;       ///< Endpoint -> ClientID
-    uint32_t _nextClientId;  ///< Next client ID to assign
+    std::vector<std::unique_ptr<SessionShard>>
+        _shards;  ///< Session table, sharded by endpoint hash
+
+    // --- Spectators ---
+    size_t _maxSpectators;  ///< 0 when spectating is off
+    std::chrono::steady_clock::duration
+        _spectatorDelay;  ///< How long published packets are held
+    std::atomic<size_t> _spectatorCount;  ///< Spectators across all feeds
+    std::mutex _spectatorMutex;           ///< Protects _spectatorFeeds
+    std::map<uint16_t, std::unique_ptr<SpectatorFeed>>
+        _spectatorFeeds;  ///< Room ID -> feed
 
     // --- Timeout Management ---
     std::chrono::seconds _timeoutDuration;  ///< Inactivity timeout duration
@@ -0,0 +1,140 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** PacketBufferPool
+*/
+
+#include "PacketBufferPool.hpp"
+
+#include <cstring>
+
+namespace rtype {
+
+// --- PacketBuffer ---
+
+PacketBuffer::PacketBuffer(PacketBufferPool* pool, Slot* slot)
+    : _pool(pool), _slot(slot)
+{
+}
+
+PacketBuffer::PacketBuffer(const PacketBuffer& other)
+    : _pool(other._pool), _slot(other._slot)
+{
+    if (_slot) _slot->refCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+PacketBuffer::PacketBuffer(PacketBuffer&& other) noexcept
+    : _pool(other._pool), _slot(other._slot)
+{
+    other._pool = nullptr;
+    other._slot = nullptr;
+}
+
+PacketBuffer& PacketBuffer::operator=(const PacketBuffer& other)
+{
+    if (this != &other) {
+        if (other._slot)
+            other._slot->refCount.fetch_add(1, std::memory_order_relaxed);
+        release();
+        _pool = other._pool;
+        _slot = other._slot;
+    }
+    return *this;
+}
+
+PacketBuffer& PacketBuffer::operator=(PacketBuffer&& other) noexcept
+{
+    if (this != &other) {
+        release();
+        _pool = other._pool;
+        _slot = other._slot;
+        other._pool = nullptr;
+        other._slot = nullptr;
+    }
+    return *this;
+}
+
+PacketBuffer::~PacketBuffer() { release(); }
+
+uint8_t* PacketBuffer::data() { return _slot ? _slot->bytes.data() : nullptr; }
+
+const uint8_t* PacketBuffer::data() const
+{
+    return _slot ? _slot->bytes.data() : nullptr;
+}
+
+size_t PacketBuffer::size() const { return _slot ? _slot->size : 0; }
+
+uint32_t PacketBuffer::useCount() const
+{
+    return _slot ? _slot->refCount.load(std::memory_order_relaxed) : 0;
+}
+
+void PacketBuffer::release()
+{
+    if (!_slot) return;
+
+    if (_slot->refCount.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        _pool->recycle(_slot);
+    }
+    _pool = nullptr;
+    _slot = nullptr;
+}
+
+// --- PacketBufferPool ---
+
+PacketBufferPool::PacketBufferPool(size_t slabSize)
+    : _slabSize(slabSize > 0 ? slabSize : 1)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    grow();
+}
+
+PacketBuffer PacketBufferPool::acquire(const void* data, size_t size)
+{
+    if (size > BUFFER_SIZE) return PacketBuffer();
+
+    PacketBuffer::Slot* slot = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_freeList.empty()) grow();
+        slot = _freeList.back();
+        _freeList.pop_back();
+    }
+
+    std::memcpy(slot->bytes.data(), data, size);
+    slot->size = size;
+    slot->refCount.store(1, std::memory_order_relaxed);
+    return PacketBuffer(this, slot);
+}
+
+size_t PacketBufferPool::available() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _freeList.size();
+}
+
+size_t PacketBufferPool::capacity() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _slabs.size() * _slabSize;
+}
+
+void PacketBufferPool::grow()
+{
+    auto slab = std::make_unique<PacketBuffer::Slot[]>(_slabSize);
+    _freeList.reserve(_freeList.size() + _slabSize);
+    for (size_t i = 0; i < _slabSize; ++i) {
+        _freeList.push_back(&slab[i]);
+    }
+    _slabs.push_back(std::move(slab));
+}
+
+void PacketBufferPool::recycle(PacketBuffer::Slot* slot)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _freeList.push_back(slot);
+}
+
+}  // namespace rtype
@@ -0,0 +1,137 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** PacketBufferPool
+*/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace rtype {
+
+class PacketBufferPool;
+
+/**
+ * @brief Refcounted handle to a pooled packet buffer
+ *
+ * Copies share the same underlying buffer. The buffer goes back to its pool
+ * when the last handle is destroyed, which makes it safe to hand a copy to an
+ * asynchronous send while another copy stays in the retransmit list.
+ */
+class PacketBuffer {
+   public:
+    PacketBuffer() = default;
+    PacketBuffer(const PacketBuffer& other);
+    PacketBuffer(PacketBuffer&& other) noexcept;
+    PacketBuffer& operator=(const PacketBuffer& other);
+    PacketBuffer& operator=(PacketBuffer&& other) noexcept;
+    ~PacketBuffer();
+
+    /**
+     * @brief Get a pointer to the packet bytes
+     */
+    uint8_t* data();
+    const uint8_t* data() const;
+
+    /**
+     * @brief Get the packet size in bytes
+     */
+    size_t size() const;
+
+    /**
+     * @brief Get the number of handles sharing this buffer
+     */
+    uint32_t useCount() const;
+
+    /**
+     * @brief Check whether the handle references a buffer
+     */
+    explicit operator bool() const { return _slot != nullptr; }
+
+   private:
+    friend class PacketBufferPool;
+
+    struct Slot;
+
+    PacketBuffer(PacketBufferPool* pool, Slot* slot);
+    void release();
+
+    PacketBufferPool* _pool = nullptr;
+    Slot* _slot = nullptr;
+};
+
+/**
+ * @brief Fixed-size packet buffer pool
+ *
+ * Buffers are allocated in slabs and recycled through a free list, so once the
+ * pool has reached its working size, acquiring a buffer does not touch the
+ * heap. When every buffer is in use the pool grows by one slab; slabs are
+ * never freed before the pool itself.
+ *
+ * @note Thread-safe. Handles may be released from any thread, but every
+ *       handle must be released before the pool is destroyed.
+ */
+class PacketBufferPool {
+   public:
+    static constexpr size_t BUFFER_SIZE = 1024;  ///< Max packet size in bytes
+
+    /**
+     * @brief Construct a pool
+     *
+     * @param slabSize Number of buffers allocated at once (at least 1)
+     */
+    explicit PacketBufferPool(size_t slabSize = 256);
+    ~PacketBufferPool() = default;
+
+    PacketBufferPool(const PacketBufferPool&) = delete;
+    PacketBufferPool& operator=(const PacketBufferPool&) = delete;
+
+    /**
+     * @brief Copy a packet into a pooled buffer
+     *
+     * @param data Packet bytes
+     * @param size Packet size (must not exceed BUFFER_SIZE)
+     * @return PacketBuffer Handle to the copy, empty if size is too large
+     */
+    PacketBuffer acquire(const void* data, size_t size);
+
+    /**
+     * @brief Get the number of buffers currently free
+     */
+    size_t available() const;
+
+    /**
+     * @brief Get the total number of buffers owned by the pool
+     */
+    size_t capacity() const;
+
+   private:
+    friend class PacketBuffer;
+
+    void grow();
+    void recycle(PacketBuffer::Slot* slot);
+
+    size_t _slabSize;
+    mutable std::mutex _mutex;  ///< Protects _slabs and _freeList
+    std::vector<std::unique_ptr<PacketBuffer::Slot[]>> _slabs;
+    std::vector<PacketBuffer::Slot*> _freeList;
+};
+
+/**
+ * @brief Storage for a single pooled packet
+ */
+struct PacketBuffer::Slot {
+    std::array<uint8_t, PacketBufferPool::BUFFER_SIZE> bytes;
+    size_t size = 0;
+    std::atomic<uint32_t> refCount{0};
+};
+
+}  // namespace rtype
@@ -7,7 +7,9 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
 #include <chrono>
+#include <set>
 #include <thread>
 #include <typeindex>
 
@@ -172,6 +174,120 @@ TEST_F(NetworkServerTests, DifferentPorts)
     server2.stop();
 }
 
+TEST_F(NetworkServerTests, ReceiveThreadsConfiguration)
+{
+    EXPECT_EQ(server->getReceiveThreads(), 1u);
+
+    server->setReceiveThreads(0);
+    EXPECT_EQ(server->getReceiveThreads(), 1u);
+
+    server->setReceiveThreads(1000);
+    EXPECT_EQ(server->getReceiveThreads(), NetworkServer::MAX_RECEIVE_THREADS);
+
+    server->setReceiveThreads(4);
+    EXPECT_TRUE(server->start(12347));
+    server->setReceiveThreads(2);
+    EXPECT_EQ(server->getReceiveThreads(), 4u);
+    server->stop();
+}
+
+TEST_F(NetworkServerTests, BatchedReceiveAcceptsManyClients)
+{
+    const size_t clientCount = 16;
+    std::atomic<int> connected{0};
+    std::atomic<int> logins{0};
+
+    server->setReceiveThreads(4);
+    server->setOnClientConnectedCallback(
+        [&](uint32_t, const std::string&, uint16_t) { connected++; });
+    server->setOnClientLoginCallback(
+        [&](uint32_t, const ::LoginPacket&) { logins++; });
+    ASSERT_TRUE(server->start(12348));
+
+    boost::asio::io_context io;
+    std::vector<std::unique_ptr<boost::asio::ip::udp::socket>> clients;
+    boost::asio::ip::udp::endpoint serverEndpoint(
+        boost::asio::ip::make_address("127.0.0.1"), 12348);
+
+    for (size_t i = 0; i < clientCount; ++i) {
+        auto socket = std::make_unique<boost::asio::ip::udp::socket>(
+            io, boost::asio::ip::udp::endpoint(boost::asio::ip::udp::v4(), 0));
+        auto packet = NetworkMessage::createLoginPacket("bot", 0);
+        socket->send_to(boost::asio::buffer(&packet, sizeof(packet)),
+                        serverEndpoint);
+        clients.push_back(std::move(socket));
+    }
+
+    for (int i = 0; i < 20 && logins < static_cast<int>(clientCount); ++i) {
+        waitForAsync(50);
+        server->update();
+    }
+
+    EXPECT_EQ(connected.load(), static_cast<int>(clientCount));
+    EXPECT_EQ(logins.load(), static_cast<int>(clientCount));
+
+    auto infos = server->getConnectedClients();
+    ASSERT_EQ(infos.size(), clientCount);
+    std::set<uint32_t> ids;
+    for (const auto& info : infos) ids.insert(info.clientId);
+    EXPECT_EQ(ids.size(), clientCount);
+
+    server->stop();
+}
+
+TEST_F(NetworkServerTests, BatchedSendDeliversOnFlush)
+{
+    const uint32_t packetCount = 100;
+    std::atomic<uint32_t> loggedClient{0};
+
+    server->setBatchedSend(true);
+    server->setOnClientLoginCallback(
+        [&](uint32_t clientId, const ::LoginPacket&) {
+            loggedClient = clientId;
+        });
+    ASSERT_TRUE(server->start(12349));
+
+    boost::asio::io_context io;
+    boost::asio::ip::udp::socket client(
+        io, boost::asio::ip::udp::endpoint(boost::asio::ip::udp::v4(), 0));
+    boost::asio::ip::udp::endpoint serverEndpoint(
+        boost::asio::ip::make_address("127.0.0.1"), 12349);
+    auto login = NetworkMessage::createLoginPacket("bot", 0);
+    client.send_to(boost::asio::buffer(&login, sizeof(login)), serverEndpoint);
+
+    for (int i = 0; i < 20 && loggedClient == 0; ++i) {
+        waitForAsync(20);
+        server->update();
+    }
+    ASSERT_NE(loggedClient.load(), 0u);
+    ASSERT_TRUE(server->sendLoginResponse(loggedClient, 1, 1920, 1080));
+
+    for (uint32_t i = 0; i < packetCount; ++i) {
+        server->sendEntityPosition(loggedClient, i, static_cast<float>(i),
+                                   0.0f);
+    }
+    if (server->isBatchedSendEnabled()) {
+        EXPECT_EQ(client.available(), 0u);
+        EXPECT_EQ(server->flush(), packetCount + 1);
+    }
+
+    std::array<uint8_t, 1024> buffer{};
+    boost::asio::ip::udp::endpoint sender;
+    size_t bytes = client.receive_from(boost::asio::buffer(buffer), sender);
+    ASSERT_EQ(bytes, sizeof(LoginResponsePacket));
+
+    for (uint32_t i = 0; i < packetCount; ++i) {
+        bytes = client.receive_from(boost::asio::buffer(buffer), sender);
+        ASSERT_EQ(bytes, sizeof(EntityPositionPacket));
+        const auto* packet =
+            reinterpret_cast<const EntityPositionPacket*>(buffer.data());
+        EXPECT_EQ(packet->header.opCode, OpCode::S2C_ENTITY_POS);
+        EXPECT_EQ(packet->entityId, i);
+    }
+
+    server->stop();
+}
+
 class NetworkMessageTest : public ::testing::Test {
    protected:
     void SetUp() override {}
@@ -312,9 +428,14 @@ TEST_F(NetworkMessageTest, StringUtilities)
     EXPECT_EQ(NetworkMessage::entityTypeToString(EntityType::FAST), "FAST");
     EXPECT_EQ(NetworkMessage::entityTypeToString(EntityType::FAST_MISSILE),
               "FAST_MISSILE");
+    EXPECT_EQ(NetworkMessage::entityTypeToString(EntityType::BOSS), "BOSS");
+    EXPECT_EQ(NetworkMessage::entityTypeToString(EntityType::GREEN_BULLET),
+              "GREEN_BULLET");
 
     EXPECT_EQ(NetworkMessage::opCodeToString(OpCode::C2S_LOGIN), "C2S_LOGIN");
     EXPECT_EQ(NetworkMessage::opCodeToString(OpCode::S2C_LOGIN_OK),
               "S2C_LOGIN_OK");
+    EXPECT_EQ(NetworkMessage::opCodeToString(OpCode::S2C_HEALTH_UPDATE),
+              "S2C_HEALTH_UPDATE");
     EXPECT_EQ(NetworkMessage::opCodeToString(255), "UNKNOWN");
 }
@@ -0,0 +1,130 @@
+/*
+** EPITECH PROJECT, 2025
+** r-type
+** File description:
+** PacketBufferPoolTests
+*/
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "PacketBufferPool.hpp"
+#include "common/network/Protocol.hpp"
+
+using namespace rtype;
+
+TEST(PacketBufferPoolTests, AcquireCopiesData)
+{
+    PacketBufferPool pool(4);
+    const uint8_t payload[] = {1, 2, 3, 4, 5};
+
+    PacketBuffer buffer = pool.acquire(payload, sizeof(payload));
+
+    ASSERT_TRUE(buffer);
+    EXPECT_EQ(buffer.size(), sizeof(payload));
+    EXPECT_EQ(std::memcmp(buffer.data(), payload, sizeof(payload)), 0);
+    EXPECT_EQ(buffer.useCount(), 1u);
+    EXPECT_EQ(pool.available(), 3u);
+}
+
+TEST(PacketBufferPoolTests, CopiesShareTheSameBuffer)
+{
+    PacketBufferPool pool(4);
+    ScoreUpdatePacket packet{};
+    packet.score = 42;
+
+    PacketBuffer first = pool.acquire(&packet, sizeof(packet));
+    PacketBuffer second = first;
+
+    EXPECT_EQ(first.data(), second.data());
+    EXPECT_EQ(first.useCount(), 2u);
+
+    reinterpret_cast<Header*>(first.data())->sequenceId = 7;
+    EXPECT_EQ(reinterpret_cast<const Header*>(second.data())->sequenceId, 7u);
+}
+
+TEST(PacketBufferPoolTests, LastHandleReturnsBufferToPool)
+{
+    PacketBufferPool pool(2);
+    const uint8_t byte = 0xFF;
+
+    {
+        PacketBuffer first = pool.acquire(&byte, 1);
+        PacketBuffer second = first;
+        PacketBuffer moved = std::move(second);
+        EXPECT_FALSE(second);
+        EXPECT_EQ(pool.available(), 1u);
+
+        first = PacketBuffer();
+        EXPECT_EQ(pool.available(), 1u);
+    }
+
+    EXPECT_EQ(pool.available(), 2u);
+}
+
+TEST(PacketBufferPoolTests, BuffersAreRecycled)
+{
+    PacketBufferPool pool(1);
+    const uint8_t byte = 1;
+
+    const uint8_t* address = nullptr;
+    {
+        PacketBuffer buffer = pool.acquire(&byte, 1);
+        address = buffer.data();
+    }
+    PacketBuffer again = pool.acquire(&byte, 1);
+
+    EXPECT_EQ(again.data(), address);
+    EXPECT_EQ(pool.capacity(), 1u);
+}
+
+TEST(PacketBufferPoolTests, GrowsWhenExhausted)
+{
+    PacketBufferPool pool(2);
+    const uint8_t byte = 1;
+
+    std::vector<PacketBuffer> held;
+    for (int i = 0; i < 5; ++i) {
+        held.push_back(pool.acquire(&byte, 1));
+        EXPECT_TRUE(held.back());
+    }
+
+    EXPECT_EQ(pool.capacity(), 6u);
+    EXPECT_EQ(pool.available(), 1u);
+
+    held.clear();
+    EXPECT_EQ(pool.available(), 6u);
+}
+
+TEST(PacketBufferPoolTests, RejectsOversizedPackets)
+{
+    PacketBufferPool pool(1);
+    std::vector<uint8_t> large(PacketBufferPool::BUFFER_SIZE + 1, 0);
+
+    PacketBuffer buffer = pool.acquire(large.data(), large.size());
+
+    EXPECT_FALSE(buffer);
+    EXPECT_EQ(buffer.size(), 0u);
+    EXPECT_EQ(pool.available(), 1u);
+}
+
+TEST(PacketBufferPoolTests, ConcurrentReleaseFromManyThreads)
+{
+    PacketBufferPool pool(16);
+    const uint8_t byte = 1;
+
+    for (int round = 0; round < 100; ++round) {
+        PacketBuffer buffer = pool.acquire(&byte, 1);
+        std::vector<std::thread> threads;
+        for (int i = 0; i < 4; ++i) {
+            threads.emplace_back([copy = buffer]() mutable { copy = {}; });
+        }
+        buffer = PacketBuffer();
+        for (auto& thread : threads) thread.join();
+    }
+
+    EXPECT_EQ(pool.available(), pool.capacity());
+}
@@ -8,6 +8,7 @@
 #include <gtest/gtest.h>
 
 #include <chrono>
+#include <cstddef>
 #include <thread>
 #include <typeindex>
 
@@ -26,7 +27,10 @@ TEST_F(ProtocolTest, HeaderSize)
 
 TEST_F(ProtocolTest, LoginPacketSize)
 {
-    EXPECT_EQ(sizeof(LoginPacket), sizeof(Header) + 8);  // Header + username[8]
+    // Header + username[8] + roomId
+    EXPECT_EQ(sizeof(LoginPacket), sizeof(Header) + 8 + sizeof(uint16_t));
+    // Logins from clients that predate rooms end right before roomId
+    EXPECT_EQ(offsetof(LoginPacket, roomId), sizeof(Header) + 8);
 }
 
 TEST_F(ProtocolTest, InputPacketSize)
@@ -48,6 +52,12 @@ TEST_F(ProtocolTest, EntitySpawnPacketSize)
         sizeof(Header) + 13);  // Header + uint32_t + uint8_t + float + float
 }
 
+TEST_F(ProtocolTest, SpectatePacketSize)
+{
+    EXPECT_EQ(sizeof(SpectatePacket), sizeof(Header) + 2);  // Header + roomId
+    EXPECT_EQ(sizeof(SpectateBatchPacket), sizeof(Header));
+}
+
 TEST_F(ProtocolTest, OpCodeValues)
 {
     EXPECT_EQ(C2S_LOGIN, 1);
@@ -55,6 +65,7 @@ TEST_F(ProtocolTest, OpCodeValues)
     EXPECT_EQ(C2S_DISCONNECT, 3);
     EXPECT_EQ(C2S_ACK, 4);
     EXPECT_EQ(C2S_INPUT, 5);
+    EXPECT_EQ(C2S_SPECTATE, 6);
 
     EXPECT_EQ(S2C_LOGIN_OK, 10);
     EXPECT_EQ(S2C_ENTITY_NEW, 11);
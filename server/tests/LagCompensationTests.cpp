@@ -0,0 +1,146 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** LagCompensationTests
+*/
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "engine/system/GameSystems.hpp"
+#include "engine/system/HitboxHistory.hpp"
+
+using namespace engine;
+
+namespace {
+
+constexpr float TICK = 1.0f / 60.0f;
+
+Entity createEnemy(EntityManager& entityManager, uint32_t networkId, float x)
+{
+    Entity enemy = entityManager.createEntity();
+    entityManager.addComponent(enemy, Position(x, 500.0f));
+    entityManager.addComponent(enemy, Enemy());
+    entityManager.addComponent(enemy, Health(100.0f));
+    entityManager.addComponent(enemy, BoundingBox(32.0f, 32.0f));
+    entityManager.addComponent(enemy, NetworkEntity(networkId, 1));
+    return enemy;
+}
+
+}  // namespace
+
+class LagCompensationTests : public ::testing::Test {
+   protected:
+    EntityManager entityManager;
+    std::vector<SpawnEvent> spawnQueue;
+
+    Entity player;
+    Entity enemy;
+
+    void SetUp() override
+    {
+        player = entityManager.createEntity();
+        entityManager.addComponent(player, Position(100.0f, 500.0f));
+        entityManager.addComponent(player, Player(1, 1));
+        entityManager.getComponent<Player>(player)->viewLatency = 0.1f;
+
+        enemy = createEnemy(entityManager, 1000, 1000.0f);
+    }
+
+    /**
+     * @brief Tick the collision system while the enemy moves right 100px
+     * per tick: at the last tick it is at 1600, 0.1s earlier at 1000
+     */
+    void runTicks(CollisionSystem& collision)
+    {
+        for (int i = 0; i < 7; ++i) {
+            entityManager.getComponent<Position>(enemy)->x =
+                1000.0f + 100.0f * static_cast<float>(i);
+            if (i == 6) {
+                fireAt(1005.0f);
+            }
+            collision.update(TICK, entityManager);
+        }
+    }
+
+    void fireAt(float x)
+    {
+        Entity bullet = entityManager.createEntity();
+        entityManager.addComponent(bullet, Position(x, 505.0f));
+        entityManager.addComponent(bullet, Bullet(player.getId(), true));
+        entityManager.addComponent(bullet, BoundingBox(10.0f, 10.0f));
+        entityManager.addComponent(bullet, NetworkEntity(1, 2));
+    }
+
+    float enemyHealth()
+    {
+        return entityManager.getComponent<Health>(enemy)->current;
+    }
+};
+
+TEST_F(LagCompensationTests, HistoryInterpolatesBetweenFrames)
+{
+    HitboxHistory history;
+    Position pos;
+    BoundingBox box;
+
+    EXPECT_FALSE(history.find(1000, 0.0f, pos, box));
+
+    history.record(1.0f, entityManager);
+    entityManager.getComponent<Position>(enemy)->x = 1100.0f;
+    history.record(2.0f, entityManager);
+    EXPECT_EQ(history.getFrameCount(), 2u);
+
+    ASSERT_TRUE(history.find(1000, 1.5f, pos, box));
+    EXPECT_FLOAT_EQ(pos.x, 1050.0f);
+    EXPECT_FLOAT_EQ(box.width, 32.0f);
+
+    // Older than the history: clamped to the oldest frame
+    ASSERT_TRUE(history.find(1000, 0.0f, pos, box));
+    EXPECT_FLOAT_EQ(pos.x, 1000.0f);
+
+    EXPECT_FALSE(history.find(42, 1.5f, pos, box));
+}
+
+TEST_F(LagCompensationTests, HistoryKeepsBoundedFrameCount)
+{
+    HitboxHistory history;
+    for (size_t i = 0; i < HitboxHistory::MAX_FRAMES * 2; ++i) {
+        history.record(static_cast<float>(i), entityManager);
+    }
+    EXPECT_EQ(history.getFrameCount(), HitboxHistory::MAX_FRAMES);
+
+    history.clear();
+    EXPECT_EQ(history.getFrameCount(), 0u);
+}
+
+TEST_F(LagCompensationTests, ShotHitsWhereShooterSawTarget)
+{
+    CollisionSystem collision(spawnQueue);
+    collision.setLagCompensationWindow(0.15f);
+
+    runTicks(collision);
+
+    EXPECT_FLOAT_EQ(enemyHealth(), 90.0f);
+}
+
+TEST_F(LagCompensationTests, DisabledCompensationUsesCurrentPosition)
+{
+    CollisionSystem collision(spawnQueue);
+
+    runTicks(collision);
+
+    EXPECT_FLOAT_EQ(enemyHealth(), 100.0f);
+}
+
+TEST_F(LagCompensationTests, RewindIsCappedByWindow)
+{
+    CollisionSystem collision(spawnQueue);
+    collision.setLagCompensationWindow(0.05f);
+
+    runTicks(collision);
+
+    EXPECT_FLOAT_EQ(enemyHealth(), 100.0f);
+}
@@ -0,0 +1,237 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** MatchRecordingTests
+*/
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "common/network/InputMask.hpp"
+#include "engine/record/MatchReader.hpp"
+#include "engine/record/MatchReplayer.hpp"
+#include "engine/system/GameLoop.hpp"
+
+using namespace engine;
+
+namespace {
+
+constexpr float TICK = 1.0f / 60.0f;
+constexpr int MATCH_TICKS = 900;
+
+// Random spawns so the seed decides where every enemy appears
+constexpr char TEST_LEVEL[] = R"({
+    "levelId": 1,
+    "waves": [
+        {
+            "waveNumber": 1,
+            "startDelay": 0.2,
+            "waitForAllDestroyed": false,
+            "enemyGroups": [
+                {
+                    "type": "BASIC",
+                    "pattern": "RANDOM",
+                    "count": 12,
+                    "startX": 1200,
+                    "minY": 100,
+                    "maxY": 980,
+                    "delayBetweenSpawns": 0.5
+                }
+            ]
+        }
+    ]
+})";
+
+using Trace = std::vector<std::vector<EntityStateUpdate>>;
+
+bool sameUpdate(const EntityStateUpdate& a, const EntityStateUpdate& b)
+{
+    return a.entityId == b.entityId && a.entityType == b.entityType &&
+           a.x == b.x && a.y == b.y && a.spawned == b.spawned &&
+           a.destroyed == b.destroyed && a.killedByPlayer == b.killedByPlayer;
+}
+
+void sendInput(GameLoop& gameLoop, uint32_t clientId, uint32_t inputMask,
+               uint32_t sequenceId, float viewLatency)
+{
+    NetworkInputCommand command;
+    command.clientId = clientId;
+    command.inputMask = inputMask;
+    command.timestamp = 0.0f;
+    command.sequenceId = sequenceId;
+    command.viewLatency = viewLatency;
+    gameLoop.queueInput(command);
+}
+
+}  // namespace
+
+class MatchRecordingTests : public ::testing::Test {
+   protected:
+    std::filesystem::path previousDirectory;
+    std::filesystem::path directory;
+    std::string matchPath;
+
+    void SetUp() override
+    {
+        // WaveManager reads levels/ relative to the working directory
+        previousDirectory = std::filesystem::current_path();
+        directory = std::filesystem::temp_directory_path() /
+                    ("rtype_match_" +
+                     std::string(::testing::UnitTest::GetInstance()
+                                     ->current_test_info()
+                                     ->name()));
+        std::filesystem::create_directories(directory / "levels");
+        std::ofstream(directory / "levels" / "level_01.json") << TEST_LEVEL;
+        std::filesystem::current_path(directory);
+        matchPath = (directory / "match.rtm").string();
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::current_path(previousDirectory);
+        std::filesystem::remove_all(directory);
+    }
+
+    /**
+     * @brief Play a scripted two-player match, recording it when a path is
+     * given, and return the entity updates of every tick
+     */
+    Trace playMatch(uint32_t seed, const std::string& recordPath)
+    {
+        GameLoop gameLoop;
+        gameLoop.addDefaultSystems(true, false, 0.1f);
+        gameLoop.setRandomSeed(seed);
+        gameLoop.setOnPlayerDeath([](uint32_t) {});
+        gameLoop.spawnPlayer(1, 1, 100.0f, 200.0f);
+        if (!recordPath.empty()) {
+            EXPECT_TRUE(gameLoop.startRecording(recordPath));
+        }
+        gameLoop.start(false);
+        gameLoop.startLevel(1, 2);
+
+        Trace trace;
+        for (int tick = 0; tick < MATCH_TICKS; ++tick) {
+            if (tick == 30) {
+                gameLoop.spawnPlayer(2, 2, 100.0f, 400.0f);
+            }
+            uint32_t sequence = static_cast<uint32_t>(tick);
+            uint32_t move = (tick / 40) % 2 ? InputMask::UP : InputMask::DOWN;
+            sendInput(gameLoop, 1, move | InputMask::SHOOT, sequence,
+                      tick < 300 ? 0.05f : 0.08f);
+            if (tick > 30 && tick < 600 && tick % 3 == 0) {
+                sendInput(gameLoop, 2, InputMask::SHOOT | InputMask::RIGHT,
+                          sequence, 0.12f);
+            }
+            if (tick == 600) {
+                gameLoop.removePlayer(2);
+            }
+            if (tick == 700) {
+                gameLoop.resetPlayers();
+            }
+            gameLoop.tick(tick % 100 == 99 ? 2.0f * TICK : TICK);
+
+            trace.emplace_back();
+            gameLoop.popEntityUpdates(trace.back());
+        }
+        gameLoop.stop();
+        return trace;
+    }
+
+    void expectSameTrace(const Trace& expected, const Trace& actual)
+    {
+        ASSERT_EQ(expected.size(), actual.size());
+        for (size_t tick = 0; tick < expected.size(); ++tick) {
+            ASSERT_EQ(expected[tick].size(), actual[tick].size())
+                << "at tick " << tick;
+            for (size_t i = 0; i < expected[tick].size(); ++i) {
+                ASSERT_TRUE(sameUpdate(expected[tick][i], actual[tick][i]))
+                    << "at tick " << tick << ", update " << i;
+            }
+        }
+    }
+};
+
+TEST_F(MatchRecordingTests, ReplayReproducesTheRecordedMatch)
+{
+    Trace recorded = playMatch(1234, matchPath);
+
+    size_t updates = 0;
+    for (const auto& tick : recorded) {
+        updates += tick.size();
+    }
+    ASSERT_GT(updates, static_cast<size_t>(MATCH_TICKS));
+
+    GameLoop gameLoop;
+    MatchReplayer replayer(gameLoop);
+    ASSERT_TRUE(replayer.open(matchPath));
+    EXPECT_EQ(replayer.getConfig().seed, 1234u);
+    EXPECT_FLOAT_EQ(replayer.getConfig().lagCompensationWindow, 0.1f);
+
+    Trace replayed;
+    while (replayer.step()) {
+        replayed.emplace_back();
+        gameLoop.popEntityUpdates(replayed.back());
+    }
+    gameLoop.stop();
+
+    EXPECT_EQ(replayer.getTickCount(), static_cast<uint64_t>(MATCH_TICKS));
+    expectSameTrace(recorded, replayed);
+}
+
+TEST_F(MatchRecordingTests, SeedDecidesTheMatch)
+{
+    Trace first = playMatch(1, "");
+    Trace again = playMatch(1, "");
+    Trace other = playMatch(2, "");
+
+    expectSameTrace(first, again);
+
+    bool diverged = false;
+    for (size_t tick = 0; tick < first.size() && !diverged; ++tick) {
+        if (first[tick].size() != other[tick].size()) {
+            diverged = true;
+            break;
+        }
+        for (size_t i = 0; i < first[tick].size(); ++i) {
+            if (!sameUpdate(first[tick][i], other[tick][i])) {
+                diverged = true;
+                break;
+            }
+        }
+    }
+    EXPECT_TRUE(diverged);
+}
+
+TEST_F(MatchRecordingTests, RecordingIsCompact)
+{
+    playMatch(7, matchPath);
+
+    // Two clients sending input every frame at 60 Hz stay under 4 bytes
+    // per tick once compressed
+    auto size = std::filesystem::file_size(matchPath);
+    EXPECT_LT(size, static_cast<uintmax_t>(MATCH_TICKS * 4));
+}
+
+TEST_F(MatchRecordingTests, TruncatedRecordingStopsCleanly)
+{
+    playMatch(7, matchPath);
+    std::filesystem::resize_file(
+        matchPath, std::filesystem::file_size(matchPath) - 10);
+
+    MatchReader reader;
+    ASSERT_TRUE(reader.open(matchPath));
+    // The match fits in one block, which is dropped whole once damaged
+    MatchEvent event;
+    EXPECT_FALSE(reader.next(event));
+    EXPECT_FALSE(reader.next(event));
+
+    std::ofstream(matchPath, std::ios::binary | std::ios::trunc)
+        << "RTYPE_REPLAY";
+    EXPECT_FALSE(reader.open(matchPath));
+    EXPECT_FALSE(reader.open((directory / "missing.rtm").string()));
+}
@@ -0,0 +1,92 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** PlayerInputTests
+*/
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "common/network/InputMask.hpp"
+#include "common/network/PlayerMovement.hpp"
+#include "engine/system/GameLoop.hpp"
+
+using namespace engine;
+
+namespace {
+
+constexpr float START_X = 100.0f;
+constexpr float START_Y = 200.0f;
+constexpr float STEP_DISTANCE =
+    PlayerMovement::BASE_SPEED * PlayerMovement::INPUT_STEP;
+
+}  // namespace
+
+class PlayerInputTests : public ::testing::Test {
+   protected:
+    GameLoop gameLoop;
+
+    void SetUp() override
+    {
+        gameLoop.spawnPlayer(1, 1, START_X, START_Y);
+        gameLoop.start(false);
+    }
+
+    void TearDown() override { gameLoop.stop(); }
+
+    void sendInputs(uint32_t count, uint32_t firstSequenceId)
+    {
+        for (uint32_t i = 0; i < count; ++i) {
+            NetworkInputCommand command;
+            command.clientId = 1;
+            command.inputMask = InputMask::RIGHT;
+            command.timestamp = 0.0f;
+            command.sequenceId = firstSequenceId + i;
+            gameLoop.queueInput(command);
+        }
+    }
+
+    InputAck popAck()
+    {
+        std::vector<InputAck> acks;
+        gameLoop.popInputAcks(acks);
+        EXPECT_EQ(acks.size(), 1u);
+        return acks.empty() ? InputAck{} : acks.back();
+    }
+};
+
+TEST_F(PlayerInputTests, EachInputMovesOneStepWhateverTheFrameTime)
+{
+    // A long frame holding two inputs moves the ship by two steps, as the
+    // client predicted them, not by twice the frame time
+    sendInputs(2, 1);
+    gameLoop.tick(0.05f);
+
+    InputAck ack = popAck();
+    EXPECT_EQ(ack.sequenceId, 2u);
+    EXPECT_FLOAT_EQ(ack.x, START_X + 2.0f * STEP_DISTANCE);
+    EXPECT_FLOAT_EQ(ack.y, START_Y);
+}
+
+TEST_F(PlayerInputTests, InputsBeyondTheBudgetAreDropped)
+{
+    for (int i = 0; i < 10; ++i) {
+        gameLoop.tick(PlayerMovement::INPUT_STEP);
+    }
+
+    // After a pause, only a small burst is accepted
+    sendInputs(20, 1);
+    gameLoop.tick(PlayerMovement::INPUT_STEP);
+    InputAck ack = popAck();
+    EXPECT_EQ(ack.sequenceId, 4u);
+    EXPECT_FLOAT_EQ(ack.x, START_X + 4.0f * STEP_DISTANCE);
+
+    // Then one input per step of simulated time
+    sendInputs(20, 21);
+    gameLoop.tick(PlayerMovement::INPUT_STEP);
+    ack = popAck();
+    EXPECT_EQ(ack.sequenceId, 21u);
+    EXPECT_FLOAT_EQ(ack.x, START_X + 5.0f * STEP_DISTANCE);
+}
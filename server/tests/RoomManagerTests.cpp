@@ -0,0 +1,189 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** RoomManagerTests
+*/
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <boost/asio.hpp>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <thread>
+
+#include "RoomManager.hpp"
+#include "common/network/InputMask.hpp"
+#include "common/network/NetworkMessage.hpp"
+#include "common/network/PlayerMovement.hpp"
+#include "common/network/Protocol.hpp"
+
+using namespace rtype;
+
+class RoomManagerTests : public ::testing::Test {
+   protected:
+    boost::asio::io_context io;
+    std::unique_ptr<RoomManager> manager;
+    std::thread runThread;
+
+    void startManager(size_t maxRooms, uint16_t port, bool singleRoom = false)
+    {
+        manager = std::make_unique<RoomManager>(maxRooms, 2, 60.0f, 5);
+        manager->setSingleRoom(singleRoom);
+        ASSERT_TRUE(manager->start(port));
+        runThread = std::thread([this]() { manager->run(); });
+    }
+
+    void TearDown() override
+    {
+        if (manager) {
+            manager->stop();
+        }
+        if (runThread.joinable()) {
+            runThread.join();
+        }
+        manager.reset();
+    }
+
+    std::unique_ptr<boost::asio::ip::udp::socket> makeClient()
+    {
+        auto socket = std::make_unique<boost::asio::ip::udp::socket>(
+            io, boost::asio::ip::udp::endpoint(boost::asio::ip::udp::v4(), 0));
+        socket->non_blocking(true);
+        return socket;
+    }
+
+    void sendLogin(boost::asio::ip::udp::socket& socket, uint16_t port,
+                   uint16_t roomId)
+    {
+        auto packet = NetworkMessage::createLoginPacket("bot", 0, roomId);
+        socket.send_to(
+            boost::asio::buffer(&packet, sizeof(packet)),
+            boost::asio::ip::udp::endpoint(
+                boost::asio::ip::make_address("127.0.0.1"), port));
+    }
+
+    // Wait for the first packet with the given opcode, skipping game traffic
+    bool waitForOpCode(boost::asio::ip::udp::socket& socket, uint8_t opCode,
+                       std::array<uint8_t, 1024>* received = nullptr)
+    {
+        std::array<uint8_t, 1024> buffer{};
+        boost::asio::ip::udp::endpoint sender;
+        auto deadline =
+            std::chrono::steady_clock::now() + std::chrono::seconds(2);
+
+        while (std::chrono::steady_clock::now() < deadline) {
+            boost::system::error_code ec;
+            size_t bytes =
+                socket.receive_from(boost::asio::buffer(buffer), sender, 0, ec);
+            if (!ec && bytes >= sizeof(Header) &&
+                reinterpret_cast<const Header*>(buffer.data())->opCode ==
+                    opCode) {
+                if (received) {
+                    *received = buffer;
+                }
+                return true;
+            }
+            if (ec) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            }
+        }
+        return false;
+    }
+};
+
+TEST_F(RoomManagerTests, RoutesClientsToSeparateRooms)
+{
+    const uint16_t port = 12350;
+    startManager(4, port);
+
+    auto first = makeClient();
+    auto second = makeClient();
+    auto third = makeClient();
+    sendLogin(*first, port, 1);
+    sendLogin(*second, port, 2);
+    sendLogin(*third, port, 1);
+
+    EXPECT_TRUE(waitForOpCode(*first, OpCode::S2C_LOGIN_OK));
+    EXPECT_TRUE(waitForOpCode(*second, OpCode::S2C_LOGIN_OK));
+    EXPECT_TRUE(waitForOpCode(*third, OpCode::S2C_LOGIN_OK));
+    EXPECT_EQ(manager->getRoomCount(), 2u);
+}
+
+TEST_F(RoomManagerTests, RejectsLoginWhenRoomLimitReached)
+{
+    const uint16_t port = 12351;
+    startManager(1, port);
+
+    auto first = makeClient();
+    auto second = makeClient();
+    sendLogin(*first, port, 1);
+    ASSERT_TRUE(waitForOpCode(*first, OpCode::S2C_LOGIN_OK));
+
+    sendLogin(*second, port, 2);
+    EXPECT_TRUE(waitForOpCode(*second, OpCode::S2C_LOGIN_REJECTED));
+    EXPECT_EQ(manager->getRoomCount(), 1u);
+}
+
+TEST_F(RoomManagerTests, SingleRoomModeIgnoresTheRequestedRoom)
+{
+    const uint16_t port = 12353;
+    startManager(1, port, true);
+
+    auto first = makeClient();
+    auto second = makeClient();
+    sendLogin(*first, port, 1);
+    ASSERT_TRUE(waitForOpCode(*first, OpCode::S2C_LOGIN_OK));
+
+    // Rejected as a second room without single-room mode; joins the first
+    // client's match as its second player instead
+    std::array<uint8_t, 1024> received{};
+    sendLogin(*second, port, 2);
+    ASSERT_TRUE(waitForOpCode(*second, OpCode::S2C_LOGIN_OK, &received));
+    EXPECT_EQ(
+        reinterpret_cast<const LoginResponsePacket*>(received.data())->playerId,
+        2u);
+    EXPECT_EQ(manager->getRoomCount(), 1u);
+}
+
+TEST_F(RoomManagerTests, LegacyLoginJoinsDefaultRoom)
+{
+    const uint16_t port = 12352;
+    startManager(2, port);
+
+    auto client = makeClient();
+    // Login as sent by a client built before LoginPacket::roomId existed
+    const size_t legacySize = offsetof(LoginPacket, roomId);
+    auto packet = NetworkMessage::createLoginPacket("old", 0);
+    packet.header.packetSize = static_cast<uint16_t>(legacySize);
+    client->send_to(boost::asio::buffer(&packet, legacySize),
+                    boost::asio::ip::udp::endpoint(
+                        boost::asio::ip::make_address("127.0.0.1"), port));
+
+    EXPECT_TRUE(waitForOpCode(*client, OpCode::S2C_LOGIN_OK));
+    EXPECT_EQ(manager->getRoomCount(), 1u);
+}
+
+TEST_F(RoomManagerTests, AcknowledgesAppliedInputs)
+{
+    const uint16_t port = 12353;
+    startManager(1, port);
+
+    auto client = makeClient();
+    sendLogin(*client, port, 0);
+    ASSERT_TRUE(waitForOpCode(*client, OpCode::S2C_LOGIN_OK));
+
+    auto input = NetworkMessage::createInputPacket(InputMask::RIGHT, 42);
+    client->send_to(boost::asio::buffer(&input, sizeof(input)),
+                    boost::asio::ip::udp::endpoint(
+                        boost::asio::ip::make_address("127.0.0.1"), port));
+
+    std::array<uint8_t, 1024> buffer{};
+    ASSERT_TRUE(waitForOpCode(*client, OpCode::S2C_INPUT_ACK, &buffer));
+    const auto* ack = reinterpret_cast<const InputAckPacket*>(buffer.data());
+    EXPECT_EQ(ack->inputSequenceId, 42u);
+    EXPECT_GT(ack->x, 0.0f);
+    EXPECT_LE(ack->x, PlayerMovement::MAX_X);
+}
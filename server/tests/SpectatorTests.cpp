@@ -0,0 +1,295 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** SpectatorTests
+*/
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <atomic>
+#include <boost/asio.hpp>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "SpectatorRelay.hpp"
+#include "common/network/NetworkMessage.hpp"
+#include "common/network/Protocol.hpp"
+#include "common/replay/ReplayFormat.hpp"
+#include "network/NetworkServer.hpp"
+
+using namespace rtype;
+
+class SpectatorTests : public ::testing::Test {
+   protected:
+    boost::asio::io_context io;
+
+    std::unique_ptr<boost::asio::ip::udp::socket> makeClient()
+    {
+        auto socket = std::make_unique<boost::asio::ip::udp::socket>(
+            io, boost::asio::ip::udp::endpoint(boost::asio::ip::udp::v4(), 0));
+        socket->non_blocking(true);
+        return socket;
+    }
+
+    template <typename Packet>
+    void send(boost::asio::ip::udp::socket& socket, uint16_t port,
+              const Packet& packet)
+    {
+        socket.send_to(
+            boost::asio::buffer(&packet, sizeof(packet)),
+            boost::asio::ip::udp::endpoint(
+                boost::asio::ip::make_address("127.0.0.1"), port));
+    }
+
+    // Pump the server until a datagram arrives or the timeout expires
+    bool receive(boost::asio::ip::udp::socket& socket, NetworkServer* server,
+                 std::vector<uint8_t>& datagram,
+                 std::chrono::milliseconds timeout =
+                     std::chrono::milliseconds(2000))
+    {
+        std::array<uint8_t, 2048> buffer{};
+        boost::asio::ip::udp::endpoint sender;
+        auto deadline = std::chrono::steady_clock::now() + timeout;
+
+        while (std::chrono::steady_clock::now() < deadline) {
+            if (server) {
+                server->update();
+            }
+            boost::system::error_code ec;
+            size_t bytes =
+                socket.receive_from(boost::asio::buffer(buffer), sender, 0, ec);
+            if (!ec) {
+                datagram.assign(buffer.begin(), buffer.begin() + bytes);
+                return true;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        return false;
+    }
+
+    // Opcodes of the packets carried by a batch, in order
+    static std::vector<uint8_t> unpack(const std::vector<uint8_t>& datagram)
+    {
+        std::vector<uint8_t> opCodes;
+        Header header;
+        std::memcpy(&header, datagram.data(), sizeof(header));
+        EXPECT_EQ(header.opCode, OpCode::S2C_SPECTATE_BATCH);
+        EXPECT_EQ(header.packetSize, datagram.size());
+
+        bool complete = replay::forEachKeyframePacket(
+            datagram.data() + sizeof(SpectateBatchPacket),
+            datagram.size() - sizeof(SpectateBatchPacket),
+            [&opCodes](const uint8_t* packet, size_t) {
+                opCodes.push_back(packet[0]);
+            });
+        EXPECT_TRUE(complete);
+        return opCodes;
+    }
+};
+
+TEST_F(SpectatorTests, SpectatorsGetDelayedBatchesAndAreNotPlayers)
+{
+    const uint16_t port = 12370;
+    NetworkServer server(5);
+    std::atomic<int> logins{0};
+    server.setSpectators(4, 0.3f);
+    server.setOnClientLoginCallback(
+        [&](uint32_t clientId, const LoginPacket&) {
+            logins++;
+            server.sendLoginResponse(clientId, 1, 1920, 1080);
+        });
+    ASSERT_TRUE(server.start(port));
+
+    auto spectator = makeClient();
+    auto player = makeClient();
+    send(*spectator, port, NetworkMessage::createSpectatePacket(0, 0));
+    send(*player, port, NetworkMessage::createLoginPacket("bot", 0));
+
+    std::vector<uint8_t> datagram;
+    ASSERT_TRUE(receive(*player, &server, datagram));
+    ASSERT_EQ(datagram[0], OpCode::S2C_LOGIN_OK);
+    EXPECT_EQ(logins.load(), 1);
+    EXPECT_EQ(server.getSpectatorCount(), 1u);
+
+    // Spectators cannot play
+    send(*spectator, port, NetworkMessage::createLoginPacket("spy", 0));
+
+    // Join snapshot: the feed is still empty
+    ASSERT_TRUE(receive(*spectator, &server, datagram));
+    EXPECT_EQ(unpack(datagram), std::vector<uint8_t>{S2C_SCORE_UPDATE});
+
+    auto published = std::chrono::steady_clock::now();
+    for (uint32_t i = 1; i <= 3; ++i) {
+        server.sendEntitySpawn(0, i, 2, 100.0f, 100.0f);
+    }
+    ASSERT_TRUE(receive(*player, &server, datagram));
+    EXPECT_EQ(datagram[0], OpCode::S2C_ENTITY_NEW);
+
+    ASSERT_TRUE(receive(*spectator, &server, datagram));
+    EXPECT_GE(std::chrono::steady_clock::now() - published,
+              std::chrono::milliseconds(300));
+    EXPECT_EQ(unpack(datagram),
+              (std::vector<uint8_t>{S2C_ENTITY_NEW, S2C_ENTITY_NEW,
+                                    S2C_ENTITY_NEW}));
+    EXPECT_EQ(logins.load(), 1);
+
+    server.stop();
+}
+
+TEST_F(SpectatorTests, LateSpectatorGetsOnlyWhatIsAlive)
+{
+    const uint16_t port = 12371;
+    NetworkServer server(5);
+    server.setSpectators(4, 0.0f);
+    ASSERT_TRUE(server.start(port));
+
+    server.publishToSpectators(
+        0, NetworkMessage::createLoginResponsePacket(0, 1920, 1080, 0));
+    server.publishToSpectators(
+        0, NetworkMessage::createEntitySpawnPacket(1, 1, 100.0f, 200.0f, 0));
+    server.publishToSpectators(
+        0, NetworkMessage::createEntitySpawnPacket(2, 2, 300.0f, 200.0f, 0));
+    server.publishToSpectators(0, NetworkMessage::createEntityDeadPacket(2, 0));
+
+    // Let the feed release everything before anyone watches
+    auto deadline = std::chrono::steady_clock::now() +
+                    NetworkServer::SPECTATOR_BATCH_INTERVAL * 2;
+    while (std::chrono::steady_clock::now() < deadline) {
+        server.update();
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    auto spectator = makeClient();
+    send(*spectator, port, NetworkMessage::createSpectatePacket(0, 0));
+
+    std::vector<uint8_t> datagram;
+    ASSERT_TRUE(receive(*spectator, &server, datagram));
+    EXPECT_EQ(unpack(datagram),
+              (std::vector<uint8_t>{S2C_LOGIN_OK, S2C_SCORE_UPDATE,
+                                    S2C_ENTITY_NEW, S2C_HEALTH_UPDATE}));
+
+    server.stop();
+}
+
+TEST_F(SpectatorTests, SpectatorsAreResyncedPeriodically)
+{
+    const uint16_t port = 12377;
+    NetworkServer server(5);
+    server.setSpectators(4, 0.0f);
+    ASSERT_TRUE(server.start(port));
+
+    server.publishToSpectators(
+        0, NetworkMessage::createLoginResponsePacket(0, 1920, 1080, 0));
+    server.publishToSpectators(
+        0, NetworkMessage::createEntitySpawnPacket(1, 1, 100.0f, 200.0f, 0));
+
+    auto spectator = makeClient();
+    send(*spectator, port, NetworkMessage::createSpectatePacket(0, 0));
+
+    // Join snapshot, then the released packets and the resync snapshot
+    std::vector<uint8_t> datagram;
+    ASSERT_TRUE(receive(*spectator, &server, datagram));
+    auto joined = std::chrono::steady_clock::now();
+
+    bool resynced = false;
+    while (!resynced &&
+           receive(*spectator, &server, datagram,
+                   NetworkServer::SPECTATOR_SNAPSHOT_INTERVAL * 2)) {
+        std::vector<uint8_t> opCodes = unpack(datagram);
+        resynced = opCodes ==
+                   std::vector<uint8_t>{S2C_LOGIN_OK, S2C_SCORE_UPDATE,
+                                        S2C_ENTITY_NEW, S2C_HEALTH_UPDATE};
+    }
+    EXPECT_TRUE(resynced);
+    EXPECT_GE(std::chrono::steady_clock::now() - joined,
+              NetworkServer::SPECTATOR_SNAPSHOT_INTERVAL -
+                  NetworkServer::SPECTATOR_BATCH_INTERVAL);
+
+    server.stop();
+}
+
+TEST_F(SpectatorTests, RejectsSpectatorsBeyondTheLimit)
+{
+    const uint16_t port = 12372;
+    NetworkServer server(5);
+    server.setSpectators(1, 0.0f);
+    ASSERT_TRUE(server.start(port));
+
+    auto first = makeClient();
+    auto second = makeClient();
+    send(*first, port, NetworkMessage::createSpectatePacket(0, 0));
+    std::vector<uint8_t> datagram;
+    ASSERT_TRUE(receive(*first, &server, datagram));
+    EXPECT_EQ(datagram[0], OpCode::S2C_SPECTATE_BATCH);
+
+    send(*second, port, NetworkMessage::createSpectatePacket(0, 0));
+    ASSERT_TRUE(receive(*second, &server, datagram));
+    ASSERT_EQ(datagram[0], OpCode::S2C_LOGIN_REJECTED);
+    EXPECT_EQ(datagram[sizeof(Header)],
+              static_cast<uint8_t>(RejectReason::NO_SPECTATORS));
+    EXPECT_EQ(server.getSpectatorCount(), 1u);
+
+    // Leaving frees the slot
+    send(*first, port, NetworkMessage::createDisconnectPacket(0));
+    send(*second, port, NetworkMessage::createSpectatePacket(0, 0));
+    ASSERT_TRUE(receive(*second, &server, datagram));
+    EXPECT_EQ(datagram[0], OpCode::S2C_SPECTATE_BATCH);
+    EXPECT_EQ(server.getSpectatorCount(), 1u);
+
+    server.stop();
+}
+
+TEST_F(SpectatorTests, RelayFansOutOneUpstreamSpectator)
+{
+    const uint16_t upstreamPort = 12373;
+    const uint16_t relayPort = 12374;
+    NetworkServer upstream(5);
+    upstream.setSpectators(4, 0.1f);
+    ASSERT_TRUE(upstream.start(upstreamPort));
+
+    SpectatorRelay relay("127.0.0.1", upstreamPort, 0, 8, 5);
+    ASSERT_TRUE(relay.start(relayPort));
+    std::thread relayThread([&relay]() { relay.run(); });
+
+    std::vector<std::unique_ptr<boost::asio::ip::udp::socket>> viewers;
+    for (int i = 0; i < 3; ++i) {
+        viewers.push_back(makeClient());
+        send(*viewers.back(), relayPort,
+             NetworkMessage::createSpectatePacket(0, 0));
+    }
+
+    // Wait for the relay to register upstream
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (upstream.getSpectatorCount() == 0 &&
+           std::chrono::steady_clock::now() < deadline) {
+        upstream.update();
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    EXPECT_EQ(upstream.getSpectatorCount(), 1u);
+
+    upstream.publishToSpectators(
+        0, NetworkMessage::createEntitySpawnPacket(7, 3, 10.0f, 20.0f, 0));
+
+    for (auto& viewer : viewers) {
+        bool sawSpawn = false;
+        std::vector<uint8_t> datagram;
+        while (!sawSpawn && receive(*viewer, &upstream, datagram)) {
+            for (uint8_t opCode : unpack(datagram)) {
+                sawSpawn = sawSpawn || opCode == S2C_ENTITY_NEW;
+            }
+        }
+        EXPECT_TRUE(sawSpawn);
+    }
+    EXPECT_EQ(relay.getSpectatorCount(), 3u);
+    EXPECT_EQ(upstream.getSpectatorCount(), 1u);
+    EXPECT_GT(relay.getRelayedPacketCount(), 0u);
+
+    relay.stop();
+    relayThread.join();
+    upstream.stop();
+}
@@ -0,0 +1,85 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** WorkerPoolTests
+*/
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "engine/threading/WorkerPool.hpp"
+
+using namespace engine;
+
+TEST(WorkerPoolTests, RunsEveryItemOnce)
+{
+    WorkerPool pool(3);
+    std::vector<std::atomic<int>> hits(100);
+
+    pool.parallelFor(hits.size(), [&](size_t i) { hits[i]++; });
+
+    for (const auto& hit : hits) {
+        EXPECT_EQ(hit.load(), 1);
+    }
+}
+
+TEST(WorkerPoolTests, CallerOnlyPool)
+{
+    WorkerPool pool(0);
+    int sum = 0;
+
+    pool.parallelFor(10, [&](size_t i) { sum += static_cast<int>(i); });
+
+    EXPECT_EQ(pool.getThreadCount(), 0u);
+    EXPECT_EQ(sum, 45);
+}
+
+TEST(WorkerPoolTests, SpreadsWorkAcrossThreads)
+{
+    WorkerPool pool(3);
+    std::mutex mutex;
+    std::set<std::thread::id> threadIds;
+
+    pool.parallelFor(64, [&](size_t) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        std::lock_guard<std::mutex> lock(mutex);
+        threadIds.insert(std::this_thread::get_id());
+    });
+
+    EXPECT_GT(threadIds.size(), 1u);
+}
+
+TEST(WorkerPoolTests, ExceptionDoesNotStopOtherItems)
+{
+    WorkerPool pool(2);
+    std::atomic<int> completed{0};
+
+    pool.parallelFor(20, [&](size_t i) {
+        if (i == 5) {
+            throw std::runtime_error("boom");
+        }
+        completed++;
+    });
+
+    EXPECT_EQ(completed.load(), 19);
+}
+
+TEST(WorkerPoolTests, ReusableAcrossManyRounds)
+{
+    WorkerPool pool(4);
+    std::atomic<int> total{0};
+
+    for (int round = 0; round < 200; ++round) {
+        pool.parallelFor(8, [&](size_t) { total++; });
+    }
+
+    EXPECT_EQ(total.load(), 1600);
+}
@@ -0,0 +1,299 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** BotSession
+*/
+
+#include "BotSession.hpp"
+
+#include <string>
+
+#include "common/network/EntityType.hpp"
+#include "common/network/InputMask.hpp"
+#include "common/network/NetworkMessage.hpp"
+#include "common/network/Protocol.hpp"
+
+namespace rtype::loadgen {
+
+namespace {
+
+double toMilliseconds(Clock::duration duration)
+{
+    return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+Clock::duration inputPeriodFor(uint32_t inputRate)
+{
+    std::chrono::duration<double> period(1.0 / (inputRate > 0 ? inputRate : 1));
+    return std::chrono::duration_cast<Clock::duration>(period);
+}
+
+template <typename T>
+const T* packetAs(const uint8_t* data, size_t size)
+{
+    return size >= sizeof(T) ? reinterpret_cast<const T*>(data) : nullptr;
+}
+
+}  // namespace
+
+BotSession::BotSession(boost::asio::io_context& ioContext,
+                       const boost::asio::ip::udp::endpoint& server,
+                       uint32_t index, uint16_t roomId, BotScript script,
+                       uint32_t inputRate, LoadStats& stats, uint32_t seed)
+    : _socket(ioContext,
+              boost::asio::ip::udp::endpoint(server.address(), 0)),
+      _server(server),
+      _index(index),
+      _roomId(roomId),
+      _script(script),
+      _inputPeriod(inputPeriodFor(inputRate)),
+      _stats(stats),
+      _rng(seed)
+{
+    boost::system::error_code ec;
+    _socket.set_option(boost::asio::socket_base::receive_buffer_size(1 << 18),
+                       ec);
+}
+
+void BotSession::start(Clock::time_point now)
+{
+    receive();
+    sendLogin(now);
+}
+
+void BotSession::stop()
+{
+    if (!_socket.is_open()) {
+        return;
+    }
+    auto packet = NetworkMessage::createDisconnectPacket(++_sequenceId);
+    send(&packet, sizeof(packet));
+
+    boost::system::error_code ec;
+    _socket.close(ec);
+}
+
+void BotSession::update(Clock::time_point now)
+{
+    if (_state != State::InGame) {
+        if (now >= _nextLogin) {
+            sendLogin(now);
+        }
+        return;
+    }
+
+    if (now >= _nextScriptStep) {
+        stepScript(now);
+    }
+    if (now >= _nextInput) {
+        sendInput(now);
+    }
+
+    if (_probeActive && now - _probeSentAt > PROBE_TIMEOUT) {
+        _probeActive = false;
+        _stats.probesTimedOut++;
+    }
+}
+
+void BotSession::receive()
+{
+    _socket.async_receive_from(
+        boost::asio::buffer(_buffer), _sender,
+        [this](const boost::system::error_code& ec, size_t bytes) {
+            if (ec == boost::asio::error::operation_aborted) {
+                return;
+            }
+            if (!ec) {
+                handlePacket(_buffer.data(), bytes, Clock::now());
+            }
+            if (_socket.is_open()) {
+                receive();
+            }
+        });
+}
+
+void BotSession::handlePacket(const uint8_t* data, size_t size,
+                              Clock::time_point now)
+{
+    const auto* header = packetAs<Header>(data, size);
+    if (!header) {
+        return;
+    }
+
+    _stats.packetsReceived++;
+    _stats.bytesReceived += size;
+    _stats.packetsByOpCode[header->opCode]++;
+
+    if (header->sequenceId != 0) {
+        auto ack = NetworkMessage::createAckPacket(header->sequenceId);
+        send(&ack, sizeof(ack));
+    }
+
+    switch (header->opCode) {
+        case OpCode::S2C_LOGIN_OK:
+            if (_state == State::Connecting) {
+                _state = State::InGame;
+                _awaitingOwnSpawn = true;
+                _hasPosition = false;
+                _nextInput = now;
+                _nextScriptStep = now;
+                _stats.loginsAccepted++;
+                _stats.loginLatencyMs.record(
+                    toMilliseconds(now - _loginSentAt));
+            }
+            break;
+
+        case OpCode::S2C_LOGIN_REJECTED:
+            _stats.loginsRejected++;
+            _state = State::Connecting;
+            _nextLogin = now + RELOGIN_DELAY;
+            break;
+
+        case OpCode::S2C_ENTITY_NEW:
+            if (const auto* spawn = packetAs<EntitySpawnPacket>(data, size)) {
+                if (_awaitingOwnSpawn && spawn->type == EntityType::PLAYER) {
+                    _playerEntityId = spawn->entityId;
+                    _awaitingOwnSpawn = false;
+                    _lastX = spawn->x;
+                    _lastY = spawn->y;
+                    _hasPosition = true;
+                }
+            }
+            break;
+
+        case OpCode::S2C_ENTITY_POS:
+            if (const auto* pos = packetAs<EntityPositionPacket>(data, size)) {
+                onEntityPosition(pos->entityId, pos->x, pos->y, now);
+            }
+            break;
+
+        case OpCode::S2C_ENTITY_DEAD:
+            if (const auto* dead = packetAs<EntityDeadPacket>(data, size)) {
+                if (_playerEntityId != 0 &&
+                    dead->entityId == _playerEntityId) {
+                    _stats.deaths++;
+                    _state = State::Dead;
+                    _playerEntityId = 0;
+                    _probeActive = false;
+                    _nextLogin = now + RELOGIN_DELAY;
+                }
+            }
+            break;
+
+        default:
+            break;
+    }
+}
+
+void BotSession::onEntityPosition(uint32_t entityId, float x, float y,
+                                  Clock::time_point now)
+{
+    bool newBurst = _lastPositionPacket == Clock::time_point{} ||
+                    now - _lastPositionPacket > BURST_GAP;
+    if (newBurst) {
+        if (_lastBurstStart != Clock::time_point{}) {
+            _stats.tickIntervalMs.record(toMilliseconds(now - _lastBurstStart));
+        }
+        _lastBurstStart = now;
+    }
+    _lastPositionPacket = now;
+
+    if (entityId != _playerEntityId || _playerEntityId == 0) {
+        return;
+    }
+
+    if (_probeActive && (x != _probeX || y != _probeY)) {
+        _stats.inputLatencyMs.record(toMilliseconds(now - _probeSentAt));
+        _probeActive = false;
+    }
+    _lastX = x;
+    _lastY = y;
+    _hasPosition = true;
+}
+
+void BotSession::stepScript(Clock::time_point now)
+{
+    constexpr uint8_t MOVE_BITS =
+        InputMask::UP | InputMask::DOWN | InputMask::LEFT | InputMask::RIGHT;
+    uint8_t previousMask = _inputMask;
+
+    switch (_script) {
+        case BotScript::Idle:
+            _inputMask = 0;
+            _nextScriptStep = now + std::chrono::hours(1);
+            break;
+
+        case BotScript::Zigzag: {
+            static constexpr uint8_t PHASES[] = {
+                InputMask::UP | InputMask::SHOOT, 0,
+                InputMask::DOWN | InputMask::SHOOT, 0};
+            static constexpr int PHASE_MS[] = {400, 200, 400, 200};
+            _scriptPhase = (_scriptPhase + 1) % 4;
+            _inputMask = PHASES[_scriptPhase];
+            _nextScriptStep =
+                now + std::chrono::milliseconds(PHASE_MS[_scriptPhase]);
+            break;
+        }
+
+        case BotScript::Random: {
+            static constexpr uint8_t DIRECTIONS[] = {
+                0,
+                0,
+                InputMask::UP,
+                InputMask::DOWN,
+                InputMask::LEFT,
+                InputMask::RIGHT,
+                InputMask::UP | InputMask::RIGHT,
+                InputMask::DOWN | InputMask::LEFT};
+            std::uniform_int_distribution<size_t> direction(0, 7);
+            std::uniform_int_distribution<int> delay(100, 500);
+            std::bernoulli_distribution shoot(0.5);
+            _inputMask = DIRECTIONS[direction(_rng)] |
+                         (shoot(_rng) ? InputMask::SHOOT : 0);
+            _nextScriptStep = now + std::chrono::milliseconds(delay(_rng));
+            break;
+        }
+    }
+
+    if (_inputMask != previousMask) {
+        if (!(previousMask & MOVE_BITS) && (_inputMask & MOVE_BITS) &&
+            !_probeActive && _hasPosition) {
+            _probeActive = true;
+            _probeSentAt = now;
+            _probeX = _lastX;
+            _probeY = _lastY;
+        }
+        sendInput(now);
+    }
+}
+
+void BotSession::sendLogin(Clock::time_point now)
+{
+    _state = State::Connecting;
+    _loginSentAt = now;
+    _nextLogin = now + LOGIN_RETRY;
+
+    auto packet = NetworkMessage::createLoginPacket(
+        "bot" + std::to_string(_index % 10000), ++_sequenceId, _roomId);
+    send(&packet, sizeof(packet));
+}
+
+void BotSession::sendInput(Clock::time_point now)
+{
+    auto packet = NetworkMessage::createInputPacket(_inputMask, ++_sequenceId);
+    send(&packet, sizeof(packet));
+    _nextInput = now + _inputPeriod;
+}
+
+void BotSession::send(const void* data, size_t size)
+{
+    boost::system::error_code ec;
+    _socket.send_to(boost::asio::buffer(data, size), _server, 0, ec);
+    if (!ec) {
+        _stats.packetsSent++;
+        _stats.bytesSent += size;
+    }
+}
+
+}  // namespace rtype::loadgen
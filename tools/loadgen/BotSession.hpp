@@ -0,0 +1,131 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** BotSession
+*/
+
+#pragma once
+
+#include <array>
+#include <boost/asio.hpp>
+#include <chrono>
+#include <cstdint>
+#include <random>
+
+#include "LoadStats.hpp"
+
+namespace rtype::loadgen {
+
+using Clock = std::chrono::steady_clock;
+
+/**
+ * @brief How a bot chooses its inputs
+ */
+enum class BotScript {
+    Random,  ///< Random direction/shoot changes every 100-500 ms
+    Zigzag,  ///< Up, pause, down, pause while shooting (repeatable load)
+    Idle,    ///< Log in and never move (connection/broadcast load only)
+};
+
+/**
+ * @brief One headless client session driven by a LoadGenerator
+ *
+ * Speaks the raw UDP protocol directly instead of going through
+ * NetworkClientAsio, so hundreds of bots can share a single io_context and
+ * thread. Bots ACK reliable packets like the real client, log in again after
+ * their ship is destroyed, and sample timing into the shared LoadStats.
+ */
+class BotSession {
+   public:
+    /**
+     * @param ioContext Context all bots receive on
+     * @param server Server endpoint (loopback)
+     * @param index Bot number, used for its username
+     * @param roomId Room requested in the login packet
+     * @param script Input pattern
+     * @param inputRate Input packets per second while in game
+     * @param stats Shared counters
+     * @param seed Seed for the bot's random script
+     */
+    BotSession(boost::asio::io_context& ioContext,
+               const boost::asio::ip::udp::endpoint& server, uint32_t index,
+               uint16_t roomId, BotScript script, uint32_t inputRate,
+               LoadStats& stats, uint32_t seed);
+
+    BotSession(const BotSession&) = delete;
+    BotSession& operator=(const BotSession&) = delete;
+
+    /**
+     * @brief Start receiving and send the first login
+     */
+    void start(Clock::time_point now);
+
+    /**
+     * @brief Send due inputs/logins; call frequently from the driver loop
+     */
+    void update(Clock::time_point now);
+
+    /**
+     * @brief Tell the server the bot is leaving and close the socket
+     */
+    void stop();
+
+    bool isInGame() const { return _state == State::InGame; }
+
+   private:
+    enum class State { Connecting, InGame, Dead };
+
+    static constexpr auto LOGIN_RETRY = std::chrono::seconds(1);
+    static constexpr auto RELOGIN_DELAY = std::chrono::seconds(2);
+    static constexpr auto PROBE_TIMEOUT = std::chrono::seconds(1);
+    static constexpr auto BURST_GAP = std::chrono::milliseconds(4);
+
+    void receive();
+    void handlePacket(const uint8_t* data, size_t size, Clock::time_point now);
+    void onEntityPosition(uint32_t entityId, float x, float y,
+                          Clock::time_point now);
+    void stepScript(Clock::time_point now);
+    void sendLogin(Clock::time_point now);
+    void sendInput(Clock::time_point now);
+    void send(const void* data, size_t size);
+
+    boost::asio::ip::udp::socket _socket;
+    boost::asio::ip::udp::endpoint _server;
+    boost::asio::ip::udp::endpoint _sender;
+    std::array<uint8_t, 1024> _buffer{};
+
+    uint32_t _index;
+    uint16_t _roomId;
+    BotScript _script;
+    Clock::duration _inputPeriod;
+    LoadStats& _stats;
+    std::mt19937 _rng;
+
+    State _state = State::Connecting;
+    uint32_t _sequenceId = 0;
+    uint32_t _playerEntityId = 0;
+    bool _awaitingOwnSpawn = false;
+    uint8_t _inputMask = 0;
+    uint32_t _scriptPhase = 0;
+
+    Clock::time_point _loginSentAt{};
+    Clock::time_point _nextLogin{};
+    Clock::time_point _nextInput{};
+    Clock::time_point _nextScriptStep{};
+
+    // Server tick estimation: position updates arrive in one burst per frame
+    Clock::time_point _lastPositionPacket{};
+    Clock::time_point _lastBurstStart{};
+
+    // Input latency probe: time from a move input to our ship moving
+    bool _probeActive = false;
+    Clock::time_point _probeSentAt{};
+    float _probeX = 0.0f;
+    float _probeY = 0.0f;
+    float _lastX = 0.0f;
+    float _lastY = 0.0f;
+    bool _hasPosition = false;
+};
+
+}  // namespace rtype::loadgen
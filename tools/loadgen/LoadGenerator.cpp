@@ -0,0 +1,161 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** LoadGenerator
+*/
+
+#include "LoadGenerator.hpp"
+
+#include <iomanip>
+#include <string>
+#include <thread>
+
+#include "common/network/NetworkMessage.hpp"
+#include "common/network/Protocol.hpp"
+
+namespace rtype::loadgen {
+
+LoadGenerator::LoadGenerator(const LoadGenConfig& config)
+    : _config(config),
+      _server(boost::asio::ip::address_v4::loopback(), config.port)
+{
+}
+
+LoadGenerator::~LoadGenerator()
+{
+    for (auto& bot : _bots) {
+        bot->stop();
+    }
+    _ioContext.restart();
+    _ioContext.poll();
+}
+
+void LoadGenerator::run(const std::atomic<bool>& stopRequested,
+                        std::ostream& progress)
+{
+    const auto start = Clock::now();
+    const auto end = start + std::chrono::seconds(_config.durationSeconds);
+    const auto rampStep = std::chrono::milliseconds(_config.rampUpMs);
+    auto nextSpawn = start;
+    auto nextReport = start + std::chrono::seconds(1);
+
+    _bots.reserve(_config.bots);
+
+    while (!stopRequested.load() && Clock::now() < end) {
+        auto now = Clock::now();
+
+        while (_bots.size() < _config.bots && now >= nextSpawn) {
+            uint32_t index = static_cast<uint32_t>(_bots.size());
+            uint16_t roomId =
+                _config.rooms > 0 ? static_cast<uint16_t>(index % _config.rooms)
+                                  : 0;
+            auto bot = std::make_unique<BotSession>(
+                _ioContext, _server, index, roomId, _config.script,
+                _config.inputRate, _stats, _config.seed + index);
+            bot->start(now);
+            _bots.push_back(std::move(bot));
+            nextSpawn += rampStep;
+        }
+
+        _ioContext.restart();
+        _ioContext.poll();
+
+        now = Clock::now();
+        for (auto& bot : _bots) {
+            bot->update(now);
+        }
+
+        if (now >= nextReport) {
+            _elapsedSeconds =
+                std::chrono::duration<double>(now - start).count();
+            printProgress(progress, _elapsedSeconds);
+            nextReport += std::chrono::seconds(1);
+        }
+
+        std::this_thread::sleep_for(std::chrono::microseconds(500));
+    }
+
+    _elapsedSeconds =
+        std::chrono::duration<double>(Clock::now() - start).count();
+    for (auto& bot : _bots) {
+        bot->stop();
+    }
+    _ioContext.restart();
+    _ioContext.poll();
+}
+
+void LoadGenerator::printProgress(std::ostream& out, double elapsedSeconds)
+{
+    size_t inGame = 0;
+    for (const auto& bot : _bots) {
+        if (bot->isInGame()) inGame++;
+    }
+
+    out << std::fixed << std::setprecision(0) << "[" << elapsedSeconds
+        << "s] bots " << inGame << "/" << _bots.size() << " in game | in "
+        << (_stats.packetsReceived - _lastPacketsReceived) << " pkt/s "
+        << std::setprecision(1)
+        << (_stats.bytesReceived - _lastBytesReceived) / 1024.0
+        << " KiB/s | out "
+        << (_stats.packetsSent - _lastPacketsSent) << " pkt/s "
+        << (_stats.bytesSent - _lastBytesSent) / 1024.0 << " KiB/s | tick p50 "
+        << _stats.tickIntervalMs.percentile(0.5) << " ms" << std::endl;
+
+    _lastPacketsReceived = _stats.packetsReceived;
+    _lastBytesReceived = _stats.bytesReceived;
+    _lastPacketsSent = _stats.packetsSent;
+    _lastBytesSent = _stats.bytesSent;
+}
+
+void LoadGenerator::printReport(std::ostream& out) const
+{
+    const double seconds = _elapsedSeconds > 0.0 ? _elapsedSeconds : 1.0;
+
+    auto printHistogram = [&out](const char* name,
+                                 const LatencyHistogram& histogram) {
+        out << "  " << std::left << std::setw(22) << name << std::right
+            << std::fixed << std::setprecision(2);
+        if (histogram.count() == 0) {
+            out << "no samples" << std::endl;
+            return;
+        }
+        out << "p50 " << histogram.percentile(0.50) << "  p90 "
+            << histogram.percentile(0.90) << "  p99 "
+            << histogram.percentile(0.99) << "  max " << histogram.max()
+            << " ms  (" << histogram.count() << " samples)" << std::endl;
+    };
+
+    out << "========================================" << std::endl;
+    out << "  Load report: " << _bots.size() << " bot(s), " << std::fixed
+        << std::setprecision(1) << seconds << " s" << std::endl;
+    out << "========================================" << std::endl;
+    out << "  Logins accepted:      " << _stats.loginsAccepted << std::endl;
+    out << "  Logins rejected:      " << _stats.loginsRejected << std::endl;
+    out << "  Bot deaths:           " << _stats.deaths << std::endl;
+    out << "  Received:             " << _stats.packetsReceived << " pkt ("
+        << _stats.packetsReceived / seconds << " pkt/s, "
+        << _stats.bytesReceived / seconds / 1024.0 << " KiB/s)" << std::endl;
+    out << "  Sent:                 " << _stats.packetsSent << " pkt ("
+        << _stats.packetsSent / seconds << " pkt/s, "
+        << _stats.bytesSent / seconds / 1024.0 << " KiB/s)" << std::endl;
+    printHistogram("Login latency:", _stats.loginLatencyMs);
+    printHistogram("Server tick interval:", _stats.tickIntervalMs);
+    printHistogram("Input latency:", _stats.inputLatencyMs);
+    if (_stats.probesTimedOut > 0) {
+        out << "  Input probes lost:    " << _stats.probesTimedOut << std::endl;
+    }
+
+    out << "  Received by opcode:" << std::endl;
+    for (size_t opCode = 0; opCode < _stats.packetsByOpCode.size(); ++opCode) {
+        uint64_t count = _stats.packetsByOpCode[opCode];
+        if (count == 0) continue;
+        std::string name =
+            NetworkMessage::opCodeToString(static_cast<uint8_t>(opCode)) +
+            " (" + std::to_string(opCode) + ")";
+        out << "    " << std::left << std::setw(26) << name << std::right
+            << count << std::endl;
+    }
+}
+
+}  // namespace rtype::loadgen
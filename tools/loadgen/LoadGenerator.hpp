@@ -0,0 +1,78 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** LoadGenerator
+*/
+
+#pragma once
+
+#include <atomic>
+#include <boost/asio.hpp>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <vector>
+
+#include "BotSession.hpp"
+#include "LoadStats.hpp"
+
+namespace rtype::loadgen {
+
+/**
+ * @brief Parameters of a load run
+ */
+struct LoadGenConfig {
+    uint16_t port = 8080;
+    uint32_t bots = 100;
+    uint16_t rooms = 0;  ///< 0 = every bot joins room 0, N = spread over N
+    uint32_t durationSeconds = 30;
+    uint32_t inputRate = 60;  ///< Input packets per second per bot
+    uint32_t rampUpMs = 10;   ///< Delay between two bot logins
+    BotScript script = BotScript::Random;
+    uint32_t seed = 1;
+};
+
+/**
+ * @brief Drives many BotSessions against a local server and reports stats
+ *
+ * All bots share one io_context and are pumped from the calling thread, so a
+ * run costs one core however many bots it simulates. Only loopback servers
+ * are targeted.
+ */
+class LoadGenerator {
+   public:
+    explicit LoadGenerator(const LoadGenConfig& config);
+    ~LoadGenerator();
+
+    /**
+     * @brief Run until the configured duration elapses or stop is requested
+     * @param stopRequested Set from a signal handler to end the run early
+     * @param progress Stream receiving one status line per second
+     */
+    void run(const std::atomic<bool>& stopRequested, std::ostream& progress);
+
+    /**
+     * @brief Print the final summary
+     */
+    void printReport(std::ostream& out) const;
+
+    const LoadStats& getStats() const { return _stats; }
+
+   private:
+    void printProgress(std::ostream& out, double elapsedSeconds);
+
+    LoadGenConfig _config;
+    boost::asio::io_context _ioContext;
+    boost::asio::ip::udp::endpoint _server;
+    LoadStats _stats;
+    std::vector<std::unique_ptr<BotSession>> _bots;
+    double _elapsedSeconds = 0.0;
+
+    uint64_t _lastPacketsReceived = 0;
+    uint64_t _lastBytesReceived = 0;
+    uint64_t _lastPacketsSent = 0;
+    uint64_t _lastBytesSent = 0;
+};
+
+}  // namespace rtype::loadgen
@@ -0,0 +1,51 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** LoadStats
+*/
+
+#include "LoadStats.hpp"
+
+#include <algorithm>
+
+namespace rtype::loadgen {
+
+LatencyHistogram::LatencyHistogram()
+    : _buckets(static_cast<size_t>(MAX_MS / BUCKET_MS) + 1, 0)
+{
+}
+
+void LatencyHistogram::record(double milliseconds)
+{
+    milliseconds = std::max(milliseconds, 0.0);
+    size_t index = std::min(static_cast<size_t>(milliseconds / BUCKET_MS),
+                            _buckets.size() - 1);
+    _buckets[index]++;
+    _count++;
+    _sum += milliseconds;
+    _max = std::max(_max, milliseconds);
+}
+
+double LatencyHistogram::percentile(double fraction) const
+{
+    if (_count == 0) {
+        return 0.0;
+    }
+
+    fraction = std::clamp(fraction, 0.0, 1.0);
+    uint64_t target = std::max<uint64_t>(
+        1, static_cast<uint64_t>(fraction * static_cast<double>(_count) + 0.5));
+    uint64_t seen = 0;
+    for (size_t i = 0; i < _buckets.size(); ++i) {
+        seen += _buckets[i];
+        if (seen >= target) {
+            return i + 1 == _buckets.size()
+                       ? _max
+                       : std::min((i + 1) * BUCKET_MS, _max);
+        }
+    }
+    return _max;
+}
+
+}  // namespace rtype::loadgen
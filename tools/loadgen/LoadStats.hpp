@@ -0,0 +1,70 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** LoadStats
+*/
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace rtype::loadgen {
+
+/**
+ * @brief Fixed-resolution histogram of durations in milliseconds
+ *
+ * Memory stays constant however long the run is: samples are counted in
+ * 0.1 ms buckets up to MAX_MS, anything slower lands in an overflow bucket.
+ */
+class LatencyHistogram {
+   public:
+    static constexpr double BUCKET_MS = 0.1;
+    static constexpr double MAX_MS = 2000.0;
+
+    LatencyHistogram();
+
+    void record(double milliseconds);
+
+    /**
+     * @brief Get the value below which a fraction of samples fall
+     * @param fraction Percentile in [0, 1] (e.g. 0.99 for p99)
+     * @return Upper bound of the matching bucket, 0 if empty
+     */
+    double percentile(double fraction) const;
+
+    uint64_t count() const { return _count; }
+    double mean() const { return _count ? _sum / _count : 0.0; }
+    double max() const { return _max; }
+
+   private:
+    std::vector<uint64_t> _buckets;
+    uint64_t _count = 0;
+    double _sum = 0.0;
+    double _max = 0.0;
+};
+
+/**
+ * @brief Counters shared by every bot of a load run
+ * @note Not thread-safe: all bots are driven from one thread
+ */
+struct LoadStats {
+    uint64_t packetsSent = 0;
+    uint64_t bytesSent = 0;
+    uint64_t packetsReceived = 0;
+    uint64_t bytesReceived = 0;
+    std::array<uint64_t, 256> packetsByOpCode{};
+
+    uint64_t loginsAccepted = 0;
+    uint64_t loginsRejected = 0;
+    uint64_t deaths = 0;
+    uint64_t probesTimedOut = 0;
+
+    LatencyHistogram loginLatencyMs;  ///< C2S_LOGIN -> S2C_LOGIN_OK
+    LatencyHistogram tickIntervalMs;  ///< Gap between server update bursts
+    LatencyHistogram inputLatencyMs;  ///< Input -> own position change
+};
+
+}  // namespace rtype::loadgen
@@ -0,0 +1,90 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** ReplayGenMain
+*/
+
+#include <chrono>
+#include <iostream>
+#include <string>
+
+#include "ReplayGenerator.hpp"
+
+static void printUsage(const char* program)
+{
+    std::cout
+        << "Usage: " << program << " [options]\n"
+        << "Write a synthetic replay, e.g. to benchmark r-type_replaystats\n\n"
+        << "  --output FILE   Replay file (default synthetic.rtr)\n"
+        << "  --duration S    Simulated seconds (default 3600)\n"
+        << "  --entities N    Entities alive at once (default 40)\n"
+        << "  --rate HZ       Position updates per second (default 60)\n"
+        << "  --seed N        Random seed (default 1)\n";
+}
+
+static bool parseArguments(int argc, char** argv,
+                           rtype::loadgen::ReplayGenConfig& config)
+{
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h") {
+            return false;
+        }
+        if (i + 1 >= argc) {
+            std::cerr << "Missing value for " << arg << std::endl;
+            return false;
+        }
+        std::string value = argv[++i];
+
+        try {
+            if (arg == "--output") {
+                config.output = value;
+            } else if (arg == "--duration") {
+                config.durationSeconds =
+                    static_cast<uint32_t>(std::stoul(value));
+            } else if (arg == "--entities") {
+                config.entities = static_cast<uint32_t>(std::stoul(value));
+            } else if (arg == "--rate") {
+                config.tickRate = static_cast<uint32_t>(std::stoul(value));
+            } else if (arg == "--seed") {
+                config.seed = static_cast<uint32_t>(std::stoul(value));
+            } else {
+                std::cerr << "Unknown option: " << arg << std::endl;
+                return false;
+            }
+        } catch (const std::exception&) {
+            std::cerr << "Invalid value for " << arg << ": " << value
+                      << std::endl;
+            return false;
+        }
+    }
+    if (config.entities == 0 || config.tickRate == 0) {
+        std::cerr << "--entities and --rate must be positive" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    rtype::loadgen::ReplayGenConfig config;
+    if (!parseArguments(argc, argv, config)) {
+        printUsage(argv[0]);
+        return 84;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    rtype::loadgen::ReplayGenerator generator(config);
+    if (!generator.run(std::cout)) {
+        std::cerr << "Failed to write " << config.output << std::endl;
+        return 84;
+    }
+    std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+
+    std::cout << "Wrote " << generator.getPacketCount() << " packets to "
+              << config.output << " in " << elapsed.count() << " s"
+              << std::endl;
+    return 0;
+}
@@ -0,0 +1,145 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** ReplayGenerator
+*/
+
+#include "ReplayGenerator.hpp"
+
+#include <array>
+
+#include "common/network/EntityType.hpp"
+#include "common/network/Protocol.hpp"
+
+namespace rtype::loadgen {
+
+namespace {
+
+constexpr uint16_t MAP_WIDTH = 1920;
+constexpr uint16_t MAP_HEIGHT = 1080;
+
+// Enemies and the shots flying around, which come and go the same way
+constexpr std::array<uint8_t, 8> ENEMY_TYPES = {
+    EntityType::BASIC,   EntityType::BASIC_MISSILE, EntityType::TANK,
+    EntityType::FAST,    EntityType::TURRET,        EntityType::ORBITER,
+    EntityType::GREEN_BULLET, EntityType::PLAYER_MISSILE,
+};
+
+}  // namespace
+
+ReplayGenerator::ReplayGenerator(const ReplayGenConfig& config)
+    : _config(config),
+      _recorder(config.output, RING_CAPACITY),
+      _random(config.seed)
+{
+    _recorder.setClock([this]() { return _now; });
+}
+
+template <typename T>
+void ReplayGenerator::record(const T& packet)
+{
+    _state.apply(&packet, sizeof(packet));
+    _recorder.recordPacket(&packet, sizeof(packet));
+    _packetCount++;
+}
+
+void ReplayGenerator::spawn(Slot& slot, uint8_t type)
+{
+    std::uniform_real_distribution<float> y(0.0f, MAP_HEIGHT);
+
+    slot.entityId = _nextEntityId++;
+    slot.type = type;
+    slot.x = type == EntityType::PLAYER ? 200.0f : MAP_WIDTH;
+    slot.y = y(_random);
+
+    EntitySpawnPacket packet{};
+    packet.header.opCode = S2C_ENTITY_NEW;
+    packet.entityId = slot.entityId;
+    packet.type = slot.type;
+    packet.x = slot.x;
+    packet.y = slot.y;
+    record(packet);
+}
+
+void ReplayGenerator::tick()
+{
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    std::uniform_int_distribution<size_t> enemyType(0, ENEMY_TYPES.size() - 1);
+    float dt = 1.0f / static_cast<float>(_config.tickRate);
+    float deathChance = dt / ENEMY_LIFETIME_S;
+
+    if (_recorder.isKeyframeDue()) {
+        std::vector<uint8_t> keyframe;
+        _state.appendKeyframe(keyframe);
+        _recorder.recordKeyframe(keyframe);
+    }
+
+    for (Slot& slot : _slots) {
+        if (slot.type != EntityType::PLAYER && unit(_random) < deathChance) {
+            EntityDeadPacket dead{};
+            dead.header.opCode = S2C_ENTITY_DEAD;
+            dead.entityId = slot.entityId;
+            record(dead);
+            spawn(slot, ENEMY_TYPES[enemyType(_random)]);
+        }
+
+        if (slot.type == EntityType::PLAYER) {
+            slot.y += (unit(_random) - 0.5f) * 400.0f * dt;
+        } else {
+            slot.x -= 150.0f * dt;
+        }
+        EntityPositionPacket position{};
+        position.header.opCode = S2C_ENTITY_POS;
+        position.entityId = slot.entityId;
+        position.x = slot.x;
+        position.y = slot.y;
+        record(position);
+    }
+}
+
+bool ReplayGenerator::run(std::ostream& progress)
+{
+    if (!_recorder.startRecording()) {
+        return false;
+    }
+
+    LoginResponsePacket login{};
+    login.header.opCode = S2C_LOGIN_OK;
+    login.playerId = 1;
+    login.mapWidth = MAP_WIDTH;
+    login.mapHeight = MAP_HEIGHT;
+    record(login);
+
+    std::uniform_int_distribution<size_t> enemyType(0, ENEMY_TYPES.size() - 1);
+    _slots.resize(_config.entities);
+    for (size_t i = 0; i < _slots.size(); ++i) {
+        spawn(_slots[i],
+              i == 0 ? EntityType::PLAYER : ENEMY_TYPES[enemyType(_random)]);
+    }
+
+    uint64_t ticks =
+        static_cast<uint64_t>(_config.durationSeconds) * _config.tickRate;
+    for (uint64_t i = 1; i <= ticks; ++i) {
+        _now = i * 1000 / _config.tickRate;
+        tick();
+
+        if (i % _config.tickRate != 0) {
+            continue;
+        }
+        uint64_t second = i / _config.tickRate;
+        if (second % WAIT_INTERVAL_S == 0) {
+            _recorder.waitForWriter();
+        }
+        if (second % PROGRESS_INTERVAL_S == 0) {
+            progress << "[" << second << "s] " << _packetCount << " packets"
+                     << std::endl;
+        }
+    }
+
+    _recorder.setGameInfo(1, 1, 0);
+    _recorder.stopRecording();
+    return _recorder.getDroppedRecordCount() == 0;
+}
+
+}  // namespace rtype::loadgen
@@ -0,0 +1,86 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** ReplayGenerator
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "common/replay/ReplayRecorder.hpp"
+#include "common/replay/ReplayState.hpp"
+
+namespace rtype::loadgen {
+
+/**
+ * @brief Parameters of a synthetic replay
+ */
+struct ReplayGenConfig {
+    std::string output = "synthetic.rtr";
+    uint32_t durationSeconds = 3600;
+    uint32_t entities = 40;  ///< Entities alive at any time, player included
+    uint32_t tickRate = 60;  ///< Position packets per second per entity
+    uint32_t seed = 1;
+};
+
+/**
+ * @brief Writes a synthetic replay file without a server
+ *
+ * The player and the enemies move every tick; enemies die at random and
+ * are replaced by a new spawn right away. Packets go through a
+ * ReplayRecorder on a simulated clock, with keyframes whenever it asks for
+ * one, so the file is what a real match of that size would produce. The
+ * defaults give about 9M packets, the replay used to benchmark
+ * r-type_replaystats.
+ */
+class ReplayGenerator {
+   public:
+    explicit ReplayGenerator(const ReplayGenConfig& config);
+
+    /**
+     * @brief Record the whole replay, as fast as the writer keeps up
+     * @param progress Stream receiving a status line every simulated
+     * PROGRESS_INTERVAL_S
+     * @return false if the file could not be written or records were lost
+     */
+    bool run(std::ostream& progress);
+
+    uint64_t getPacketCount() const { return _packetCount; }
+
+   private:
+    struct Slot {
+        uint32_t entityId;
+        uint8_t type;
+        float x;
+        float y;
+    };
+
+    // The simulated clock runs much faster than the writer drains the
+    // ring, so recording pauses for it every WAIT_INTERVAL_S
+    static constexpr size_t RING_CAPACITY = 16 * 1024 * 1024;
+    static constexpr uint32_t WAIT_INTERVAL_S = 60;
+    static constexpr uint32_t PROGRESS_INTERVAL_S = 600;
+    static constexpr float ENEMY_LIFETIME_S = 5.0f;
+
+    template <typename T>
+    void record(const T& packet);
+    void spawn(Slot& slot, uint8_t type);
+    void tick();
+
+    ReplayGenConfig _config;
+    ReplayRecorder _recorder;
+    ReplayState _state;
+    std::vector<Slot> _slots;
+    std::mt19937 _random;
+    uint64_t _now = 0;
+    uint32_t _nextEntityId = 1;
+    uint64_t _packetCount = 0;
+};
+
+}  // namespace rtype::loadgen
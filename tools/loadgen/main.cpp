@@ -0,0 +1,123 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** main
+*/
+
+#include <atomic>
+#include <csignal>
+#include <iostream>
+#include <string>
+
+#include "LoadGenerator.hpp"
+
+static std::atomic<bool> g_stopRequested{false};
+
+static void signalHandler(int signal)
+{
+    if (signal == SIGINT || signal == SIGTERM) {
+        g_stopRequested.store(true);
+    }
+}
+
+static void printUsage(const char* program)
+{
+    std::cout
+        << "Usage: " << program << " [options]\n"
+        << "Headless bots against an R-Type server on 127.0.0.1\n\n"
+        << "  --port N       Server port (default 8080)\n"
+        << "  --bots N       Number of bot sessions (default 100)\n"
+        << "  --rooms N      Spread bots over rooms 0..N-1 (default 0)\n"
+        << "  --duration S   Run time in seconds (default 30)\n"
+        << "  --rate HZ      Inputs per second per bot (default 60)\n"
+        << "  --ramp MS      Delay between bot logins (default 10)\n"
+        << "  --script NAME  random | zigzag | idle (default random)\n"
+        << "  --seed N       Seed for random scripts (default 1)\n";
+}
+
+static bool parseArguments(int argc, char** argv,
+                           rtype::loadgen::LoadGenConfig& config)
+{
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h") {
+            return false;
+        }
+        if (i + 1 >= argc) {
+            std::cerr << "Missing value for " << arg << std::endl;
+            return false;
+        }
+        std::string value = argv[++i];
+
+        try {
+            if (arg == "--port") {
+                config.port = static_cast<uint16_t>(std::stoul(value));
+            } else if (arg == "--bots") {
+                config.bots = static_cast<uint32_t>(std::stoul(value));
+            } else if (arg == "--rooms") {
+                config.rooms = static_cast<uint16_t>(std::stoul(value));
+            } else if (arg == "--duration") {
+                config.durationSeconds =
+                    static_cast<uint32_t>(std::stoul(value));
+            } else if (arg == "--rate") {
+                config.inputRate = static_cast<uint32_t>(std::stoul(value));
+            } else if (arg == "--ramp") {
+                config.rampUpMs = static_cast<uint32_t>(std::stoul(value));
+            } else if (arg == "--seed") {
+                config.seed = static_cast<uint32_t>(std::stoul(value));
+            } else if (arg == "--script") {
+                if (value == "random") {
+                    config.script = rtype::loadgen::BotScript::Random;
+                } else if (value == "zigzag") {
+                    config.script = rtype::loadgen::BotScript::Zigzag;
+                } else if (value == "idle") {
+                    config.script = rtype::loadgen::BotScript::Idle;
+                } else {
+                    std::cerr << "Unknown script: " << value << std::endl;
+                    return false;
+                }
+            } else {
+                std::cerr << "Unknown option: " << arg << std::endl;
+                return false;
+            }
+        } catch (const std::exception&) {
+            std::cerr << "Invalid value for " << arg << ": " << value
+                      << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    rtype::loadgen::LoadGenConfig config;
+    if (!parseArguments(argc, argv, config)) {
+        printUsage(argv[0]);
+        return 84;
+    }
+
+    std::signal(SIGINT, signalHandler);
+    std::signal(SIGTERM, signalHandler);
+
+    std::cout << "========================================" << std::endl;
+    std::cout << "  R-Type Load Generator" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "  Target: 127.0.0.1:" << config.port << std::endl;
+    std::cout << "  Bots: " << config.bots << " at " << config.inputRate
+              << " inputs/s" << std::endl;
+    std::cout << "  Duration: " << config.durationSeconds << " s" << std::endl;
+    std::cout << "  Press Ctrl+C to stop early" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    try {
+        rtype::loadgen::LoadGenerator generator(config);
+        generator.run(g_stopRequested, std::cout);
+        generator.printReport(std::cout);
+    } catch (const std::exception& e) {
+        std::cerr << "Load generator failed: " << e.what() << std::endl;
+        return 84;
+    }
+    return 0;
+}
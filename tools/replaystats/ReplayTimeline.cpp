@@ -0,0 +1,167 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** ReplayTimeline
+*/
+
+#include "ReplayTimeline.hpp"
+
+#include <string>
+
+#include "common/network/NetworkMessage.hpp"
+#include "common/network/Protocol.hpp"
+
+namespace rtype::replaystats {
+
+namespace {
+
+// Opcodes and types this build has no name for keep their number
+std::string opCodeName(uint8_t opCode)
+{
+    std::string name = NetworkMessage::opCodeToString(opCode);
+    return name == "UNKNOWN" ? "OPCODE_" + std::to_string(opCode) : name;
+}
+
+std::string entityTypeName(uint8_t type)
+{
+    std::string name = NetworkMessage::entityTypeToString(type);
+    return name == "UNKNOWN" ? "TYPE_" + std::to_string(type) : name;
+}
+
+/**
+ * @brief Write the non-zero counters of an array as a JSON object
+ */
+template <typename ToString>
+void writeCounters(std::ostream& output,
+                   const std::array<uint32_t, 256>& counters,
+                   ToString toString)
+{
+    output << '{';
+    bool first = true;
+    for (size_t i = 0; i < counters.size(); ++i) {
+        if (counters[i] == 0) {
+            continue;
+        }
+        output << (first ? "" : ",") << '"'
+               << toString(static_cast<uint8_t>(i)) << "\":" << counters[i];
+        first = false;
+    }
+    output << '}';
+}
+
+}  // namespace
+
+void ReplayTimeline::analyze(ReplayPlayer& player)
+{
+    _seconds.clear();
+    _seconds.reserve(player.getTotalDuration() / 1000 + 1);
+    _current = TimelineSecond{};
+    _opCodesSeen.reset();
+    _typesSeen.reset();
+
+    player.setSpeed(PlaybackSpeed::Normal);
+    player.startPlayback([this](const void* data, size_t size) {
+        countPacket(data, size);
+    });
+    while (!player.isFinished()) {
+        // At 1x every packet reaches the callback, up to the end of the
+        // second
+        player.update(1.0f);
+        closeSecond(player.getState());
+    }
+    player.stop();
+}
+
+void ReplayTimeline::countPacket(const void* data, size_t size)
+{
+    if (size < sizeof(Header)) {
+        return;
+    }
+    uint8_t opCode = static_cast<const uint8_t*>(data)[0];
+
+    _current.packets++;
+    _current.bytes += size;
+    _current.packetsByOpCode[opCode]++;
+    _opCodesSeen.set(opCode);
+
+    if (opCode == S2C_ENTITY_NEW) {
+        _current.spawns++;
+    } else if (opCode == S2C_ENTITY_DEAD) {
+        _current.deaths++;
+    }
+}
+
+void ReplayTimeline::closeSecond(const ReplayState& state)
+{
+    for (const auto& [id, entity] : state.getEntities()) {
+        _current.entitiesByType[entity.type]++;
+        _typesSeen.set(entity.type);
+    }
+    _current.entities = static_cast<uint32_t>(state.getEntities().size());
+    _current.second = _seconds.size() + 1;
+
+    _seconds.push_back(_current);
+    _current = TimelineSecond{};
+}
+
+void ReplayTimeline::writeCsv(std::ostream& output) const
+{
+    output << "second,packets,bytes,spawns,deaths,entities";
+    for (size_t opCode = 0; opCode < 256; ++opCode) {
+        if (_opCodesSeen[opCode]) {
+            output << ',' << opCodeName(static_cast<uint8_t>(opCode));
+        }
+    }
+    for (size_t type = 0; type < 256; ++type) {
+        if (_typesSeen[type]) {
+            output << ',' << entityTypeName(static_cast<uint8_t>(type));
+        }
+    }
+    output << '\n';
+
+    for (const TimelineSecond& row : _seconds) {
+        output << row.second << ',' << row.packets << ',' << row.bytes << ','
+               << row.spawns << ',' << row.deaths << ',' << row.entities;
+        for (size_t opCode = 0; opCode < 256; ++opCode) {
+            if (_opCodesSeen[opCode]) {
+                output << ',' << row.packetsByOpCode[opCode];
+            }
+        }
+        for (size_t type = 0; type < 256; ++type) {
+            if (_typesSeen[type]) {
+                output << ',' << row.entitiesByType[type];
+            }
+        }
+        output << '\n';
+    }
+}
+
+void ReplayTimeline::writeJson(std::ostream& output, const std::string& name,
+                               uint64_t durationMs) const
+{
+    // Replay names are file names: only quotes and backslashes need escaping
+    output << "{\"replay\":\"";
+    for (char c : name) {
+        if (c == '"' || c == '\\') {
+            output << '\\';
+        }
+        output << c;
+    }
+    output << "\",\"durationMs\":" << durationMs << ",\"seconds\":[";
+
+    for (size_t i = 0; i < _seconds.size(); ++i) {
+        const TimelineSecond& row = _seconds[i];
+        output << (i == 0 ? "\n" : ",\n") << "{\"second\":" << row.second
+               << ",\"packets\":" << row.packets << ",\"bytes\":" << row.bytes
+               << ",\"spawns\":" << row.spawns << ",\"deaths\":" << row.deaths
+               << ",\"entities\":" << row.entities << ",\"opCodes\":";
+        writeCounters(output, row.packetsByOpCode, opCodeName);
+        output << ",\"entityTypes\":";
+        writeCounters(output, row.entitiesByType, entityTypeName);
+        output << '}';
+    }
+    output << "\n]}\n";
+}
+
+}  // namespace rtype::replaystats
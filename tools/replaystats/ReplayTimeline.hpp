@@ -0,0 +1,77 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** ReplayTimeline
+*/
+
+#pragma once
+
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "common/replay/ReplayPlayer.hpp"
+
+namespace rtype::replaystats {
+
+/**
+ * @brief What a replay shows during one second of play
+ *
+ * Packet counters cover the packets recorded during that second, entity
+ * counts the entities alive at its end.
+ */
+struct TimelineSecond {
+    uint64_t second = 0;  ///< Covers (second - 1, second] seconds
+    uint64_t packets = 0;
+    uint64_t bytes = 0;
+    uint32_t spawns = 0;  ///< S2C_ENTITY_NEW packets
+    uint32_t deaths = 0;  ///< S2C_ENTITY_DEAD packets
+    uint32_t entities = 0;
+    std::array<uint32_t, 256> packetsByOpCode{};
+    std::array<uint32_t, 256> entitiesByType{};
+};
+
+/**
+ * @brief Per-second statistics of a replay
+ *
+ * The replay is played through a ReplayPlayer one second at a time, as
+ * fast as it can be read: every packet goes through the player's callback
+ * and entity counts come from its headless state, so nothing is drawn.
+ */
+class ReplayTimeline {
+   public:
+    /**
+     * @brief Play the whole replay and collect one row per second
+     * @param player A loaded player, restarted from the beginning
+     */
+    void analyze(ReplayPlayer& player);
+
+    const std::vector<TimelineSecond>& getSeconds() const { return _seconds; }
+
+    /**
+     * @brief One row per second, one column per opcode and entity type
+     * that appears anywhere in the replay
+     */
+    void writeCsv(std::ostream& output) const;
+
+    /**
+     * @brief One object per second, listing only non-zero counters
+     */
+    void writeJson(std::ostream& output, const std::string& name,
+                   uint64_t durationMs) const;
+
+   private:
+    std::vector<TimelineSecond> _seconds;
+    TimelineSecond _current;
+    std::bitset<256> _opCodesSeen;
+    std::bitset<256> _typesSeen;
+
+    void countPacket(const void* data, size_t size);
+    void closeSecond(const ReplayState& state);
+};
+
+}  // namespace rtype::replaystats
@@ -0,0 +1,116 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** main
+*/
+
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include "ReplayTimeline.hpp"
+#include "common/replay/ReplayPlayer.hpp"
+
+struct StatsConfig {
+    std::string replayPath;
+    std::string outputPath;
+    bool json = false;
+};
+
+static void printUsage(const char* program)
+{
+    std::cout
+        << "Usage: " << program << " --replay FILE [options]\n"
+        << "Export per-second statistics of a replay (.rtr)\n\n"
+        << "  --replay FILE   Replay to analyze\n"
+        << "  --format FMT    csv (default) or json\n"
+        << "  --output FILE   Write there instead of the standard output\n";
+}
+
+static bool parseArguments(int argc, char** argv, StatsConfig& config)
+{
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h") {
+            return false;
+        }
+        if (i + 1 >= argc) {
+            std::cerr << "Missing value for " << arg << std::endl;
+            return false;
+        }
+        std::string value = argv[++i];
+
+        if (arg == "--replay") {
+            config.replayPath = value;
+        } else if (arg == "--output") {
+            config.outputPath = value;
+        } else if (arg == "--format") {
+            if (value != "csv" && value != "json") {
+                std::cerr << "Invalid value for " << arg << ": " << value
+                          << std::endl;
+                return false;
+            }
+            config.json = value == "json";
+        } else {
+            std::cerr << "Unknown option: " << arg << std::endl;
+            return false;
+        }
+    }
+    if (config.replayPath.empty()) {
+        std::cerr << "Missing --replay" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    StatsConfig config;
+    if (!parseArguments(argc, argv, config)) {
+        printUsage(argv[0]);
+        return 84;
+    }
+
+    // ReplayPlayer logs to the standard output, which may carry the export
+    std::streambuf* standardOutput = std::cout.rdbuf(std::cerr.rdbuf());
+    rtype::ReplayPlayer player(config.replayPath);
+    bool loaded = player.load();
+
+    auto started = std::chrono::steady_clock::now();
+    rtype::replaystats::ReplayTimeline timeline;
+    if (loaded) {
+        timeline.analyze(player);
+    }
+    std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - started;
+    std::cout.rdbuf(standardOutput);
+    if (!loaded) {
+        return 84;
+    }
+
+    std::ofstream file;
+    if (!config.outputPath.empty()) {
+        file.open(config.outputPath);
+        if (!file) {
+            std::cerr << "Cannot write " << config.outputPath << std::endl;
+            return 84;
+        }
+    }
+    std::ostream& output = file.is_open() ? file : std::cout;
+
+    if (config.json) {
+        timeline.writeJson(output, player.getReplayName(),
+                           player.getTotalDuration());
+    } else {
+        timeline.writeCsv(output);
+    }
+    output.flush();
+
+    std::cerr << std::fixed << std::setprecision(3)
+              << timeline.getSeconds().size() << " seconds analyzed in "
+              << elapsed.count() << " s" << std::endl;
+    return output ? 0 : 84;
+}
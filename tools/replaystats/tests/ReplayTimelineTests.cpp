@@ -0,0 +1,211 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** ReplayTimelineTests
+*/
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <sstream>
+#include <string>
+
+#include "ReplayTimeline.hpp"
+#include "common/network/EntityType.hpp"
+#include "common/network/Protocol.hpp"
+#include "common/replay/ReplayPlayer.hpp"
+#include "common/replay/ReplayRecorder.hpp"
+
+using namespace rtype;
+using namespace rtype::replaystats;
+
+namespace {
+
+EntitySpawnPacket makeSpawn(uint32_t id, uint8_t type)
+{
+    EntitySpawnPacket spawn{};
+    spawn.header.opCode = S2C_ENTITY_NEW;
+    spawn.entityId = id;
+    spawn.type = type;
+    spawn.x = 100.0f;
+    spawn.y = 100.0f;
+    return spawn;
+}
+
+EntityPositionPacket makePosition(uint32_t id)
+{
+    EntityPositionPacket position{};
+    position.header.opCode = S2C_ENTITY_POS;
+    position.entityId = id;
+    position.x = 200.0f;
+    position.y = 100.0f;
+    return position;
+}
+
+}  // namespace
+
+class ReplayTimelineTests : public ::testing::Test {
+   protected:
+    std::filesystem::path path;
+
+    void SetUp() override
+    {
+        path = std::filesystem::temp_directory_path() /
+               ("rtype_timeline_" +
+                std::string(::testing::UnitTest::GetInstance()
+                                ->current_test_info()
+                                ->name()) +
+                ".rtr");
+    }
+
+    void TearDown() override { std::filesystem::remove(path); }
+
+    template <typename T>
+    static void record(ReplayRecorder& recorder, const T& packet)
+    {
+        recorder.recordPacket(&packet, sizeof(packet));
+    }
+
+    /**
+     * @brief Record 2.5 s of play on a simulated clock:
+     * - second 1: login, a player and two basic enemies spawn and move;
+     * - second 2: a tank spawns, the player moves, an enemy dies;
+     * - second 3: the player moves and the score changes.
+     */
+    void recordMatch()
+    {
+        uint64_t now = 0;
+        ReplayRecorder recorder(path.string());
+        recorder.setClock([&now]() { return now; });
+        ASSERT_TRUE(recorder.startRecording());
+
+        LoginResponsePacket login{};
+        login.header.opCode = S2C_LOGIN_OK;
+        login.playerId = 1;
+        record(recorder, login);
+        record(recorder, makeSpawn(1, EntityType::PLAYER));
+        record(recorder, makeSpawn(2, EntityType::BASIC));
+        record(recorder, makeSpawn(3, EntityType::BASIC));
+
+        now = 500;
+        for (uint32_t id = 1; id <= 3; ++id) {
+            record(recorder, makePosition(id));
+        }
+
+        now = 1500;
+        record(recorder, makeSpawn(4, EntityType::TANK));
+        record(recorder, makePosition(1));
+        now = 1800;
+        EntityDeadPacket dead{};
+        dead.header.opCode = S2C_ENTITY_DEAD;
+        dead.entityId = 2;
+        record(recorder, dead);
+
+        now = 2500;
+        record(recorder, makePosition(1));
+        ScoreUpdatePacket score{};
+        score.header.opCode = S2C_SCORE_UPDATE;
+        score.score = 100;
+        record(recorder, score);
+
+        recorder.stopRecording();
+        ASSERT_EQ(recorder.getDroppedRecordCount(), 0u);
+    }
+
+    ReplayTimeline analyzeMatch()
+    {
+        ReplayTimeline timeline;
+        ReplayPlayer player(path.string());
+        EXPECT_TRUE(player.load());
+        timeline.analyze(player);
+        return timeline;
+    }
+};
+
+TEST_F(ReplayTimelineTests, CountsPacketsSpawnsAndDeathsPerSecond)
+{
+    recordMatch();
+    ReplayTimeline timeline = analyzeMatch();
+
+    const auto& seconds = timeline.getSeconds();
+    ASSERT_EQ(seconds.size(), 3u);
+
+    EXPECT_EQ(seconds[0].second, 1u);
+    EXPECT_EQ(seconds[0].packets, 7u);
+    EXPECT_EQ(seconds[0].bytes, sizeof(LoginResponsePacket) +
+                                    3 * sizeof(EntitySpawnPacket) +
+                                    3 * sizeof(EntityPositionPacket));
+    EXPECT_EQ(seconds[0].spawns, 3u);
+    EXPECT_EQ(seconds[0].deaths, 0u);
+    EXPECT_EQ(seconds[0].packetsByOpCode[S2C_LOGIN_OK], 1u);
+    EXPECT_EQ(seconds[0].packetsByOpCode[S2C_ENTITY_POS], 3u);
+
+    EXPECT_EQ(seconds[1].second, 2u);
+    EXPECT_EQ(seconds[1].packets, 3u);
+    EXPECT_EQ(seconds[1].bytes, sizeof(EntitySpawnPacket) +
+                                    sizeof(EntityPositionPacket) +
+                                    sizeof(EntityDeadPacket));
+    EXPECT_EQ(seconds[1].spawns, 1u);
+    EXPECT_EQ(seconds[1].deaths, 1u);
+
+    EXPECT_EQ(seconds[2].second, 3u);
+    EXPECT_EQ(seconds[2].packets, 2u);
+    EXPECT_EQ(seconds[2].spawns, 0u);
+    EXPECT_EQ(seconds[2].deaths, 0u);
+    EXPECT_EQ(seconds[2].packetsByOpCode[S2C_SCORE_UPDATE], 1u);
+}
+
+TEST_F(ReplayTimelineTests, CountsTheEntitiesAliveAtTheEndOfEachSecond)
+{
+    recordMatch();
+    ReplayTimeline timeline = analyzeMatch();
+
+    const auto& seconds = timeline.getSeconds();
+    ASSERT_EQ(seconds.size(), 3u);
+
+    EXPECT_EQ(seconds[0].entities, 3u);
+    EXPECT_EQ(seconds[0].entitiesByType[EntityType::PLAYER], 1u);
+    EXPECT_EQ(seconds[0].entitiesByType[EntityType::BASIC], 2u);
+    EXPECT_EQ(seconds[0].entitiesByType[EntityType::TANK], 0u);
+
+    for (size_t i = 1; i < seconds.size(); ++i) {
+        EXPECT_EQ(seconds[i].entities, 3u);
+        EXPECT_EQ(seconds[i].entitiesByType[EntityType::PLAYER], 1u);
+        EXPECT_EQ(seconds[i].entitiesByType[EntityType::BASIC], 1u);
+        EXPECT_EQ(seconds[i].entitiesByType[EntityType::TANK], 1u);
+    }
+}
+
+TEST_F(ReplayTimelineTests, CsvHasOneColumnPerOpCodeAndTypeSeen)
+{
+    recordMatch();
+    ReplayTimeline timeline = analyzeMatch();
+
+    std::ostringstream csv;
+    timeline.writeCsv(csv);
+    std::istringstream lines(csv.str());
+    std::string header;
+    std::string row;
+    ASSERT_TRUE(std::getline(lines, header));
+
+    // Opcodes then types, each in numeric order
+    EXPECT_EQ(header,
+              "second,packets,bytes,spawns,deaths,entities,"
+              "S2C_LOGIN_OK,S2C_ENTITY_NEW,S2C_ENTITY_POS,S2C_ENTITY_DEAD,"
+              "S2C_SCORE_UPDATE,PLAYER,BASIC,TANK");
+
+    ASSERT_TRUE(std::getline(lines, row));
+    EXPECT_EQ(row, "1,7," +
+                       std::to_string(sizeof(LoginResponsePacket) +
+                                      3 * sizeof(EntitySpawnPacket) +
+                                      3 * sizeof(EntityPositionPacket)) +
+                       ",3,0,3,1,3,3,0,0,1,2,0");
+
+    int rows = 1;
+    while (std::getline(lines, row)) {
+        rows++;
+    }
+    EXPECT_EQ(rows, 3);
+}
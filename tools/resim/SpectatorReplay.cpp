@@ -0,0 +1,155 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** SpectatorReplay
+*/
+
+#include "SpectatorReplay.hpp"
+
+#include <cmath>
+#include <tuple>
+
+#include "common/network/NetworkMessage.hpp"
+#include "common/network/Protocol.hpp"
+#include "server/GameRules.hpp"
+
+namespace rtype::resim {
+
+SpectatorReplay::SpectatorReplay(const std::string& filePath)
+    : _recorder(filePath)
+{
+    _recorder.setClock([this]() { return _timeMs; });
+}
+
+bool SpectatorReplay::start()
+{
+    _timeMs = 0;
+    _frame = 0;
+    _score = 0;
+    _knownEntities.clear();
+    if (!_recorder.startRecording()) {
+        return false;
+    }
+
+    // A spectator logs in as player 0, which owns no ship
+    auto login = NetworkMessage::createLoginResponsePacket(0, MAP_WIDTH,
+                                                           MAP_HEIGHT, 0);
+    _recorder.recordPacket(&login, sizeof(login));
+    return true;
+}
+
+void SpectatorReplay::recordFrame(engine::GameLoop& gameLoop,
+                                  double simulatedTime)
+{
+    _timeMs = static_cast<uint64_t>(std::llround(simulatedTime * 1000.0));
+
+    _updates.clear();
+    gameLoop.popEntityUpdates(_updates);
+    for (const auto& update : _updates) {
+        recordUpdate(update);
+    }
+
+    _frame++;
+    if (_frame % HEALTH_INTERVAL == 0) {
+        recordHealth(gameLoop);
+    }
+    if (_recorder.isKeyframeDue()) {
+        _recorder.recordKeyframe(buildKeyframe(gameLoop));
+    }
+}
+
+void SpectatorReplay::stop(uint8_t level, uint8_t playerCount)
+{
+    _recorder.setGameInfo(level, playerCount, _score);
+    _recorder.stopRecording();
+}
+
+void SpectatorReplay::recordUpdate(const engine::EntityStateUpdate& update)
+{
+    if (update.spawned) {
+        recordSpawn(update.entityId, update.entityType, update.x, update.y);
+        return;
+    }
+
+    if (update.destroyed) {
+        _knownEntities.erase(update.entityId);
+        auto dead = NetworkMessage::createEntityDeadPacket(update.entityId, 0);
+        _recorder.recordPacket(&dead, sizeof(dead));
+
+        if (rules::isEnemy(update.entityType) && update.killedByPlayer) {
+            _score += rules::getScoreForEnemy(update.entityType);
+            auto score = NetworkMessage::createScoreUpdatePacket(_score, 0);
+            _recorder.recordPacket(&score, sizeof(score));
+        }
+        return;
+    }
+
+    // Players join without a spawn update: the server announces them itself
+    if (!_knownEntities.contains(update.entityId)) {
+        recordSpawn(update.entityId, update.entityType, update.x, update.y);
+        return;
+    }
+    auto position = NetworkMessage::createEntityPositionPacket(
+        update.entityId, update.x, update.y, 0);
+    _recorder.recordPacket(&position, sizeof(position));
+}
+
+void SpectatorReplay::recordSpawn(uint32_t entityId, uint8_t type, float x,
+                                  float y)
+{
+    _knownEntities.insert(entityId);
+    auto spawn =
+        NetworkMessage::createEntitySpawnPacket(entityId, type, x, y, 0);
+    _recorder.recordPacket(&spawn, sizeof(spawn));
+}
+
+void SpectatorReplay::recordHealth(engine::GameLoop& gameLoop)
+{
+    std::vector<std::tuple<uint32_t, float, float>> healthUpdates;
+    gameLoop.getAllHealthUpdates(healthUpdates);
+
+    for (const auto& [entityId, current, max] : healthUpdates) {
+        HealthUpdatePacket packet{};
+        packet.header.opCode = S2C_HEALTH_UPDATE;
+        packet.header.packetSize = sizeof(HealthUpdatePacket);
+        packet.entityId = entityId;
+        packet.currentHealth = current;
+        packet.maxHealth = max;
+        _recorder.recordPacket(&packet, sizeof(packet));
+    }
+}
+
+std::vector<uint8_t> SpectatorReplay::buildKeyframe(engine::GameLoop& gameLoop)
+{
+    std::vector<uint8_t> keyframe;
+
+    replay::appendKeyframePacket(
+        keyframe,
+        NetworkMessage::createLoginResponsePacket(0, MAP_WIDTH, MAP_HEIGHT, 0));
+    replay::appendKeyframePacket(
+        keyframe, NetworkMessage::createScoreUpdatePacket(_score, 0));
+
+    std::vector<engine::EntityStateUpdate> entities;
+    gameLoop.getAllEntities(entities);
+    for (const auto& entity : entities) {
+        replay::appendKeyframePacket(
+            keyframe,
+            NetworkMessage::createEntitySpawnPacket(
+                entity.entityId, entity.entityType, entity.x, entity.y, 0));
+    }
+
+    std::vector<std::tuple<uint32_t, float, float>> healthUpdates;
+    gameLoop.getAllHealthUpdates(healthUpdates);
+    for (const auto& [entityId, current, max] : healthUpdates) {
+        HealthUpdatePacket packet{};
+        packet.header.opCode = S2C_HEALTH_UPDATE;
+        packet.entityId = entityId;
+        packet.currentHealth = current;
+        packet.maxHealth = max;
+        replay::appendKeyframePacket(keyframe, packet);
+    }
+    return keyframe;
+}
+
+}  // namespace rtype::resim
@@ -0,0 +1,70 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** SpectatorReplay
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "common/replay/ReplayRecorder.hpp"
+#include "engine/system/GameLoop.hpp"
+
+namespace rtype::resim {
+
+/**
+ * @brief Writes a re-simulated match as a client replay (.rtr)
+ *
+ * Each frame's entity updates become the packets GameServer broadcasts to
+ * every client, stamped with the simulated time, so the result plays in
+ * the replay viewer like a capture from a client that saw the whole match.
+ */
+class SpectatorReplay {
+   public:
+    explicit SpectatorReplay(const std::string& filePath);
+
+    bool start();
+
+    /**
+     * @brief Record the updates produced by the frame that just ran
+     * @param simulatedTime Match time at the end of the frame, in seconds
+     */
+    void recordFrame(engine::GameLoop& gameLoop, double simulatedTime);
+
+    /**
+     * @param level Last level started, 0 if unknown
+     * @param playerCount Most players seen in the match at once
+     */
+    void stop(uint8_t level, uint8_t playerCount);
+
+    uint32_t getScore() const { return _score; }
+    uint64_t getDroppedRecordCount() const
+    {
+        return _recorder.getDroppedRecordCount();
+    }
+
+   private:
+    static constexpr uint16_t MAP_WIDTH = 1920;
+    static constexpr uint16_t MAP_HEIGHT = 1080;
+    /// GameServer sends health every 10 frames
+    static constexpr uint64_t HEALTH_INTERVAL = 10;
+
+    ReplayRecorder _recorder;
+    uint64_t _timeMs = 0;
+    uint64_t _frame = 0;
+    uint32_t _score = 0;
+    std::unordered_set<uint32_t> _knownEntities;
+    std::vector<engine::EntityStateUpdate> _updates;
+
+    void recordUpdate(const engine::EntityStateUpdate& update);
+    void recordSpawn(uint32_t entityId, uint8_t type, float x, float y);
+    void recordHealth(engine::GameLoop& gameLoop);
+    std::vector<uint8_t> buildKeyframe(engine::GameLoop& gameLoop);
+};
+
+}  // namespace rtype::resim
@@ -0,0 +1,148 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** main
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "SpectatorReplay.hpp"
+#include "engine/record/MatchReplayer.hpp"
+
+struct ResimConfig {
+    std::string matchPath;
+    std::string replayPath;
+    uint64_t maxTicks = 0;
+};
+
+static void printUsage(const char* program)
+{
+    std::cout
+        << "Usage: " << program << " --match FILE [options]\n"
+        << "Re-simulate a recorded match (.rtm) as fast as possible\n\n"
+        << "  --match FILE   Match recording written by the server\n"
+        << "  --replay FILE  Also write a spectator replay (.rtr)\n"
+        << "  --ticks N      Stop after N frames (default: whole match)\n\n"
+        << "Run from the directory holding the levels/ the match was "
+           "played with.\n";
+}
+
+static bool parseArguments(int argc, char** argv, ResimConfig& config)
+{
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h") {
+            return false;
+        }
+        if (i + 1 >= argc) {
+            std::cerr << "Missing value for " << arg << std::endl;
+            return false;
+        }
+        std::string value = argv[++i];
+
+        try {
+            if (arg == "--match") {
+                config.matchPath = value;
+            } else if (arg == "--replay") {
+                config.replayPath = value;
+            } else if (arg == "--ticks") {
+                config.maxTicks = std::stoull(value);
+            } else {
+                std::cerr << "Unknown option: " << arg << std::endl;
+                return false;
+            }
+        } catch (const std::exception&) {
+            std::cerr << "Invalid value for " << arg << ": " << value
+                      << std::endl;
+            return false;
+        }
+    }
+    if (config.matchPath.empty()) {
+        std::cerr << "Missing --match" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Players currently on the field, for the replay metadata
+ */
+static uint8_t countPlayers(engine::GameLoop& gameLoop)
+{
+    std::vector<engine::EntityStateUpdate> players;
+    gameLoop.getAllPlayers(players);
+    return static_cast<uint8_t>(std::min<size_t>(players.size(), 255));
+}
+
+int main(int argc, char** argv)
+{
+    ResimConfig config;
+    if (!parseArguments(argc, argv, config)) {
+        printUsage(argv[0]);
+        return 84;
+    }
+
+    engine::GameLoop gameLoop;
+    engine::MatchReplayer replayer(gameLoop);
+    if (!replayer.open(config.matchPath)) {
+        std::cerr << "Not a match recording: " << config.matchPath
+                  << std::endl;
+        return 84;
+    }
+
+    std::unique_ptr<rtype::resim::SpectatorReplay> spectator;
+    if (!config.replayPath.empty()) {
+        spectator =
+            std::make_unique<rtype::resim::SpectatorReplay>(config.replayPath);
+        if (!spectator->start()) {
+            return 84;
+        }
+    }
+
+    auto started = std::chrono::steady_clock::now();
+    uint8_t maxPlayers = 0;
+    while (
+        (config.maxTicks == 0 || replayer.getTickCount() < config.maxTicks) &&
+        replayer.step()) {
+        if (spectator) {
+            spectator->recordFrame(gameLoop, replayer.getSimulatedTime());
+        }
+        if (replayer.getTickCount() % 60 == 0) {
+            maxPlayers = std::max(maxPlayers, countPlayers(gameLoop));
+        }
+    }
+    std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - started;
+    gameLoop.stop();
+
+    if (spectator) {
+        spectator->stop(0, maxPlayers);
+    }
+
+    double simulated = replayer.getSimulatedTime();
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "Seed: " << replayer.getConfig().seed << std::endl;
+    std::cout << "Frames: " << replayer.getTickCount() << " (" << simulated
+              << " s of play)" << std::endl;
+    std::cout << "Wall time: " << elapsed.count() << " s";
+    if (elapsed.count() > 0.0) {
+        std::cout << " (" << simulated / elapsed.count() << "x realtime)";
+    }
+    std::cout << std::endl;
+    if (spectator) {
+        std::cout << "Spectator replay: " << config.replayPath << " (score "
+                  << spectator->getScore() << ")" << std::endl;
+        if (spectator->getDroppedRecordCount() > 0) {
+            std::cerr << "Warning: " << spectator->getDroppedRecordCount()
+                      << " replay records dropped" << std::endl;
+        }
+    }
+    return 0;
+}